@@ -1,470 +1,1777 @@
-
-#include "UnrealLiveLinkCInterface.h"
-
-#include "Async/TaskGraphInterfaces.h"
-#include "LiveLinkProvider.h"
-#include "LiveLinkRefSkeleton.h"
-#include "LiveLinkTypes.h"
-#include "Misc/CommandLine.h"
-#include "Misc/ConfigCacheIni.h"
-#include "Misc/OutputDevice.h"
-#include "Modules/ModuleManager.h"
-#include "RequiredProgramMainCPPInclude.h"
-#include "Roles/LiveLinkAnimationRole.h"
-#include "Roles/LiveLinkAnimationTypes.h"
-#include "Roles/LiveLinkCameraRole.h"
-#include "Roles/LiveLinkCameraTypes.h"
-#include "Roles/LiveLinkLightRole.h"
-#include "Roles/LiveLinkLightTypes.h"
-#include "Roles/LiveLinkTransformRole.h"
-#include "Roles/LiveLinkTransformTypes.h"
-#include "Features/IModularFeatures.h"
-#include "INetworkMessagingExtension.h"
-#include "Shared/UdpMessagingSettings.h"
-#include "UObject/Object.h"
-
-
-DEFINE_LOG_CATEGORY_STATIC(LogUnrealLiveLinkCInterface, Log, All);
-
-IMPLEMENT_APPLICATION(UnrealLiveLinkCInterface, "UnrealLiveLinkCInterface");
-
-TSharedPtr<ILiveLinkProvider> LiveLinkProvider = nullptr;
-FString LiveLinkProviderName = "";
-
-FDelegateHandle ConnectionStatusChangedHandle{};
-
-TArray<void(*)()> ConnectionCallbacks{};
-
-
-int32_t TimecodeRates[UNREAL_LIVE_LINK_TIMECODE_120 + 1][2] = {
-		{ 0, 0 },		// unknown
-		{ 24000, 1001 },	// 23.98
-		{ 24, 1 },		// 24
-		{ 25, 1 },		// 25
-		{ 30000, 1001 },	// 29.97 NDF
-		{ 30000, 1001 },	// 29.97 DF
-		{ 30, 1 },		// 30
-		{ 48000, 1001 },	// 47.95
-		{ 48, 1 },		// 48
-		{ 50, 1 },		// 50
-		{ 60000, 1001 },	// 59.94 NDF
-		{ 60000, 1001 },	// 59.94 DF
-		{ 60, 1 },		// 60
-		{ 72, 1 },		// 72
-		{ 96, 1 },		// 96
-		{ 100, 1 },		// 100
-		{ 120, 1 }		// 120
-};
-
-
-// set FTransform from Unreal Live Link C Interface Transform
-static void SetFTransform(FTransform &Transform, const UnrealLiveLink_Transform &InTransform)
-{
-	Transform.SetRotation(FQuat(InTransform.rotation[0], InTransform.rotation[1], InTransform.rotation[2], InTransform.rotation[3]));
-	Transform.SetTranslation(FVector(InTransform.translation[0], InTransform.translation[1], InTransform.translation[2]));
-	Transform.SetScale3D(FVector(InTransform.scale[0], InTransform.scale[1], InTransform.scale[2]));
-}
-
-
-static void OnConnectionStatusChanged()
-{
-	for (const TArray<void (*)()>::ElementType &Callback : ConnectionCallbacks)
-	{
-		Callback();
-	}
-}
-
-void UnrealLiveLink_Initialize()
-{
-	GEngineLoop.PreInit(TEXT("UnrealLiveLinkCInterface -Messaging"));
-
-	// ensure target platform manager is referenced early as it must be created on the main thread
-	GetTargetPlatformManager();
-
-	ProcessNewlyLoadedUObjects();
-
-	// Tell the module manager that it may now process newly-loaded UObjects when new C++ modules are loaded
-	FModuleManager::Get().StartProcessingNewlyLoadedObjects();
-	FModuleManager::Get().LoadModule(TEXT("UdpMessaging"));
-
-	IPluginManager::Get().LoadModulesForEnabledPlugins(ELoadingPhase::PreDefault);
-	IPluginManager::Get().LoadModulesForEnabledPlugins(ELoadingPhase::Default);
-	IPluginManager::Get().LoadModulesForEnabledPlugins(ELoadingPhase::PostDefault);
-}
-
-void UnrealLiveLink_Shutdown()
-{
-	RequestEngineExit(TEXT("UnrealLiveLinkCInterface unloading"));
-	FEngineLoop::AppPreExit();
-	FModuleManager::Get().UnloadModulesAtShutdown();
-	FEngineLoop::AppExit();
-}
-
-int UnrealLiveLink_GetVersion()
-{
-	return UNREAL_LIVE_LINK_API_VERSION;
-}
-
-void UnrealLiveLink_SetProviderName(const char* ProviderName)
-{
-	LiveLinkProviderName = ANSI_TO_TCHAR(ProviderName);
-}
-
-int UnrealLiveLink_StartLiveLink()
-{
-	if (LiveLinkProviderName.IsEmpty())
-	{
-		LiveLinkProviderName = "C Interface";
-	}
-
-	if (LiveLinkProvider != nullptr)
-	{
-		UE_LOG(LogUnrealLiveLinkCInterface, Display, TEXT("Live Link C Interface already Initialized"));
-		return UNREAL_LIVE_LINK_FAILED;
-	}
-
-	LiveLinkProvider = ILiveLinkProvider::CreateLiveLinkProvider(LiveLinkProviderName);
-	ConnectionStatusChangedHandle = LiveLinkProvider->RegisterConnStatusChangedHandle(FLiveLinkProviderConnectionStatusChanged::FDelegate::CreateStatic(&OnConnectionStatusChanged));
-
-	FTSTicker::GetCoreTicker().Tick(1.0f);
-
-	UE_LOG(LogUnrealLiveLinkCInterface, Display, TEXT("Live Link C Interface Initialized"));
-
-	return UNREAL_LIVE_LINK_OK;
-}
-
-int UnrealLiveLink_StopLiveLink()
-{
-	UE_LOG(LogUnrealLiveLinkCInterface, Display, TEXT("Live Link C Interface Shutting Down"));
-
-	if (ConnectionStatusChangedHandle.IsValid())
-	{
-		LiveLinkProvider->UnregisterConnStatusChangedHandle(ConnectionStatusChangedHandle);
-		ConnectionStatusChangedHandle.Reset();
-	}
-
-	FTSTicker::GetCoreTicker().Tick(1.0f);
-
-	if (LiveLinkProvider.IsValid())
-	{
-		//UE_LOG(LogUnrealLiveLinkCInterface, Display, TEXT("LiveLinkProvider References: %d"), LiveLinkProvider.GetSharedReferenceCount());
-		LiveLinkProvider.Reset();
-		LiveLinkProvider = nullptr;
-	}
-
-	return UNREAL_LIVE_LINK_OK;
-}
-
-static FString GetUnicastEndpoint() 
-{
-	if (IModularFeatures::Get().IsModularFeatureAvailable(INetworkMessagingExtension::ModularFeatureName))
-	{
-		UUdpMessagingSettings* Settings = GetMutableDefault<UUdpMessagingSettings>();
-		return Settings->UnicastEndpoint;
-	}
-
-	return TEXT("0.0.0.0:0");
-}
-
-void UnrealLiveLink_SetUnicastEndpoint(const char * InEndpoint)
-{
-	if (InEndpoint != GetUnicastEndpoint())
-	{
-		if (IModularFeatures::Get().IsModularFeatureAvailable(INetworkMessagingExtension::ModularFeatureName))
-		{
-			UnrealLiveLink_StopLiveLink();
-
-			UUdpMessagingSettings* Settings = GetMutableDefault<UUdpMessagingSettings>();
-			Settings->UnicastEndpoint = InEndpoint;
-			INetworkMessagingExtension& NetworkExtension = IModularFeatures::Get().GetModularFeature<INetworkMessagingExtension>(INetworkMessagingExtension::ModularFeatureName);
-			NetworkExtension.RestartServices();
-
-			UnrealLiveLink_StartLiveLink();
-		}
-	}
-}
-
-int UnrealLiveLink_AddStaticEndpoint(const char * InEndpoint)
-{
-	if (IModularFeatures::Get().IsModularFeatureAvailable(INetworkMessagingExtension::ModularFeatureName))
-	{
-		INetworkMessagingExtension& NetworkExtension = IModularFeatures::Get().GetModularFeature<INetworkMessagingExtension>(INetworkMessagingExtension::ModularFeatureName);
-		NetworkExtension.AddEndpoint(InEndpoint);
-		return UNREAL_LIVE_LINK_OK;
-	}
-	return UNREAL_LIVE_LINK_FAILED;
-}
-
-int UnrealLiveLink_RemoveStaticEndpoint(const char * InEndpoint)
-{
-	if (IModularFeatures::Get().IsModularFeatureAvailable(INetworkMessagingExtension::ModularFeatureName))
-	{
-		INetworkMessagingExtension& NetworkExtension = IModularFeatures::Get().GetModularFeature<INetworkMessagingExtension>(INetworkMessagingExtension::ModularFeatureName);
-		NetworkExtension.RemoveEndpoint(InEndpoint);
-		return UNREAL_LIVE_LINK_OK;
-	}
-	return UNREAL_LIVE_LINK_FAILED;
-}
-
-
-void UnrealLiveLink_RegisterConnectionUpdateCallback(void (*Callback)())
-{
-	ConnectionCallbacks.Push(Callback);
-}
-
-int UnrealLiveLink_HasConnection()
-{
-	return LiveLinkProvider->HasConnection() ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_NOT_CONNECTED;
-}
-
-
-static void SetBasicFrameParameters(const char *SubjectName, const double WorldTime,
-	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues, FLiveLinkFrameDataStruct &FrameData)
-{
-	FLiveLinkBaseFrameData& BaseData = *FrameData.Cast<FLiveLinkBaseFrameData>();
-
-	BaseData.WorldTime = WorldTime;
-	
-	if (PropValues)
-	{
-		for (int Idx = 0; Idx < PropValues->valueCount; Idx++)
-		{
-			BaseData.PropertyValues.Add(PropValues->values[Idx]);
-		}
-	}
-
-	if (Metadata)
-	{
-		for (int Idx = 0; Idx < Metadata->keyValueCount; Idx++)
-		{
-			BaseData.MetaData.StringMetaData.Add(Metadata->keyValues[Idx].name, Metadata->keyValues[Idx].value);
-		}
-
-		// set sceneTime
-		bool DropFrame = Metadata->timecode.format == UNREAL_LIVE_LINK_TIMECODE_29_97_DF || Metadata->timecode.format == UNREAL_LIVE_LINK_TIMECODE_59_94_DF;
-		FTimecode Timecode(Metadata->timecode.hours, Metadata->timecode.minutes, Metadata->timecode.seconds, Metadata->timecode.frames, DropFrame);
-
-		int32_t Nom = TimecodeRates[Metadata->timecode.format][0];
-		int32_t Denom = TimecodeRates[Metadata->timecode.format][1];
-
-		FQualifiedFrameTime FrameTime(Timecode, FFrameRate(Nom, Denom));
-		BaseData.MetaData.SceneTime = FrameTime;
-	}
-}
-
-
-void UnrealLiveLink_SetBasicStructure(const char *SubjectName, const UnrealLiveLink_Properties *Properties)
-{
-	FLiveLinkStaticDataStruct StaticData(FLiveLinkBaseStaticData::StaticStruct());
-	FLiveLinkBaseStaticData& BaseData = *StaticData.Cast<FLiveLinkBaseStaticData>();
-
-	if (Properties)
-	{
-		for (int Idx = 0; Idx < Properties->nameCount; Idx++)
-		{
-			BaseData.PropertyNames.Add(Properties->names[Idx]);
-		}
-	}
-
-	LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkBasicRole::StaticClass(), MoveTemp(StaticData));
-}
-
-void UnrealLiveLink_UpdateBasicFrame(const char *SubjectName, const double WorldTime,
-	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues)
-{
-	FLiveLinkFrameDataStruct FrameData(FLiveLinkBaseFrameData::StaticStruct());
-
-	SetBasicFrameParameters(SubjectName, WorldTime, Metadata, PropValues, FrameData);
-
-	LiveLinkProvider->UpdateSubjectFrameData(SubjectName, MoveTemp(FrameData));
-}
-
-
-void UnrealLiveLink_SetAnimationStructure(
-	const char *SubjectName, const UnrealLiveLink_Properties *Properties, UnrealLiveLink_AnimationStatic *AnimStructure)
-{
-	FLiveLinkStaticDataStruct StaticData(FLiveLinkSkeletonStaticData::StaticStruct());
-	FLiveLinkSkeletonStaticData& AnimData = *StaticData.Cast<FLiveLinkSkeletonStaticData>();
-
-	if (Properties)
-	{
-		for (int Idx = 0; Idx < Properties->nameCount; Idx++)
-		{
-			AnimData.PropertyNames.Add(Properties->names[Idx]);
-		}
-	}
-
-	TArray<FName> Names;
-	TArray<int32> Indices;
-	for (int Idx = 0; Idx < AnimStructure->boneCount; Idx++)
-	{
-		Names.Add(AnimStructure->bones[Idx].name);
-		Indices.Add(AnimStructure->bones[Idx].parentIndex);
-	}
-
-	AnimData.SetBoneNames(Names);
-	AnimData.SetBoneParents(Indices);
-
-	LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkAnimationRole::StaticClass(), MoveTemp(StaticData));
-}
-
-void UnrealLiveLink_UpdateAnimationFrame(const char *SubjectName, const double WorldTime,
-	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
-	const UnrealLiveLink_Animation *Frame)
-{
-	FLiveLinkFrameDataStruct FrameData(FLiveLinkAnimationFrameData::StaticStruct());
-	FLiveLinkAnimationFrameData& AnimData = *FrameData.Cast<FLiveLinkAnimationFrameData>();
-
-	for (int Idx = 0; Idx < Frame->transformCount; Idx++)
-	{
-		UnrealLiveLink_Transform &Transform = Frame->transforms[Idx];
-
-		FTransform UETrans;
-
-		UETrans.SetRotation(FQuat(Transform.rotation[0], Transform.rotation[1], Transform.rotation[2], Transform.rotation[3]));
-		UETrans.SetTranslation(FVector(Transform.translation[0], Transform.translation[1], Transform.translation[2]));
-		UETrans.SetScale3D(FVector(Transform.scale[0], Transform.scale[1], Transform.scale[2]));
-
-		AnimData.Transforms.Add(UETrans);
-	}
-
-	SetBasicFrameParameters(SubjectName, WorldTime, Metadata, PropValues, FrameData);
-	
-	LiveLinkProvider->UpdateSubjectFrameData(SubjectName, MoveTemp(FrameData));
-}
-
-
-void UnrealLiveLink_SetTransformStructure(const char *SubjectName, const UnrealLiveLink_Properties *Properties)
-{
-	FLiveLinkStaticDataStruct StaticData(FLiveLinkTransformStaticData::StaticStruct());
-	FLiveLinkTransformStaticData& XformData = *StaticData.Cast<FLiveLinkTransformStaticData>();
-
-	if (Properties)
-	{
-		for (int Idx = 0; Idx < Properties->nameCount; Idx++)
-		{
-			XformData.PropertyNames.Add(Properties->names[Idx]);
-		}
-	}
-
-	LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkTransformRole::StaticClass(), MoveTemp(StaticData));
-}
-
-void UnrealLiveLink_UpdateTransformFrame(const char *SubjectName, const double WorldTime,
-	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
-	const UnrealLiveLink_Transform *Frame)
-{
-	FLiveLinkFrameDataStruct FrameData(FLiveLinkTransformFrameData::StaticStruct());
-	FLiveLinkTransformFrameData& XformData = *FrameData.Cast<FLiveLinkTransformFrameData>();
-
-	SetFTransform(XformData.Transform, *Frame);
-
-	SetBasicFrameParameters(SubjectName, WorldTime, Metadata, PropValues, FrameData);
-	
-	LiveLinkProvider->UpdateSubjectFrameData(SubjectName, MoveTemp(FrameData));
-}
-
-
-void UnrealLiveLink_SetCameraStructure(
-	const char *SubjectName, const UnrealLiveLink_Properties *Properties, UnrealLiveLink_CameraStatic *CameraStructure)
-{
-	FLiveLinkStaticDataStruct StaticData(FLiveLinkCameraStaticData::StaticStruct());
-	FLiveLinkCameraStaticData& CameraData = *StaticData.Cast<FLiveLinkCameraStaticData>();
-
-	if (Properties)
-	{
-		for (int Idx = 0; Idx < Properties->nameCount; Idx++)
-		{
-			CameraData.PropertyNames.Add(Properties->names[Idx]);
-		}
-	}
-	if (CameraStructure)
-	{
-		CameraData.bIsFieldOfViewSupported = CameraStructure->isFieldOfViewSupported != 0;
-		CameraData.bIsAspectRatioSupported = CameraStructure->isAspectRatioSupported != 0;
-		CameraData.bIsFocalLengthSupported = CameraStructure->isFocalLengthSupported != 0;
-		CameraData.bIsProjectionModeSupported = CameraStructure->isProjectionModeSupported != 0;
-		CameraData.FilmBackWidth = CameraStructure->filmBackWidth;
-		CameraData.FilmBackHeight = CameraStructure->filmBackHeight;
-		CameraData.bIsApertureSupported = CameraStructure->isApertureSupported != 0;
-		CameraData.bIsFocusDistanceSupported = CameraStructure->isFocusDistanceSupported != 0;
-	}
-	LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkCameraRole::StaticClass(), MoveTemp(StaticData));
-}
-
-void UnrealLiveLink_UpdateCameraFrame(const char *SubjectName, const double WorldTime,
-	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues, const UnrealLiveLink_Camera *Frame)
-{
-	FLiveLinkFrameDataStruct FrameData(FLiveLinkCameraFrameData::StaticStruct());
-	FLiveLinkCameraFrameData& CameraData = *FrameData.Cast<FLiveLinkCameraFrameData>();
-
-	CameraData.FieldOfView = Frame->fieldOfView;
-	CameraData.AspectRatio = Frame->aspectRatio;
-	CameraData.FocalLength = Frame->focalLength;
-	CameraData.Aperture = Frame->aperture;
-	CameraData.FocusDistance = Frame->focusDistance;
-	CameraData.ProjectionMode = Frame->isPerspective ? ELiveLinkCameraProjectionMode::Perspective : ELiveLinkCameraProjectionMode::Orthographic;
-
-	SetFTransform(CameraData.Transform, Frame->transform);
-
-	SetBasicFrameParameters(SubjectName, WorldTime, Metadata, PropValues, FrameData);
-
-	LiveLinkProvider->UpdateSubjectFrameData(SubjectName, MoveTemp(FrameData));
-}
-
-
-void UnrealLiveLink_SetLightStructure(
-	const char *SubjectName, const UnrealLiveLink_Properties *Properties, UnrealLiveLink_LightStatic *LightStructure)
-{
-	FLiveLinkStaticDataStruct StaticData(FLiveLinkLightStaticData::StaticStruct());
-	FLiveLinkLightStaticData& LightData = *StaticData.Cast<FLiveLinkLightStaticData>();
-
-	if (Properties)
-	{
-		for (int Idx = 0; Idx < Properties->nameCount; Idx++)
-		{
-			LightData.PropertyNames.Add(Properties->names[Idx]);
-		}
-	}
-	if (LightStructure)
-	{
-		LightData.bIsTemperatureSupported = LightStructure->isTemperatureSupported != 0;
-		LightData.bIsIntensitySupported = LightStructure->isIntensitySupported != 0;
-		LightData.bIsLightColorSupported = LightStructure->isLightColorSupported != 0;
-		LightData.bIsInnerConeAngleSupported = LightStructure->isInnerConeAngleSupported != 0;
-		LightData.bIsOuterConeAngleSupported = LightStructure->isOuterConeAngleSupported != 0;
-		LightData.bIsAttenuationRadiusSupported = LightStructure->isAttenuationRadiusSupported != 0;
-		LightData.bIsSourceLenghtSupported = LightStructure->isSourceLengthSupported != 0;
-		LightData.bIsSourceRadiusSupported = LightStructure->isSourceRadiusSupported != 0;
-		LightData.bIsSoftSourceRadiusSupported = LightStructure->isSoftSourceRadiusSupported != 0;
-	}
-
-	LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkLightRole::StaticClass(), MoveTemp(StaticData));
-}
-
-void UnrealLiveLink_UpdateLightFrame(const char *SubjectName, const double WorldTime,
-	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues, const UnrealLiveLink_Light *Frame)
-{
-	FLiveLinkFrameDataStruct FrameData(FLiveLinkLightFrameData::StaticStruct());
-	FLiveLinkLightFrameData& LightData = *FrameData.Cast<FLiveLinkLightFrameData>();
-
-	LightData.Temperature = Frame->temperature;
-	LightData.Intensity = Frame->intensity;
-	LightData.LightColor.R = Frame->lightColor[0];
-	LightData.LightColor.G = Frame->lightColor[1];
-	LightData.LightColor.B = Frame->lightColor[2];
-	LightData.LightColor.A = 255;
-	LightData.InnerConeAngle = Frame->innerConeAngle;
-	LightData.OuterConeAngle = Frame->outerConeAngle;
-	LightData.AttenuationRadius = Frame->attenuationRadius;
-	LightData.SourceRadius = Frame->sourceRadius;
-	LightData.SoftSourceRadius = Frame->softSourceRadius;
-	LightData.SourceLength = Frame->sourceLength;
-
-	SetFTransform(LightData.Transform, Frame->transform);
-
-	SetBasicFrameParameters(SubjectName, WorldTime, Metadata, PropValues, FrameData);
-	
-	LiveLinkProvider->UpdateSubjectFrameData(SubjectName, MoveTemp(FrameData));
-}
-
+
+#include "UnrealLiveLinkCInterface.h"
+#include "UnrealLiveLinkCInterfaceConversion.h"
+#include "UnrealLiveLinkCInterfaceProvider.h"
+
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "LiveLinkProvider.h"
+#include "LiveLinkRefSkeleton.h"
+#include "LiveLinkTypes.h"
+#include "Misc/CommandLine.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/OutputDevice.h"
+#include "Misc/ScopeRWLock.h"
+#include "Modules/ModuleManager.h"
+#include "RequiredProgramMainCPPInclude.h"
+#include "Roles/LiveLinkAnimationRole.h"
+#include "Roles/LiveLinkAnimationTypes.h"
+#include "Roles/LiveLinkCameraRole.h"
+#include "Roles/LiveLinkCameraTypes.h"
+#include "Roles/LiveLinkLightRole.h"
+#include "Roles/LiveLinkLightTypes.h"
+#include "Roles/LiveLinkTransformRole.h"
+#include "Roles/LiveLinkTransformTypes.h"
+#include "Features/IModularFeatures.h"
+#include "Hash/CityHash.h"
+#include "INetworkMessagingExtension.h"
+#include "Shared/UdpMessagingSettings.h"
+#include "UObject/Object.h"
+
+
+DEFINE_LOG_CATEGORY_STATIC(LogUnrealLiveLinkCInterface, Log, All);
+
+IMPLEMENT_APPLICATION(UnrealLiveLinkCInterface, "UnrealLiveLinkCInterface");
+
+// providers by handle, the default provider is created on initialize
+FRWLock ProvidersLock;
+TMap<int, TSharedPtr<FUnrealLiveLinkCInterfaceProvider>> Providers{};
+int NextProviderHandle = UNREAL_LIVE_LINK_DEFAULT_PROVIDER + 1;
+
+// skeleton static data and its content hash, converted once and shared by subjects
+struct FSkeletonTemplate
+{
+	FLiveLinkSkeletonStaticData StaticData;
+	uint64 StaticDataHash = 0;
+};
+
+// skeleton templates by handle, shared by every provider
+FRWLock SkeletonTemplatesLock;
+TMap<int, TSharedRef<const FSkeletonTemplate>> SkeletonTemplates{};
+int NextSkeletonTemplateHandle = 1;
+
+// for each bone of a skeleton, the index of the source joint that feeds it (INDEX_NONE if the source doesn't have it)
+struct FSkeletonMap
+{
+	TArray<int32> SourceIndices;
+	// the highest source index used plus one, the shortest frame the map can read
+	int32 SourceCount = 0;
+};
+
+// skeleton maps by handle, shared by every provider
+FRWLock SkeletonMapsLock;
+TMap<int, TSharedRef<const FSkeletonMap>> SkeletonMaps{};
+int NextSkeletonMapHandle = 1;
+
+
+const int32_t TimecodeRates[UNREAL_LIVE_LINK_TIMECODE_120 + 1][2] = {
+		{ 0, 0 },		// unknown
+		{ 24000, 1001 },	// 23.98
+		{ 24, 1 },		// 24
+		{ 25, 1 },		// 25
+		{ 30000, 1001 },	// 29.97 NDF
+		{ 30000, 1001 },	// 29.97 DF
+		{ 30, 1 },		// 30
+		{ 48000, 1001 },	// 47.95
+		{ 48, 1 },		// 48
+		{ 50, 1 },		// 50
+		{ 60000, 1001 },	// 59.94 NDF
+		{ 60000, 1001 },	// 59.94 DF
+		{ 60, 1 },		// 60
+		{ 72, 1 },		// 72
+		{ 96, 1 },		// 96
+		{ 100, 1 },		// 100
+		{ 120, 1 }		// 120
+};
+
+
+// set FTransform from Unreal Live Link C Interface Transform, with the rotation in the subject's rotation format
+static void SetFTransform(FTransform &Transform, const UnrealLiveLink_Transform &InTransform, const FUnrealLiveLinkCInterfaceSubjectSettings &Settings)
+{
+	if (Settings.RotationOrder == UNREAL_LIVE_LINK_ROTATION_QUATERNION)
+	{
+		Transform.SetRotation(FQuat(InTransform.rotation[0], InTransform.rotation[1], InTransform.rotation[2], InTransform.rotation[3]));
+	}
+	else
+	{
+		Transform.SetRotation(EulerToQuat(InTransform.rotation, Settings.RotationOrder, Settings.bRadians));
+	}
+	Transform.SetTranslation(FVector(InTransform.translation[0], InTransform.translation[1], InTransform.translation[2]));
+	Transform.SetScale3D(FVector(InTransform.scale[0], InTransform.scale[1], InTransform.scale[2]));
+}
+
+
+static FName GetPackedName(const UnrealLiveLink_PackedStrings &Strings, int Idx)
+{
+	return FName(Strings.lengths[Idx], Strings.text + Strings.offsets[Idx]);
+}
+
+static FString GetPackedString(const UnrealLiveLink_PackedStrings &Strings, int Idx)
+{
+	return FString(Strings.lengths[Idx], Strings.text + Strings.offsets[Idx]);
+}
+
+// from this many names the interning is spread over the task graph workers, the name table locks per hash shard
+static constexpr int32 ParallelInternMinNames = 1024;
+
+// append Count names made by GetName(Idx)
+template <typename GetNameType>
+static void InternNames(int32 Count, GetNameType GetName, TArray<FName> &Names)
+{
+	const int32 First = Names.AddDefaulted(Count);
+	ParallelFor(Count, [&GetName, &Names, First](int32 Idx)
+	{
+		Names[First + Idx] = GetName(Idx);
+	}, Count < ParallelInternMinNames);
+}
+
+static void AddPropertyNames(const UnrealLiveLink_Properties *Properties, TArray<FName> &PropertyNames)
+{
+	if (Properties)
+	{
+		InternNames(Properties->nameCount, [Properties](int32 Idx) { return FName(Properties->names[Idx]); }, PropertyNames);
+	}
+}
+
+static void AddPropertyNames(const UnrealLiveLink_PackedStrings *Properties, TArray<FName> &PropertyNames)
+{
+	if (Properties)
+	{
+		InternNames(Properties->count, [Properties](int32 Idx) { return GetPackedName(*Properties, Idx); }, PropertyNames);
+	}
+}
+
+static uint64 HashPropertyNames(const UnrealLiveLink_Properties *Properties, uint64 Hash)
+{
+	const int NameCount = Properties ? Properties->nameCount : 0;
+	Hash = CityHash64WithSeed(reinterpret_cast<const char *>(&NameCount), sizeof(NameCount), Hash);
+	for (int Idx = 0; Idx < NameCount; Idx++)
+	{
+		const char *Name = Properties->names[Idx];
+		Hash = CityHash64WithSeed(Name, FCStringAnsi::Strlen(Name) + 1, Hash);
+	}
+
+	return Hash;
+}
+
+static uint64 HashPropertyNames(const UnrealLiveLink_PackedStrings *Properties, uint64 Hash)
+{
+	const int NameCount = Properties ? Properties->count : 0;
+	Hash = CityHash64WithSeed(reinterpret_cast<const char *>(&NameCount), sizeof(NameCount), Hash);
+	for (int Idx = 0; Idx < NameCount; Idx++)
+	{
+		Hash = CityHash64WithSeed(reinterpret_cast<const char *>(&Properties->lengths[Idx]), sizeof(int), Hash);
+		Hash = CityHash64WithSeed(Properties->text + Properties->offsets[Idx], Properties->lengths[Idx], Hash);
+	}
+
+	return Hash;
+}
+
+// content hash of the role, property names and optional capability structure of a subject's static data
+template <typename PropertiesType>
+static uint64 HashStaticData(TSubclassOf<ULiveLinkRole> Role, const PropertiesType *Properties,
+	const void *Structure = nullptr, SIZE_T StructureSize = 0)
+{
+	const UClass *RoleClass = Role.Get();
+	uint64 Hash = CityHash64(reinterpret_cast<const char *>(&RoleClass), sizeof(RoleClass));
+
+	Hash = HashPropertyNames(Properties, Hash);
+
+	if (Structure)
+	{
+		Hash = CityHash64WithSeed(static_cast<const char *>(Structure), StructureSize, Hash);
+	}
+
+	return Hash;
+}
+
+static uint64 HashSkeleton(const UnrealLiveLink_AnimationStatic *AnimStructure, uint64 Hash)
+{
+	Hash = CityHash64WithSeed(reinterpret_cast<const char *>(&AnimStructure->boneCount), sizeof(AnimStructure->boneCount), Hash);
+	for (int Idx = 0; Idx < AnimStructure->boneCount; Idx++)
+	{
+		const UnrealLiveLink_Bone &Bone = AnimStructure->bones[Idx];
+		Hash = CityHash64WithSeed(Bone.name, FCStringAnsi::Strlen(Bone.name) + 1, Hash);
+		Hash = CityHash64WithSeed(reinterpret_cast<const char *>(&Bone.parentIndex), sizeof(Bone.parentIndex), Hash);
+	}
+
+	return Hash;
+}
+
+static uint64 HashSkeleton(const UnrealLiveLink_PackedAnimationStatic *AnimStructure, uint64 Hash)
+{
+	const UnrealLiveLink_PackedStrings &BoneNames = AnimStructure->boneNames;
+	Hash = CityHash64WithSeed(reinterpret_cast<const char *>(&BoneNames.count), sizeof(BoneNames.count), Hash);
+	for (int Idx = 0; Idx < BoneNames.count; Idx++)
+	{
+		Hash = CityHash64WithSeed(reinterpret_cast<const char *>(&BoneNames.lengths[Idx]), sizeof(int), Hash);
+		Hash = CityHash64WithSeed(BoneNames.text + BoneNames.offsets[Idx], BoneNames.lengths[Idx], Hash);
+		Hash = CityHash64WithSeed(reinterpret_cast<const char *>(&AnimStructure->parentIndices[Idx]), sizeof(int), Hash);
+	}
+
+	return Hash;
+}
+
+static TSharedPtr<FUnrealLiveLinkCInterfaceProvider> FindProvider(int Provider)
+{
+	FReadScopeLock Lock(ProvidersLock);
+	const TSharedPtr<FUnrealLiveLinkCInterfaceProvider> *Found = Providers.Find(Provider);
+	return Found ? *Found : nullptr;
+}
+
+static TArray<TSharedPtr<FUnrealLiveLinkCInterfaceProvider>> GetAllProviders()
+{
+	TArray<TSharedPtr<FUnrealLiveLinkCInterfaceProvider>> AllProviders;
+	FReadScopeLock Lock(ProvidersLock);
+	Providers.GenerateValueArray(AllProviders);
+	return AllProviders;
+}
+
+void UnrealLiveLink_Initialize()
+{
+	GEngineLoop.PreInit(TEXT("UnrealLiveLinkCInterface -Messaging"));
+
+	// ensure target platform manager is referenced early as it must be created on the main thread
+	GetTargetPlatformManager();
+
+	ProcessNewlyLoadedUObjects();
+
+	// Tell the module manager that it may now process newly-loaded UObjects when new C++ modules are loaded
+	FModuleManager::Get().StartProcessingNewlyLoadedObjects();
+	FModuleManager::Get().LoadModule(TEXT("UdpMessaging"));
+
+	IPluginManager::Get().LoadModulesForEnabledPlugins(ELoadingPhase::PreDefault);
+	IPluginManager::Get().LoadModulesForEnabledPlugins(ELoadingPhase::Default);
+	IPluginManager::Get().LoadModulesForEnabledPlugins(ELoadingPhase::PostDefault);
+
+	{
+		FWriteScopeLock Lock(ProvidersLock);
+		Providers.Add(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, MakeShared<FUnrealLiveLinkCInterfaceProvider>(FString()));
+	}
+
+	UnrealLiveLink_SetCoreTickerRate(UNREAL_LIVE_LINK_DEFAULT_TICKER_RATE);
+}
+
+void UnrealLiveLink_Shutdown()
+{
+	for (const TSharedPtr<FUnrealLiveLinkCInterfaceProvider> &Provider : GetAllProviders())
+	{
+		Provider->Stop();
+	}
+
+	{
+		FWriteScopeLock Lock(ProvidersLock);
+		Providers.Empty();
+	}
+
+	UnrealLiveLink_SetCoreTickerRate(0.0);
+
+	RequestEngineExit(TEXT("UnrealLiveLinkCInterface unloading"));
+	FEngineLoop::AppPreExit();
+	FModuleManager::Get().UnloadModulesAtShutdown();
+	FEngineLoop::AppExit();
+}
+
+int UnrealLiveLink_GetVersion()
+{
+	return UNREAL_LIVE_LINK_API_VERSION;
+}
+
+static UnrealLiveLink_Interface MakeInterface()
+{
+	UnrealLiveLink_Interface Interface = {};
+	Interface.version = UNREAL_LIVE_LINK_API_VERSION;
+	Interface.size = sizeof(UnrealLiveLink_Interface);
+	Interface.capabilities = UNREAL_LIVE_LINK_CAPABILITY_PROVIDERS | UNREAL_LIVE_LINK_CAPABILITY_BATCH |
+		UNREAL_LIVE_LINK_CAPABILITY_SKELETON_TEMPLATES | UNREAL_LIVE_LINK_CAPABILITY_MATRICES | UNREAL_LIVE_LINK_CAPABILITY_PACKED |
+		UNREAL_LIVE_LINK_CAPABILITY_FRAME_PROCESSING | UNREAL_LIVE_LINK_CAPABILITY_PARALLEL_SETUP |
+		UNREAL_LIVE_LINK_CAPABILITY_TRANSPORT_SETTINGS | UNREAL_LIVE_LINK_CAPABILITY_TICKER | UNREAL_LIVE_LINK_CAPABILITY_CLOCK |
+		UNREAL_LIVE_LINK_CAPABILITY_SKELETON_MAPS | UNREAL_LIVE_LINK_CAPABILITY_SPARSE;
+
+	Interface.Initialize = &UnrealLiveLink_Initialize;
+	Interface.Shutdown = &UnrealLiveLink_Shutdown;
+	Interface.GetVersion = &UnrealLiveLink_GetVersion;
+	Interface.SetProviderName = &UnrealLiveLink_SetProviderName;
+	Interface.StartLiveLink = &UnrealLiveLink_StartLiveLink;
+	Interface.StopLiveLink = &UnrealLiveLink_StopLiveLink;
+	Interface.SetUnicastEndpoint = &UnrealLiveLink_SetUnicastEndpoint;
+	Interface.AddStaticEndpoint = &UnrealLiveLink_AddStaticEndpoint;
+	Interface.RemoveStaticEndpoint = &UnrealLiveLink_RemoveStaticEndpoint;
+	Interface.RegisterConnectionUpdateCallback = &UnrealLiveLink_RegisterConnectionUpdateCallback;
+	Interface.HasConnection = &UnrealLiveLink_HasConnection;
+	Interface.SetBasicStructure = &UnrealLiveLink_SetBasicStructure;
+	Interface.UpdateBasicFrame = &UnrealLiveLink_UpdateBasicFrame;
+	Interface.SetAnimationStructure = &UnrealLiveLink_SetAnimationStructure;
+	Interface.UpdateAnimationFrame = &UnrealLiveLink_UpdateAnimationFrame;
+	Interface.SetTransformStructure = &UnrealLiveLink_SetTransformStructure;
+	Interface.UpdateTransformFrame = &UnrealLiveLink_UpdateTransformFrame;
+	Interface.SetCameraStructure = &UnrealLiveLink_SetCameraStructure;
+	Interface.UpdateCameraFrame = &UnrealLiveLink_UpdateCameraFrame;
+	Interface.SetLightStructure = &UnrealLiveLink_SetLightStructure;
+	Interface.UpdateLightFrame = &UnrealLiveLink_UpdateLightFrame;
+	Interface.CreateProvider = &UnrealLiveLink_CreateProvider;
+	Interface.DestroyProvider = &UnrealLiveLink_DestroyProvider;
+	Interface.StartProvider = &UnrealLiveLink_StartProvider;
+	Interface.StopProvider = &UnrealLiveLink_StopProvider;
+	Interface.RegisterProviderConnectionUpdateCallback = &UnrealLiveLink_RegisterProviderConnectionUpdateCallback;
+	Interface.ProviderHasConnection = &UnrealLiveLink_ProviderHasConnection;
+	Interface.ProviderGetStaticDataStats = &UnrealLiveLink_ProviderGetStaticDataStats;
+	Interface.ProviderSetBasicStructure = &UnrealLiveLink_ProviderSetBasicStructure;
+	Interface.ProviderUpdateBasicFrame = &UnrealLiveLink_ProviderUpdateBasicFrame;
+	Interface.ProviderSetAnimationStructure = &UnrealLiveLink_ProviderSetAnimationStructure;
+	Interface.ProviderUpdateAnimationFrame = &UnrealLiveLink_ProviderUpdateAnimationFrame;
+	Interface.ProviderUpdateAnimationFrames = &UnrealLiveLink_ProviderUpdateAnimationFrames;
+	Interface.RegisterSkeletonTemplate = &UnrealLiveLink_RegisterSkeletonTemplate;
+	Interface.UnregisterSkeletonTemplate = &UnrealLiveLink_UnregisterSkeletonTemplate;
+	Interface.ProviderSetAnimationStructureFromTemplate = &UnrealLiveLink_ProviderSetAnimationStructureFromTemplate;
+	Interface.ProviderSetAnimationTransformSpace = &UnrealLiveLink_ProviderSetAnimationTransformSpace;
+	Interface.ProviderSetRotationOrder = &UnrealLiveLink_ProviderSetRotationOrder;
+	Interface.ProviderSetValidation = &UnrealLiveLink_ProviderSetValidation;
+	Interface.ProviderGetValidationStats = &UnrealLiveLink_ProviderGetValidationStats;
+	Interface.ProviderSetFilter = &UnrealLiveLink_ProviderSetFilter;
+	Interface.ProviderSetResampling = &UnrealLiveLink_ProviderSetResampling;
+	Interface.ProviderSetExtrapolation = &UnrealLiveLink_ProviderSetExtrapolation;
+	Interface.ProviderGetExtrapolationStats = &UnrealLiveLink_ProviderGetExtrapolationStats;
+	Interface.ProviderUpdateTransformFrameMatrix = &UnrealLiveLink_ProviderUpdateTransformFrameMatrix;
+	Interface.ProviderUpdateAnimationFrameMatrices = &UnrealLiveLink_ProviderUpdateAnimationFrameMatrices;
+	Interface.ProviderUpdateCameraFrameMatrix = &UnrealLiveLink_ProviderUpdateCameraFrameMatrix;
+	Interface.ProviderUpdateLightFrameMatrix = &UnrealLiveLink_ProviderUpdateLightFrameMatrix;
+	Interface.ProviderSetBasicStructurePacked = &UnrealLiveLink_ProviderSetBasicStructurePacked;
+	Interface.ProviderUpdateBasicFramePacked = &UnrealLiveLink_ProviderUpdateBasicFramePacked;
+	Interface.ProviderSetAnimationStructurePacked = &UnrealLiveLink_ProviderSetAnimationStructurePacked;
+	Interface.ProviderUpdateAnimationFramePacked = &UnrealLiveLink_ProviderUpdateAnimationFramePacked;
+	Interface.ProviderGetSkeletonSetupStats = &UnrealLiveLink_ProviderGetSkeletonSetupStats;
+	Interface.ProviderSetTransformStructure = &UnrealLiveLink_ProviderSetTransformStructure;
+	Interface.ProviderUpdateTransformFrame = &UnrealLiveLink_ProviderUpdateTransformFrame;
+	Interface.ProviderSetCameraStructure = &UnrealLiveLink_ProviderSetCameraStructure;
+	Interface.ProviderUpdateCameraFrame = &UnrealLiveLink_ProviderUpdateCameraFrame;
+	Interface.ProviderSetLightStructure = &UnrealLiveLink_ProviderSetLightStructure;
+	Interface.ProviderUpdateLightFrame = &UnrealLiveLink_ProviderUpdateLightFrame;
+	Interface.SetTransportSettings = &UnrealLiveLink_SetTransportSettings;
+	Interface.GetTransportSettings = &UnrealLiveLink_GetTransportSettings;
+	Interface.SetTickerRate = &UnrealLiveLink_SetTickerRate;
+	Interface.Pump = &UnrealLiveLink_Pump;
+	Interface.GetTickerStats = &UnrealLiveLink_GetTickerStats;
+	Interface.ProviderGetConnectionStats = &UnrealLiveLink_ProviderGetConnectionStats;
+	Interface.ProviderSetClock = &UnrealLiveLink_ProviderSetClock;
+	Interface.ProviderGetClockStats = &UnrealLiveLink_ProviderGetClockStats;
+	Interface.CreateSkeletonMap = &UnrealLiveLink_CreateSkeletonMap;
+	Interface.DestroySkeletonMap = &UnrealLiveLink_DestroySkeletonMap;
+	Interface.ProviderUpdateAnimationFrameMapped = &UnrealLiveLink_ProviderUpdateAnimationFrameMapped;
+	Interface.ProviderUpdateBasicFrameSparse = &UnrealLiveLink_ProviderUpdateBasicFrameSparse;
+	Interface.ProviderUpdateAnimationFrameSparse = &UnrealLiveLink_ProviderUpdateAnimationFrameSparse;
+
+	return Interface;
+}
+
+const UnrealLiveLink_Interface *UnrealLiveLink_GetInterface(int Version)
+{
+	// the table is only appended to, a newer client reads our size and an older one the prefix it knows
+	if (Version < UNREAL_LIVE_LINK_INTERFACE_API_VERSION)
+	{
+		return nullptr;
+	}
+
+	static const UnrealLiveLink_Interface Interface = MakeInterface();
+	return &Interface;
+}
+
+void UnrealLiveLink_SetProviderName(const char* ProviderName)
+{
+	if (TSharedPtr<FUnrealLiveLinkCInterfaceProvider> Provider = FindProvider(UNREAL_LIVE_LINK_DEFAULT_PROVIDER))
+	{
+		Provider->SetProviderName(ANSI_TO_TCHAR(ProviderName));
+	}
+}
+
+int UnrealLiveLink_StartLiveLink()
+{
+	return UnrealLiveLink_StartProvider(UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+}
+
+int UnrealLiveLink_StopLiveLink()
+{
+	return UnrealLiveLink_StopProvider(UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+}
+
+int UnrealLiveLink_CreateProvider(const char *ProviderName)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> Provider = MakeShared<FUnrealLiveLinkCInterfaceProvider>(ANSI_TO_TCHAR(ProviderName));
+
+	FWriteScopeLock Lock(ProvidersLock);
+	const int Handle = NextProviderHandle++;
+	Providers.Add(Handle, Provider);
+	return Handle;
+}
+
+int UnrealLiveLink_DestroyProvider(int Provider)
+{
+	if (Provider == UNREAL_LIVE_LINK_DEFAULT_PROVIDER)
+	{
+		return UNREAL_LIVE_LINK_FAILED;
+	}
+
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> Removed;
+	{
+		FWriteScopeLock Lock(ProvidersLock);
+		if (!Providers.RemoveAndCopyValue(Provider, Removed))
+		{
+			return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+		}
+	}
+
+	return Removed->Stop();
+}
+
+int UnrealLiveLink_StartProvider(int Provider)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	return LiveLinkProvider.IsValid() ? LiveLinkProvider->Start() : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+int UnrealLiveLink_StopProvider(int Provider)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	return LiveLinkProvider.IsValid() ? LiveLinkProvider->Stop() : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static FString GetUnicastEndpoint() 
+{
+	if (IModularFeatures::Get().IsModularFeatureAvailable(INetworkMessagingExtension::ModularFeatureName))
+	{
+		UUdpMessagingSettings* Settings = GetMutableDefault<UUdpMessagingSettings>();
+		return Settings->UnicastEndpoint;
+	}
+
+	return TEXT("0.0.0.0:0");
+}
+
+// apply Edit to the UdpMessaging settings with a single restart of the transport
+static int RestartMessaging(TFunctionRef<void(UUdpMessagingSettings &)> Edit)
+{
+	if (!IModularFeatures::Get().IsModularFeatureAvailable(INetworkMessagingExtension::ModularFeatureName))
+	{
+		return UNREAL_LIVE_LINK_FAILED;
+	}
+
+	// every running provider sits on the same message bus so all of them restart
+	TArray<TSharedPtr<FUnrealLiveLinkCInterfaceProvider>> Started = GetAllProviders().FilterByPredicate(
+		[](const TSharedPtr<FUnrealLiveLinkCInterfaceProvider> &Provider) { return Provider->IsStarted(); });
+
+	for (const TSharedPtr<FUnrealLiveLinkCInterfaceProvider> &Provider : Started)
+	{
+		Provider->Stop();
+	}
+
+	Edit(*GetMutableDefault<UUdpMessagingSettings>());
+	INetworkMessagingExtension& NetworkExtension = IModularFeatures::Get().GetModularFeature<INetworkMessagingExtension>(INetworkMessagingExtension::ModularFeatureName);
+	NetworkExtension.RestartServices();
+
+	for (const TSharedPtr<FUnrealLiveLinkCInterfaceProvider> &Provider : Started)
+	{
+		Provider->Start();
+	}
+
+	return UNREAL_LIVE_LINK_OK;
+}
+
+void UnrealLiveLink_SetUnicastEndpoint(const char * InEndpoint)
+{
+	if (InEndpoint != GetUnicastEndpoint())
+	{
+		RestartMessaging([InEndpoint](UUdpMessagingSettings &Settings) { Settings.UnicastEndpoint = InEndpoint; });
+	}
+}
+
+int UnrealLiveLink_SetTransportSettings(const UnrealLiveLink_TransportSettings *TransportSettings)
+{
+	if (!TransportSettings)
+	{
+		return UNREAL_LIVE_LINK_FAILED;
+	}
+
+	return RestartMessaging([TransportSettings](UUdpMessagingSettings &Settings)
+	{
+		if (TransportSettings->unicastEndpoint[0] != '\0')
+		{
+			Settings.UnicastEndpoint = ANSI_TO_TCHAR(TransportSettings->unicastEndpoint);
+		}
+		if (TransportSettings->multicastEndpoint[0] != '\0')
+		{
+			Settings.MulticastEndpoint = ANSI_TO_TCHAR(TransportSettings->multicastEndpoint);
+		}
+		if (TransportSettings->multicastTimeToLive > 0)
+		{
+			Settings.MulticastTimeToLive = static_cast<uint8>(FMath::Min(TransportSettings->multicastTimeToLive, 255));
+		}
+		if (TransportSettings->workQueueSize > 0)
+		{
+			Settings.WorkQueueSize = TransportSettings->workQueueSize;
+		}
+		if (TransportSettings->maxSendRate > 0.0f)
+		{
+			Settings.MaxSendRate = TransportSettings->maxSendRate;
+		}
+	});
+}
+
+int UnrealLiveLink_GetTransportSettings(UnrealLiveLink_TransportSettings *TransportSettings)
+{
+	if (!TransportSettings || !IModularFeatures::Get().IsModularFeatureAvailable(INetworkMessagingExtension::ModularFeatureName))
+	{
+		return UNREAL_LIVE_LINK_FAILED;
+	}
+
+	const UUdpMessagingSettings *Settings = GetDefault<UUdpMessagingSettings>();
+	FCStringAnsi::Strncpy(TransportSettings->unicastEndpoint, TCHAR_TO_ANSI(*Settings->UnicastEndpoint), UNREAL_LIVE_LINK_MAX_NAME_LENGTH);
+	FCStringAnsi::Strncpy(TransportSettings->multicastEndpoint, TCHAR_TO_ANSI(*Settings->MulticastEndpoint), UNREAL_LIVE_LINK_MAX_NAME_LENGTH);
+	TransportSettings->multicastTimeToLive = Settings->MulticastTimeToLive;
+	TransportSettings->workQueueSize = Settings->WorkQueueSize;
+	TransportSettings->maxSendRate = Settings->MaxSendRate;
+	return UNREAL_LIVE_LINK_OK;
+}
+
+int UnrealLiveLink_AddStaticEndpoint(const char * InEndpoint)
+{
+	if (IModularFeatures::Get().IsModularFeatureAvailable(INetworkMessagingExtension::ModularFeatureName))
+	{
+		INetworkMessagingExtension& NetworkExtension = IModularFeatures::Get().GetModularFeature<INetworkMessagingExtension>(INetworkMessagingExtension::ModularFeatureName);
+		NetworkExtension.AddEndpoint(InEndpoint);
+		return UNREAL_LIVE_LINK_OK;
+	}
+	return UNREAL_LIVE_LINK_FAILED;
+}
+
+int UnrealLiveLink_RemoveStaticEndpoint(const char * InEndpoint)
+{
+	if (IModularFeatures::Get().IsModularFeatureAvailable(INetworkMessagingExtension::ModularFeatureName))
+	{
+		INetworkMessagingExtension& NetworkExtension = IModularFeatures::Get().GetModularFeature<INetworkMessagingExtension>(INetworkMessagingExtension::ModularFeatureName);
+		NetworkExtension.RemoveEndpoint(InEndpoint);
+		return UNREAL_LIVE_LINK_OK;
+	}
+	return UNREAL_LIVE_LINK_FAILED;
+}
+
+
+void UnrealLiveLink_RegisterConnectionUpdateCallback(void (*Callback)())
+{
+	UnrealLiveLink_RegisterProviderConnectionUpdateCallback(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, Callback);
+}
+
+int UnrealLiveLink_HasConnection()
+{
+	return UnrealLiveLink_ProviderHasConnection(UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+}
+
+int UnrealLiveLink_SetTickerRate(double Rate)
+{
+	UnrealLiveLink_SetCoreTickerRate(Rate);
+	return UNREAL_LIVE_LINK_OK;
+}
+
+int UnrealLiveLink_Pump()
+{
+	UnrealLiveLink_TickCoreTicker();
+	return UNREAL_LIVE_LINK_OK;
+}
+
+int UnrealLiveLink_GetTickerStats(UnrealLiveLink_TickerStats *Stats)
+{
+	if (!Stats)
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	UnrealLiveLink_GetCoreTickerStats(*Stats);
+	return UNREAL_LIVE_LINK_OK;
+}
+
+int UnrealLiveLink_RegisterProviderConnectionUpdateCallback(int Provider, void (*Callback)())
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	LiveLinkProvider->RegisterConnectionCallback(Callback);
+	return UNREAL_LIVE_LINK_OK;
+}
+
+int UnrealLiveLink_ProviderHasConnection(int Provider)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	return LiveLinkProvider->HasConnection() ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_NOT_CONNECTED;
+}
+
+int UnrealLiveLink_ProviderGetConnectionStats(int Provider, UnrealLiveLink_ConnectionStats *Stats)
+{
+	if (!Stats)
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	LiveLinkProvider->GetConnectionStats(*Stats);
+	return UNREAL_LIVE_LINK_OK;
+}
+
+
+static void SetFrameTimecode(const UnrealLiveLink_Timecode &InTimecode, FLiveLinkBaseFrameData &BaseData)
+{
+	// set sceneTime
+	bool DropFrame = InTimecode.format == UNREAL_LIVE_LINK_TIMECODE_29_97_DF || InTimecode.format == UNREAL_LIVE_LINK_TIMECODE_59_94_DF;
+	FTimecode Timecode(InTimecode.hours, InTimecode.minutes, InTimecode.seconds, InTimecode.frames, DropFrame);
+
+	int32_t Nom = TimecodeRates[InTimecode.format][0];
+	int32_t Denom = TimecodeRates[InTimecode.format][1];
+
+	FQualifiedFrameTime FrameTime(Timecode, FFrameRate(Nom, Denom));
+	BaseData.MetaData.SceneTime = FrameTime;
+}
+
+static void SetFrameMetadata(const UnrealLiveLink_Metadata *Metadata, FLiveLinkBaseFrameData &BaseData)
+{
+	for (int Idx = 0; Idx < Metadata->keyValueCount; Idx++)
+	{
+		BaseData.MetaData.StringMetaData.Add(Metadata->keyValues[Idx].name, Metadata->keyValues[Idx].value);
+	}
+
+	SetFrameTimecode(Metadata->timecode, BaseData);
+}
+
+static void SetFrameMetadata(const UnrealLiveLink_PackedMetadata *Metadata, FLiveLinkBaseFrameData &BaseData)
+{
+	const int Count = FMath::Min(Metadata->keys.count, Metadata->values.count);
+	BaseData.MetaData.StringMetaData.Reserve(Count);
+	for (int Idx = 0; Idx < Count; Idx++)
+	{
+		BaseData.MetaData.StringMetaData.Add(GetPackedName(Metadata->keys, Idx), GetPackedString(Metadata->values, Idx));
+	}
+
+	SetFrameTimecode(Metadata->timecode, BaseData);
+}
+
+// MetadataType is UnrealLiveLink_Metadata or UnrealLiveLink_PackedMetadata
+template <typename MetadataType>
+static void SetBasicFrameParameters(const char *SubjectName, const double WorldTime,
+	const MetadataType *Metadata, const UnrealLiveLink_PropertyValues *PropValues, FLiveLinkFrameDataStruct &FrameData)
+{
+	FLiveLinkBaseFrameData& BaseData = *FrameData.Cast<FLiveLinkBaseFrameData>();
+
+	BaseData.WorldTime = WorldTime;
+	
+	if (PropValues && PropValues->valueCount > 0)
+	{
+		// single copy, facial rigs and simulation caches send thousands of values per frame
+		BaseData.PropertyValues.SetNumUninitialized(PropValues->valueCount);
+		FMemory::Memcpy(BaseData.PropertyValues.GetData(), PropValues->values, PropValues->valueCount * sizeof(float));
+	}
+
+	if (Metadata)
+	{
+		SetFrameMetadata(Metadata, BaseData);
+	}
+}
+
+
+// PropertiesType is UnrealLiveLink_Properties or UnrealLiveLink_PackedStrings
+template <typename PropertiesType>
+static int SetBasicStructure(int Provider, const char *SubjectName, const PropertiesType *Properties)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	const uint64 StaticDataHash = HashStaticData(ULiveLinkBasicRole::StaticClass(), Properties);
+	if (LiveLinkProvider->IsStaticDataCurrent(SubjectName, StaticDataHash))
+	{
+		return UNREAL_LIVE_LINK_OK;
+	}
+
+	FLiveLinkStaticDataStruct StaticData(FLiveLinkBaseStaticData::StaticStruct());
+	FLiveLinkBaseStaticData& BaseData = *StaticData.Cast<FLiveLinkBaseStaticData>();
+	AddPropertyNames(Properties, BaseData.PropertyNames);
+
+	return LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkBasicRole::StaticClass(), StaticDataHash, MoveTemp(StaticData)) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_FAILED;
+}
+
+int UnrealLiveLink_ProviderSetBasicStructure(int Provider, const char *SubjectName, const UnrealLiveLink_Properties *Properties)
+{
+	return SetBasicStructure(Provider, SubjectName, Properties);
+}
+
+int UnrealLiveLink_ProviderSetBasicStructurePacked(int Provider, const char *SubjectName, const UnrealLiveLink_PackedStrings *PropertyNames)
+{
+	return SetBasicStructure(Provider, SubjectName, PropertyNames);
+}
+
+void UnrealLiveLink_SetBasicStructure(const char *SubjectName, const UnrealLiveLink_Properties *Properties)
+{
+	UnrealLiveLink_ProviderSetBasicStructure(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, SubjectName, Properties);
+}
+
+template <typename MetadataType>
+static int UpdateBasicFrame(int Provider, const char *SubjectName, const double WorldTime,
+	const MetadataType *Metadata, const UnrealLiveLink_PropertyValues *PropValues)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	FLiveLinkFrameDataStruct FrameData(FLiveLinkBaseFrameData::StaticStruct());
+
+	SetBasicFrameParameters(SubjectName, WorldTime, Metadata, PropValues, FrameData);
+
+	return LiveLinkProvider->UpdateSubjectFrameData(SubjectName, MoveTemp(FrameData)) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_FAILED;
+}
+
+int UnrealLiveLink_ProviderUpdateBasicFrame(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues)
+{
+	return UpdateBasicFrame(Provider, SubjectName, WorldTime, Metadata, PropValues);
+}
+
+int UnrealLiveLink_ProviderUpdateBasicFramePacked(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_PackedMetadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues)
+{
+	return UpdateBasicFrame(Provider, SubjectName, WorldTime, Metadata, PropValues);
+}
+
+void UnrealLiveLink_UpdateBasicFrame(const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues)
+{
+	UnrealLiveLink_ProviderUpdateBasicFrame(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, SubjectName, WorldTime, Metadata, PropValues);
+}
+
+
+static void SetAnimationTransforms(const UnrealLiveLink_Animation *Frame, const FUnrealLiveLinkCInterfaceSubjectSettings &Settings, TArray<FTransform> &Transforms)
+{
+	Transforms.SetNum(Frame->transformCount);
+	for (int Idx = 0; Idx < Frame->transformCount; Idx++)
+	{
+		SetFTransform(Transforms[Idx], Frame->transforms[Idx], Settings);
+	}
+}
+
+static void SetAnimationTransforms(const UnrealLiveLink_AnimationMatrices *Frame, const FUnrealLiveLinkCInterfaceSubjectSettings &Settings, TArray<FTransform> &Transforms)
+{
+	ConvertMatricesToTransforms(Frame->matrices, Frame->matrixCount, Transforms);
+}
+
+// a frame in source joint order and the skeleton map to gather it into bone order with
+struct FMappedAnimation
+{
+	const UnrealLiveLink_Animation *Frame;
+	const FSkeletonMap *Map;
+};
+
+static void SetAnimationTransforms(const FMappedAnimation *Mapped, const FUnrealLiveLinkCInterfaceSubjectSettings &Settings, TArray<FTransform> &Transforms)
+{
+	const TArray<int32> &SourceIndices = Mapped->Map->SourceIndices;
+
+	Transforms.SetNum(SourceIndices.Num());
+	for (int32 Idx = 0; Idx < SourceIndices.Num(); Idx++)
+	{
+		if (SourceIndices[Idx] == INDEX_NONE)
+		{
+			Transforms[Idx] = FTransform::Identity;
+		}
+		else
+		{
+			SetFTransform(Transforms[Idx], Mapped->Frame->transforms[SourceIndices[Idx]], Settings);
+		}
+	}
+}
+
+// FrameType is any of the animation input formats accepted by SetAnimationTransforms
+template <typename MetadataType, typename FrameType>
+static bool SetAnimationFrameParameters(const char *SubjectName, const double WorldTime,
+	const MetadataType *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
+	const FrameType *Frame, const FUnrealLiveLinkCInterfaceSubjectSettings &Settings, FLiveLinkFrameDataStruct &FrameData)
+{
+	FLiveLinkAnimationFrameData& AnimData = *FrameData.Cast<FLiveLinkAnimationFrameData>();
+
+	SetAnimationTransforms(Frame, Settings, AnimData.Transforms);
+
+	if (Settings.bWorldSpaceTransforms)
+	{
+		if (AnimData.Transforms.Num() != Settings.BoneParents.Num())
+		{
+			return false;
+		}
+
+		ConvertWorldToLocalTransforms(AnimData.Transforms, Settings.BoneParents);
+	}
+
+	SetBasicFrameParameters(SubjectName, WorldTime, Metadata, PropValues, FrameData);
+
+	return true;
+}
+
+// store the bone parents of an animation subject, rejected if world space input needs ordered parents they don't have
+static bool SetSubjectBoneParents(FUnrealLiveLinkCInterfaceProvider &LiveLinkProvider, const char *SubjectName, const TArray<int32> &BoneParents)
+{
+	return LiveLinkProvider.UpdateSubjectSettings(SubjectName, [&BoneParents](FUnrealLiveLinkCInterfaceSubjectSettings &Settings)
+	{
+		if (Settings.bWorldSpaceTransforms && !AreBoneParentsOrdered(BoneParents))
+		{
+			UE_LOG(LogUnrealLiveLinkCInterface, Warning, TEXT("World space animation input requires parents before children"));
+			return false;
+		}
+
+		Settings.BoneParents = BoneParents;
+		return true;
+	});
+}
+
+static void SetSkeletonBones(const UnrealLiveLink_AnimationStatic *AnimStructure, FLiveLinkSkeletonStaticData &AnimData)
+{
+	TArray<FName> Names;
+	InternNames(AnimStructure->boneCount, [AnimStructure](int32 Idx) { return FName(AnimStructure->bones[Idx].name); }, Names);
+
+	TArray<int32> Indices;
+	Indices.SetNumUninitialized(AnimStructure->boneCount);
+	for (int Idx = 0; Idx < AnimStructure->boneCount; Idx++)
+	{
+		Indices[Idx] = AnimStructure->bones[Idx].parentIndex;
+	}
+
+	AnimData.SetBoneNames(Names);
+	AnimData.SetBoneParents(Indices);
+}
+
+static void SetSkeletonBones(const UnrealLiveLink_PackedAnimationStatic *AnimStructure, FLiveLinkSkeletonStaticData &AnimData)
+{
+	TArray<FName> Names;
+	InternNames(AnimStructure->boneNames.count, [AnimStructure](int32 Idx) { return GetPackedName(AnimStructure->boneNames, Idx); }, Names);
+
+	AnimData.SetBoneNames(Names);
+	AnimData.SetBoneParents(TArray<int32>(AnimStructure->parentIndices, AnimStructure->boneNames.count));
+}
+
+template <typename PropertiesType, typename AnimStructureType>
+static void SetSkeletonStaticData(
+	const PropertiesType *Properties, const AnimStructureType *AnimStructure, FLiveLinkSkeletonStaticData &AnimData)
+{
+	AddPropertyNames(Properties, AnimData.PropertyNames);
+	SetSkeletonBones(AnimStructure, AnimData);
+}
+
+// PropertiesType and AnimStructureType are the fixed size or the packed input structures
+template <typename PropertiesType, typename AnimStructureType>
+static int SetAnimationStructure(int Provider,
+	const char *SubjectName, const PropertiesType *Properties, const AnimStructureType *AnimStructure)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	const uint64 StaticDataHash = HashSkeleton(AnimStructure, HashStaticData(ULiveLinkAnimationRole::StaticClass(), Properties));
+	if (LiveLinkProvider->IsStaticDataCurrent(SubjectName, StaticDataHash))
+	{
+		return UNREAL_LIVE_LINK_OK;
+	}
+
+	FLiveLinkStaticDataStruct StaticData(FLiveLinkSkeletonStaticData::StaticStruct());
+	FLiveLinkSkeletonStaticData& AnimData = *StaticData.Cast<FLiveLinkSkeletonStaticData>();
+
+	const double InternStartTime = FPlatformTime::Seconds();
+	SetSkeletonStaticData(Properties, AnimStructure, AnimData);
+	const double InternSeconds = FPlatformTime::Seconds() - InternStartTime;
+
+	if (!SetSubjectBoneParents(*LiveLinkProvider, SubjectName, AnimData.BoneParents))
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	UnrealLiveLink_SkeletonSetupStats Stats;
+	Stats.boneCount = AnimData.BoneNames.Num();
+	Stats.propertyCount = AnimData.PropertyNames.Num();
+	Stats.internSeconds = InternSeconds;
+
+	const bool bUpdated = LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkAnimationRole::StaticClass(), StaticDataHash, MoveTemp(StaticData));
+
+	Stats.totalSeconds = FPlatformTime::Seconds() - StartTime;
+	LiveLinkProvider->SetSkeletonSetupStats(Stats);
+
+	return bUpdated ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_FAILED;
+}
+
+int UnrealLiveLink_ProviderSetAnimationStructure(int Provider,
+	const char *SubjectName, const UnrealLiveLink_Properties *Properties, UnrealLiveLink_AnimationStatic *AnimStructure)
+{
+	return SetAnimationStructure(Provider, SubjectName, Properties, AnimStructure);
+}
+
+int UnrealLiveLink_ProviderSetAnimationStructurePacked(int Provider, const char *SubjectName,
+	const UnrealLiveLink_PackedStrings *PropertyNames, const UnrealLiveLink_PackedAnimationStatic *AnimStructure)
+{
+	return SetAnimationStructure(Provider, SubjectName, PropertyNames, AnimStructure);
+}
+
+void UnrealLiveLink_SetAnimationStructure(
+	const char *SubjectName, const UnrealLiveLink_Properties *Properties, UnrealLiveLink_AnimationStatic *AnimStructure)
+{
+	UnrealLiveLink_ProviderSetAnimationStructure(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, SubjectName, Properties, AnimStructure);
+}
+
+int UnrealLiveLink_ProviderSetAnimationTransformSpace(int Provider, const char *SubjectName, UnrealLiveLink_TransformSpace Space)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	const bool bWorldSpace = Space == UNREAL_LIVE_LINK_WORLD_SPACE;
+	const bool bUpdated = LiveLinkProvider->UpdateSubjectSettings(SubjectName, [bWorldSpace](FUnrealLiveLinkCInterfaceSubjectSettings &Settings)
+	{
+		if (bWorldSpace && !AreBoneParentsOrdered(Settings.BoneParents))
+		{
+			UE_LOG(LogUnrealLiveLinkCInterface, Warning, TEXT("World space animation input requires parents before children"));
+			return false;
+		}
+
+		Settings.bWorldSpaceTransforms = bWorldSpace;
+		return true;
+	});
+
+	return bUpdated ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+}
+
+int UnrealLiveLink_ProviderSetRotationOrder(int Provider, const char *SubjectName, UnrealLiveLink_RotationOrder Order, int IsRadians)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	if (Order < UNREAL_LIVE_LINK_ROTATION_QUATERNION || Order > UNREAL_LIVE_LINK_ROTATION_EULER_ZYX)
+	{
+		return UNREAL_LIVE_LINK_FAILED;
+	}
+
+	LiveLinkProvider->UpdateSubjectSettings(SubjectName, [Order, IsRadians](FUnrealLiveLinkCInterfaceSubjectSettings &Settings)
+	{
+		Settings.RotationOrder = Order;
+		Settings.bRadians = IsRadians != 0;
+		return true;
+	});
+
+	return UNREAL_LIVE_LINK_OK;
+}
+
+int UnrealLiveLink_ProviderSetValidation(int Provider, const char *SubjectName, UnrealLiveLink_ValidationMode Mode, float MaxAbsValue)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	if (Mode < UNREAL_LIVE_LINK_VALIDATION_OFF || Mode > UNREAL_LIVE_LINK_VALIDATION_REJECT)
+	{
+		return UNREAL_LIVE_LINK_FAILED;
+	}
+
+	LiveLinkProvider->UpdateSubjectSettings(SubjectName, [Mode, MaxAbsValue](FUnrealLiveLinkCInterfaceSubjectSettings &Settings)
+	{
+		Settings.ValidationMode = Mode;
+		Settings.MaxAbsValue = MaxAbsValue;
+		return true;
+	});
+
+	return UNREAL_LIVE_LINK_OK;
+}
+
+int UnrealLiveLink_ProviderGetValidationStats(int Provider, UnrealLiveLink_ValidationStats *Stats)
+{
+	if (!Stats)
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	LiveLinkProvider->GetValidationStats(*Stats);
+	return UNREAL_LIVE_LINK_OK;
+}
+
+int UnrealLiveLink_ProviderSetFilter(int Provider, const char *SubjectName, UnrealLiveLink_FilterChannel Channel,
+	const UnrealLiveLink_FilterSettings *Settings)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	if (Channel < UNREAL_LIVE_LINK_FILTER_TRANSLATION || Channel >= UNREAL_LIVE_LINK_FILTER_CHANNEL_COUNT)
+	{
+		return UNREAL_LIVE_LINK_FAILED;
+	}
+
+	UnrealLiveLink_FilterSettings Filter = {};
+	if (Settings)
+	{
+		Filter = *Settings;
+	}
+
+	LiveLinkProvider->UpdateSubjectSettings(SubjectName, [Channel, &Filter](FUnrealLiveLinkCInterfaceSubjectSettings &SubjectSettings)
+	{
+		SubjectSettings.Filters[Channel] = Filter;
+
+		SubjectSettings.bFiltered = false;
+		for (const UnrealLiveLink_FilterSettings &ChannelFilter : SubjectSettings.Filters)
+		{
+			SubjectSettings.bFiltered |= ChannelFilter.minCutoff > 0.0f;
+		}
+		return true;
+	});
+
+	return UNREAL_LIVE_LINK_OK;
+}
+
+int UnrealLiveLink_ProviderSetResampling(int Provider, const char *SubjectName, double OutputRate, double Delay)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	if (OutputRate < 0.0 || Delay < 0.0)
+	{
+		return UNREAL_LIVE_LINK_FAILED;
+	}
+
+	LiveLinkProvider->UpdateSubjectSettings(SubjectName, [OutputRate, Delay](FUnrealLiveLinkCInterfaceSubjectSettings &Settings)
+	{
+		Settings.OutputRate = OutputRate;
+		Settings.ResampleDelay = Delay;
+		return true;
+	});
+
+	return UNREAL_LIVE_LINK_OK;
+}
+
+int UnrealLiveLink_ProviderSetExtrapolation(int Provider, const char *SubjectName, const UnrealLiveLink_ExtrapolationSettings *Settings)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	UnrealLiveLink_ExtrapolationSettings Extrapolation = {};
+	if (Settings)
+	{
+		Extrapolation = *Settings;
+	}
+
+	LiveLinkProvider->UpdateSubjectSettings(SubjectName, [&Extrapolation](FUnrealLiveLinkCInterfaceSubjectSettings &SubjectSettings)
+	{
+		SubjectSettings.Extrapolation = Extrapolation;
+		return true;
+	});
+
+	return UNREAL_LIVE_LINK_OK;
+}
+
+int UnrealLiveLink_ProviderSetClock(int Provider, const UnrealLiveLink_ClockSettings *Settings)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	UnrealLiveLink_ClockSettings ClockSettings = {};
+	if (Settings)
+	{
+		ClockSettings = *Settings;
+	}
+
+	LiveLinkProvider->SetClockSettings(ClockSettings);
+	return UNREAL_LIVE_LINK_OK;
+}
+
+int UnrealLiveLink_ProviderGetClockStats(int Provider, UnrealLiveLink_ClockStats *Stats)
+{
+	if (!Stats)
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	LiveLinkProvider->GetClockStats(*Stats);
+	return UNREAL_LIVE_LINK_OK;
+}
+
+int UnrealLiveLink_ProviderGetExtrapolationStats(int Provider, UnrealLiveLink_ExtrapolationStats *Stats)
+{
+	if (!Stats)
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	LiveLinkProvider->GetExtrapolationStats(*Stats);
+	return UNREAL_LIVE_LINK_OK;
+}
+
+int UnrealLiveLink_ProviderGetSkeletonSetupStats(int Provider, UnrealLiveLink_SkeletonSetupStats *Stats)
+{
+	if (!Stats)
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	LiveLinkProvider->GetSkeletonSetupStats(*Stats);
+	return UNREAL_LIVE_LINK_OK;
+}
+
+int UnrealLiveLink_ProviderGetStaticDataStats(int Provider, UnrealLiveLink_StaticDataStats *Stats)
+{
+	if (!Stats)
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	uint64 AppliedCount = 0;
+	uint64 SkippedCount = 0;
+	LiveLinkProvider->GetStaticDataStats(AppliedCount, SkippedCount);
+
+	Stats->appliedCount = AppliedCount;
+	Stats->skippedCount = SkippedCount;
+	return UNREAL_LIVE_LINK_OK;
+}
+
+int UnrealLiveLink_RegisterSkeletonTemplate(const UnrealLiveLink_Properties *Properties, const UnrealLiveLink_AnimationStatic *AnimStructure)
+{
+	if (!AnimStructure)
+	{
+		return UNREAL_LIVE_LINK_NO_HANDLE;
+	}
+
+	// names are interned once here, subjects created from the template only copy the FName arrays
+	TSharedRef<FSkeletonTemplate> Template = MakeShared<FSkeletonTemplate>();
+	SetSkeletonStaticData(Properties, AnimStructure, Template->StaticData);
+	Template->StaticDataHash = HashSkeleton(AnimStructure, HashStaticData(ULiveLinkAnimationRole::StaticClass(), Properties));
+
+	FWriteScopeLock Lock(SkeletonTemplatesLock);
+	const int Handle = NextSkeletonTemplateHandle++;
+	SkeletonTemplates.Add(Handle, Template);
+	return Handle;
+}
+
+int UnrealLiveLink_UnregisterSkeletonTemplate(int SkeletonTemplate)
+{
+	FWriteScopeLock Lock(SkeletonTemplatesLock);
+	return SkeletonTemplates.Remove(SkeletonTemplate) > 0 ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_HANDLE;
+}
+
+int UnrealLiveLink_ProviderSetAnimationStructureFromTemplate(int Provider, const char *SubjectName, int SkeletonTemplate)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	TSharedPtr<const FSkeletonTemplate> Template;
+	{
+		FReadScopeLock Lock(SkeletonTemplatesLock);
+		if (const TSharedRef<const FSkeletonTemplate> *Found = SkeletonTemplates.Find(SkeletonTemplate))
+		{
+			Template = *Found;
+		}
+	}
+	if (!Template.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_HANDLE;
+	}
+
+	if (LiveLinkProvider->IsStaticDataCurrent(SubjectName, Template->StaticDataHash))
+	{
+		return UNREAL_LIVE_LINK_OK;
+	}
+
+	if (!SetSubjectBoneParents(*LiveLinkProvider, SubjectName, Template->StaticData.BoneParents))
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	FLiveLinkStaticDataStruct StaticData(FLiveLinkSkeletonStaticData::StaticStruct());
+	*StaticData.Cast<FLiveLinkSkeletonStaticData>() = Template->StaticData;
+
+	return LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkAnimationRole::StaticClass(), Template->StaticDataHash, MoveTemp(StaticData)) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_FAILED;
+}
+
+int UnrealLiveLink_CreateSkeletonMap(const UnrealLiveLink_Properties *SourceNames, const UnrealLiveLink_AnimationStatic *AnimStructure)
+{
+	if (!SourceNames || !AnimStructure)
+	{
+		return UNREAL_LIVE_LINK_NO_HANDLE;
+	}
+
+	// the first of any duplicate source names is used
+	TMap<FName, int32> SourceIndexByName;
+	SourceIndexByName.Reserve(SourceNames->nameCount);
+	for (int Idx = 0; Idx < SourceNames->nameCount; Idx++)
+	{
+		SourceIndexByName.FindOrAdd(FName(SourceNames->names[Idx]), Idx);
+	}
+
+	TSharedRef<FSkeletonMap> Map = MakeShared<FSkeletonMap>();
+	Map->SourceIndices.SetNumUninitialized(AnimStructure->boneCount);
+	for (int Idx = 0; Idx < AnimStructure->boneCount; Idx++)
+	{
+		const int32 *SourceIndex = SourceIndexByName.Find(FName(AnimStructure->bones[Idx].name));
+		Map->SourceIndices[Idx] = SourceIndex ? *SourceIndex : INDEX_NONE;
+		Map->SourceCount = FMath::Max(Map->SourceCount, Map->SourceIndices[Idx] + 1);
+	}
+
+	FWriteScopeLock Lock(SkeletonMapsLock);
+	const int Handle = NextSkeletonMapHandle++;
+	SkeletonMaps.Add(Handle, Map);
+	return Handle;
+}
+
+int UnrealLiveLink_DestroySkeletonMap(int SkeletonMap)
+{
+	FWriteScopeLock Lock(SkeletonMapsLock);
+	return SkeletonMaps.Remove(SkeletonMap) > 0 ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_HANDLE;
+}
+
+// FrameType is UnrealLiveLink_Animation or FMappedAnimation
+template <typename MetadataType, typename FrameType>
+static int UpdateAnimationFrame(int Provider, const char *SubjectName, const double WorldTime,
+	const MetadataType *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
+	const FrameType *Frame)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	FLiveLinkFrameDataStruct FrameData(FLiveLinkAnimationFrameData::StaticStruct());
+
+	if (!SetAnimationFrameParameters(SubjectName, WorldTime, Metadata, PropValues, Frame, *LiveLinkProvider->GetSubjectSettings(SubjectName), FrameData))
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+	
+	return LiveLinkProvider->UpdateSubjectFrameData(SubjectName, MoveTemp(FrameData)) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_FAILED;
+}
+
+int UnrealLiveLink_ProviderUpdateAnimationFrame(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
+	const UnrealLiveLink_Animation *Frame)
+{
+	return UpdateAnimationFrame(Provider, SubjectName, WorldTime, Metadata, PropValues, Frame);
+}
+
+int UnrealLiveLink_ProviderUpdateAnimationFramePacked(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_PackedMetadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
+	const UnrealLiveLink_Animation *Frame)
+{
+	return UpdateAnimationFrame(Provider, SubjectName, WorldTime, Metadata, PropValues, Frame);
+}
+
+void UnrealLiveLink_UpdateAnimationFrame(const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
+	const UnrealLiveLink_Animation *Frame)
+{
+	UnrealLiveLink_ProviderUpdateAnimationFrame(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, SubjectName, WorldTime, Metadata, PropValues, Frame);
+}
+
+int UnrealLiveLink_ProviderUpdateAnimationFrameMapped(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_PackedMetadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
+	int SkeletonMap, const UnrealLiveLink_Animation *Frame)
+{
+	// the map is held for the update so destroying it from another thread can't free it mid gather
+	TSharedPtr<const FSkeletonMap> Map;
+	{
+		FReadScopeLock Lock(SkeletonMapsLock);
+		if (const TSharedRef<const FSkeletonMap> *Found = SkeletonMaps.Find(SkeletonMap))
+		{
+			Map = *Found;
+		}
+	}
+	if (!Map.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_HANDLE;
+	}
+
+	if (Frame->transformCount < Map->SourceCount)
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	const FMappedAnimation Mapped = { Frame, Map.Get() };
+	return UpdateAnimationFrame(Provider, SubjectName, WorldTime, Metadata, PropValues, &Mapped);
+}
+
+// FrameStruct is the frame type of the subject's role, the values given are merged into its last frame by the provider
+static int UpdateFrameSparse(int Provider, const char *SubjectName, const double WorldTime, const UnrealLiveLink_PackedMetadata *Metadata,
+	const UnrealLiveLink_SparsePropertyValues *PropValues, const UnrealLiveLink_SparseTransforms *Transforms, UScriptStruct *FrameStruct)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	FSparseFrame Sparse;
+	if (PropValues && PropValues->count > 0)
+	{
+		Sparse.PropertyIndices = MakeArrayView(PropValues->indices, PropValues->count);
+		Sparse.PropertyValues = MakeArrayView(PropValues->values, PropValues->count);
+	}
+
+	if (Transforms && Transforms->count > 0)
+	{
+		// a world space bone moves the parent-local transforms of its children too, which the last frame can't give
+		TSharedRef<const FUnrealLiveLinkCInterfaceSubjectSettings> Settings = LiveLinkProvider->GetSubjectSettings(SubjectName);
+		if (Settings->bWorldSpaceTransforms)
+		{
+			return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+		}
+
+		Sparse.BoneIndices = MakeArrayView(Transforms->indices, Transforms->count);
+		Sparse.Transforms.SetNum(Transforms->count);
+		for (int Idx = 0; Idx < Transforms->count; Idx++)
+		{
+			SetFTransform(Sparse.Transforms[Idx], Transforms->transforms[Idx], *Settings);
+		}
+	}
+
+	FLiveLinkFrameDataStruct FrameData(FrameStruct);
+	SetBasicFrameParameters(SubjectName, WorldTime, Metadata, nullptr, FrameData);
+
+	return LiveLinkProvider->UpdateSubjectFrameSparse(SubjectName, Sparse, MoveTemp(FrameData));
+}
+
+int UnrealLiveLink_ProviderUpdateBasicFrameSparse(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_PackedMetadata *Metadata, const UnrealLiveLink_SparsePropertyValues *PropValues)
+{
+	return UpdateFrameSparse(Provider, SubjectName, WorldTime, Metadata, PropValues, nullptr, FLiveLinkBaseFrameData::StaticStruct());
+}
+
+int UnrealLiveLink_ProviderUpdateAnimationFrameSparse(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_PackedMetadata *Metadata, const UnrealLiveLink_SparsePropertyValues *PropValues,
+	const UnrealLiveLink_SparseTransforms *Frame)
+{
+	return UpdateFrameSparse(Provider, SubjectName, WorldTime, Metadata, PropValues, Frame, FLiveLinkAnimationFrameData::StaticStruct());
+}
+
+int UnrealLiveLink_ProviderUpdateAnimationFrameMatrices(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues, const UnrealLiveLink_AnimationMatrices *Frame)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	FLiveLinkFrameDataStruct FrameData(FLiveLinkAnimationFrameData::StaticStruct());
+
+	if (!SetAnimationFrameParameters(SubjectName, WorldTime, Metadata, PropValues, Frame, *LiveLinkProvider->GetSubjectSettings(SubjectName), FrameData))
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	return LiveLinkProvider->UpdateSubjectFrameData(SubjectName, MoveTemp(FrameData)) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_FAILED;
+}
+
+int UnrealLiveLink_ProviderUpdateAnimationFrames(int Provider, const UnrealLiveLink_AnimationSubjectFrame *Frames, int FrameCount)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	if (FrameCount < 0 || (!Frames && FrameCount > 0))
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	// subjects are looked up (or added) before the workers start, adding a subject takes the provider's
+	// subject table write lock which would serialize them
+	TArray<TSharedPtr<const FUnrealLiveLinkCInterfaceSubjectSettings>> Settings;
+	Settings.SetNum(FrameCount);
+	for (int Idx = 0; Idx < FrameCount; Idx++)
+	{
+		if (Frames[Idx].subjectName && Frames[Idx].frame)
+		{
+			Settings[Idx] = LiveLinkProvider->GetSubjectSettings(Frames[Idx].subjectName);
+		}
+	}
+
+	// conversion and frame building are spread over the task graph workers,
+	// only the hand-off to the provider below is serial
+	TArray<FLiveLinkFrameDataStruct> FrameData;
+	FrameData.SetNum(FrameCount);
+	TArray<bool> FrameValid;
+	FrameValid.SetNum(FrameCount);
+
+	ParallelFor(FrameCount, [Frames, &Settings, &FrameData, &FrameValid](int32 Idx)
+	{
+		const UnrealLiveLink_AnimationSubjectFrame &Subject = Frames[Idx];
+
+		// entries without a subject name or frame have no settings
+		if (!Settings[Idx].IsValid())
+		{
+			FrameValid[Idx] = false;
+			return;
+		}
+
+		FrameData[Idx].InitializeWith(FLiveLinkAnimationFrameData::StaticStruct(), nullptr);
+		FrameValid[Idx] = SetAnimationFrameParameters(Subject.subjectName, Subject.worldTime, Subject.metadata, Subject.propValues, Subject.frame,
+			*Settings[Idx], FrameData[Idx]);
+	});
+
+	int Result = UNREAL_LIVE_LINK_OK;
+	for (int Idx = 0; Idx < FrameCount; Idx++)
+	{
+		if (!FrameValid[Idx])
+		{
+			Result = UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+		}
+		else if (!LiveLinkProvider->UpdateSubjectFrameData(Frames[Idx].subjectName, MoveTemp(FrameData[Idx])))
+		{
+			Result = UNREAL_LIVE_LINK_FAILED;
+		}
+	}
+
+	return Result;
+}
+
+
+int UnrealLiveLink_ProviderSetTransformStructure(int Provider, const char *SubjectName, const UnrealLiveLink_Properties *Properties)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	const uint64 StaticDataHash = HashStaticData(ULiveLinkTransformRole::StaticClass(), Properties);
+	if (LiveLinkProvider->IsStaticDataCurrent(SubjectName, StaticDataHash))
+	{
+		return UNREAL_LIVE_LINK_OK;
+	}
+
+	FLiveLinkStaticDataStruct StaticData(FLiveLinkTransformStaticData::StaticStruct());
+	FLiveLinkTransformStaticData& XformData = *StaticData.Cast<FLiveLinkTransformStaticData>();
+
+	AddPropertyNames(Properties, XformData.PropertyNames);
+
+	return LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkTransformRole::StaticClass(), StaticDataHash, MoveTemp(StaticData)) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_FAILED;
+}
+
+void UnrealLiveLink_SetTransformStructure(const char *SubjectName, const UnrealLiveLink_Properties *Properties)
+{
+	UnrealLiveLink_ProviderSetTransformStructure(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, SubjectName, Properties);
+}
+
+int UnrealLiveLink_ProviderUpdateTransformFrame(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
+	const UnrealLiveLink_Transform *Frame)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	FLiveLinkFrameDataStruct FrameData(FLiveLinkTransformFrameData::StaticStruct());
+	FLiveLinkTransformFrameData& XformData = *FrameData.Cast<FLiveLinkTransformFrameData>();
+
+	SetFTransform(XformData.Transform, *Frame, *LiveLinkProvider->GetSubjectSettings(SubjectName));
+
+	SetBasicFrameParameters(SubjectName, WorldTime, Metadata, PropValues, FrameData);
+	
+	return LiveLinkProvider->UpdateSubjectFrameData(SubjectName, MoveTemp(FrameData)) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_FAILED;
+}
+
+void UnrealLiveLink_UpdateTransformFrame(const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
+	const UnrealLiveLink_Transform *Frame)
+{
+	UnrealLiveLink_ProviderUpdateTransformFrame(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, SubjectName, WorldTime, Metadata, PropValues, Frame);
+}
+
+int UnrealLiveLink_ProviderUpdateTransformFrameMatrix(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues, const UnrealLiveLink_Matrix *Frame)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	FLiveLinkFrameDataStruct FrameData(FLiveLinkTransformFrameData::StaticStruct());
+	FLiveLinkTransformFrameData& XformData = *FrameData.Cast<FLiveLinkTransformFrameData>();
+
+	SetFTransformFromMatrix(XformData.Transform, *Frame);
+
+	SetBasicFrameParameters(SubjectName, WorldTime, Metadata, PropValues, FrameData);
+
+	return LiveLinkProvider->UpdateSubjectFrameData(SubjectName, MoveTemp(FrameData)) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_FAILED;
+}
+
+
+int UnrealLiveLink_ProviderSetCameraStructure(int Provider,
+	const char *SubjectName, const UnrealLiveLink_Properties *Properties, UnrealLiveLink_CameraStatic *CameraStructure)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	const uint64 StaticDataHash = HashStaticData(ULiveLinkCameraRole::StaticClass(), Properties, CameraStructure, sizeof(UnrealLiveLink_CameraStatic));
+	if (LiveLinkProvider->IsStaticDataCurrent(SubjectName, StaticDataHash))
+	{
+		return UNREAL_LIVE_LINK_OK;
+	}
+
+	FLiveLinkStaticDataStruct StaticData(FLiveLinkCameraStaticData::StaticStruct());
+	FLiveLinkCameraStaticData& CameraData = *StaticData.Cast<FLiveLinkCameraStaticData>();
+
+	AddPropertyNames(Properties, CameraData.PropertyNames);
+	if (CameraStructure)
+	{
+		CameraData.bIsFieldOfViewSupported = CameraStructure->isFieldOfViewSupported != 0;
+		CameraData.bIsAspectRatioSupported = CameraStructure->isAspectRatioSupported != 0;
+		CameraData.bIsFocalLengthSupported = CameraStructure->isFocalLengthSupported != 0;
+		CameraData.bIsProjectionModeSupported = CameraStructure->isProjectionModeSupported != 0;
+		CameraData.FilmBackWidth = CameraStructure->filmBackWidth;
+		CameraData.FilmBackHeight = CameraStructure->filmBackHeight;
+		CameraData.bIsApertureSupported = CameraStructure->isApertureSupported != 0;
+		CameraData.bIsFocusDistanceSupported = CameraStructure->isFocusDistanceSupported != 0;
+	}
+	return LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkCameraRole::StaticClass(), StaticDataHash, MoveTemp(StaticData)) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_FAILED;
+}
+
+void UnrealLiveLink_SetCameraStructure(
+	const char *SubjectName, const UnrealLiveLink_Properties *Properties, UnrealLiveLink_CameraStatic *CameraStructure)
+{
+	UnrealLiveLink_ProviderSetCameraStructure(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, SubjectName, Properties, CameraStructure);
+}
+
+// set the camera values other than the transform
+static void SetCameraFrameParameters(const UnrealLiveLink_Camera &Frame, FLiveLinkCameraFrameData &CameraData)
+{
+	CameraData.FieldOfView = Frame.fieldOfView;
+	CameraData.AspectRatio = Frame.aspectRatio;
+	CameraData.FocalLength = Frame.focalLength;
+	CameraData.Aperture = Frame.aperture;
+	CameraData.FocusDistance = Frame.focusDistance;
+	CameraData.ProjectionMode = Frame.isPerspective ? ELiveLinkCameraProjectionMode::Perspective : ELiveLinkCameraProjectionMode::Orthographic;
+}
+
+int UnrealLiveLink_ProviderUpdateCameraFrame(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues, const UnrealLiveLink_Camera *Frame)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	FLiveLinkFrameDataStruct FrameData(FLiveLinkCameraFrameData::StaticStruct());
+	FLiveLinkCameraFrameData& CameraData = *FrameData.Cast<FLiveLinkCameraFrameData>();
+
+	SetCameraFrameParameters(*Frame, CameraData);
+	SetFTransform(CameraData.Transform, Frame->transform, *LiveLinkProvider->GetSubjectSettings(SubjectName));
+
+	SetBasicFrameParameters(SubjectName, WorldTime, Metadata, PropValues, FrameData);
+
+	return LiveLinkProvider->UpdateSubjectFrameData(SubjectName, MoveTemp(FrameData)) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_FAILED;
+}
+
+void UnrealLiveLink_UpdateCameraFrame(const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues, const UnrealLiveLink_Camera *Frame)
+{
+	UnrealLiveLink_ProviderUpdateCameraFrame(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, SubjectName, WorldTime, Metadata, PropValues, Frame);
+}
+
+int UnrealLiveLink_ProviderUpdateCameraFrameMatrix(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
+	const UnrealLiveLink_Camera *Frame, const UnrealLiveLink_Matrix *Transform)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	FLiveLinkFrameDataStruct FrameData(FLiveLinkCameraFrameData::StaticStruct());
+	FLiveLinkCameraFrameData& CameraData = *FrameData.Cast<FLiveLinkCameraFrameData>();
+
+	SetCameraFrameParameters(*Frame, CameraData);
+	SetFTransformFromMatrix(CameraData.Transform, *Transform);
+
+	SetBasicFrameParameters(SubjectName, WorldTime, Metadata, PropValues, FrameData);
+
+	return LiveLinkProvider->UpdateSubjectFrameData(SubjectName, MoveTemp(FrameData)) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_FAILED;
+}
+
+
+int UnrealLiveLink_ProviderSetLightStructure(int Provider,
+	const char *SubjectName, const UnrealLiveLink_Properties *Properties, UnrealLiveLink_LightStatic *LightStructure)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	const uint64 StaticDataHash = HashStaticData(ULiveLinkLightRole::StaticClass(), Properties, LightStructure, sizeof(UnrealLiveLink_LightStatic));
+	if (LiveLinkProvider->IsStaticDataCurrent(SubjectName, StaticDataHash))
+	{
+		return UNREAL_LIVE_LINK_OK;
+	}
+
+	FLiveLinkStaticDataStruct StaticData(FLiveLinkLightStaticData::StaticStruct());
+	FLiveLinkLightStaticData& LightData = *StaticData.Cast<FLiveLinkLightStaticData>();
+
+	AddPropertyNames(Properties, LightData.PropertyNames);
+	if (LightStructure)
+	{
+		LightData.bIsTemperatureSupported = LightStructure->isTemperatureSupported != 0;
+		LightData.bIsIntensitySupported = LightStructure->isIntensitySupported != 0;
+		LightData.bIsLightColorSupported = LightStructure->isLightColorSupported != 0;
+		LightData.bIsInnerConeAngleSupported = LightStructure->isInnerConeAngleSupported != 0;
+		LightData.bIsOuterConeAngleSupported = LightStructure->isOuterConeAngleSupported != 0;
+		LightData.bIsAttenuationRadiusSupported = LightStructure->isAttenuationRadiusSupported != 0;
+		LightData.bIsSourceLenghtSupported = LightStructure->isSourceLengthSupported != 0;
+		LightData.bIsSourceRadiusSupported = LightStructure->isSourceRadiusSupported != 0;
+		LightData.bIsSoftSourceRadiusSupported = LightStructure->isSoftSourceRadiusSupported != 0;
+	}
+
+	return LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkLightRole::StaticClass(), StaticDataHash, MoveTemp(StaticData)) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_FAILED;
+}
+
+void UnrealLiveLink_SetLightStructure(
+	const char *SubjectName, const UnrealLiveLink_Properties *Properties, UnrealLiveLink_LightStatic *LightStructure)
+{
+	UnrealLiveLink_ProviderSetLightStructure(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, SubjectName, Properties, LightStructure);
+}
+
+// set the light values other than the transform
+static void SetLightFrameParameters(const UnrealLiveLink_Light &Frame, FLiveLinkLightFrameData &LightData)
+{
+	LightData.Temperature = Frame.temperature;
+	LightData.Intensity = Frame.intensity;
+	LightData.LightColor.R = Frame.lightColor[0];
+	LightData.LightColor.G = Frame.lightColor[1];
+	LightData.LightColor.B = Frame.lightColor[2];
+	LightData.LightColor.A = 255;
+	LightData.InnerConeAngle = Frame.innerConeAngle;
+	LightData.OuterConeAngle = Frame.outerConeAngle;
+	LightData.AttenuationRadius = Frame.attenuationRadius;
+	LightData.SourceRadius = Frame.sourceRadius;
+	LightData.SoftSourceRadius = Frame.softSourceRadius;
+	LightData.SourceLength = Frame.sourceLength;
+}
+
+int UnrealLiveLink_ProviderUpdateLightFrame(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues, const UnrealLiveLink_Light *Frame)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	FLiveLinkFrameDataStruct FrameData(FLiveLinkLightFrameData::StaticStruct());
+	FLiveLinkLightFrameData& LightData = *FrameData.Cast<FLiveLinkLightFrameData>();
+
+	SetLightFrameParameters(*Frame, LightData);
+	SetFTransform(LightData.Transform, Frame->transform, *LiveLinkProvider->GetSubjectSettings(SubjectName));
+
+	SetBasicFrameParameters(SubjectName, WorldTime, Metadata, PropValues, FrameData);
+	
+	return LiveLinkProvider->UpdateSubjectFrameData(SubjectName, MoveTemp(FrameData)) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_FAILED;
+}
+
+void UnrealLiveLink_UpdateLightFrame(const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues, const UnrealLiveLink_Light *Frame)
+{
+	UnrealLiveLink_ProviderUpdateLightFrame(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, SubjectName, WorldTime, Metadata, PropValues, Frame);
+}
+
+int UnrealLiveLink_ProviderUpdateLightFrameMatrix(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
+	const UnrealLiveLink_Light *Frame, const UnrealLiveLink_Matrix *Transform)
+{
+	TSharedPtr<FUnrealLiveLinkCInterfaceProvider> LiveLinkProvider = FindProvider(Provider);
+	if (!LiveLinkProvider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	FLiveLinkFrameDataStruct FrameData(FLiveLinkLightFrameData::StaticStruct());
+	FLiveLinkLightFrameData& LightData = *FrameData.Cast<FLiveLinkLightFrameData>();
+
+	SetLightFrameParameters(*Frame, LightData);
+	SetFTransformFromMatrix(LightData.Transform, *Transform);
+
+	SetBasicFrameParameters(SubjectName, WorldTime, Metadata, PropValues, FrameData);
+
+	return LiveLinkProvider->UpdateSubjectFrameData(SubjectName, MoveTemp(FrameData)) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_FAILED;
+}
+
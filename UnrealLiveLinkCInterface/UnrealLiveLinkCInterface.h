@@ -1,64 +1,161 @@
-
-#pragma once
-
-#include "UnrealLiveLinkCInterfaceTypes.h"
-
-#ifdef WIN32
-#define APICALL __declspec(dllexport)
-#else
-#define APICALL __attribute__((visibility("default")))
-#endif
-
-
-#ifdef __cplusplus
-extern "C"
-{
-#endif
-
-APICALL void UnrealLiveLink_Initialize();
-APICALL void UnrealLiveLink_Shutdown();
-
-APICALL int UnrealLiveLink_GetVersion();
-
-APICALL void UnrealLiveLink_SetProviderName(const char *ProviderName);
-
-APICALL int UnrealLiveLink_StartLiveLink();
-
-APICALL int UnrealLiveLink_StopLiveLink();
-
-APICALL void UnrealLiveLink_SetUnicastEndpoint(const char* Endpoint);
-APICALL int UnrealLiveLink_AddStaticEndpoint(const char* Endpoint);
-APICALL int UnrealLiveLink_RemoveStaticEndpoint(const char* Endpoint);
-
-APICALL void UnrealLiveLink_RegisterConnectionUpdateCallback(void (*Callback)());
-
-APICALL int UnrealLiveLink_HasConnection();
-
-APICALL void UnrealLiveLink_SetBasicStructure(const char *SubjectName, const UnrealLiveLink_Properties *Properties);
-APICALL void UnrealLiveLink_UpdateBasicFrame(const char *SubjectName, const double WorldTime,
-	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues);
-
-APICALL void UnrealLiveLink_SetAnimationStructure(
-	const char *SubjectName, const UnrealLiveLink_Properties *Properties, UnrealLiveLink_AnimationStatic *AnimStructure);
-APICALL void UnrealLiveLink_UpdateAnimationFrame(const char *SubjectName, const double WorldTime,
-	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
-	const UnrealLiveLink_Animation *Frame);
-
-APICALL void UnrealLiveLink_SetTransformStructure(const char *SubjectName, const UnrealLiveLink_Properties *Properties);
-APICALL void UnrealLiveLink_UpdateTransformFrame(const char *SubjectName, const double WorldTime,
-	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
-	const UnrealLiveLink_Transform *Frame);
-
-APICALL void UnrealLiveLink_SetCameraStructure(
-	const char *SubjectName, const UnrealLiveLink_Properties *Properties, UnrealLiveLink_CameraStatic *CameraStructure);
-APICALL void UnrealLiveLink_UpdateCameraFrame(const char *SubjectName, const double WorldTime,
-	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues, const UnrealLiveLink_Camera *Frame);
-
-APICALL void UnrealLiveLink_SetLightStructure(
-	const char *SubjectName, const UnrealLiveLink_Properties *Properties, UnrealLiveLink_LightStatic *LightStructure);
-APICALL void UnrealLiveLink_UpdateLightFrame(const char *SubjectName, const double WorldTime,
-	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues, const UnrealLiveLink_Light *Frame);
-
-#ifdef __cplusplus
-}
-#endif
+
+#pragma once
+
+#include "UnrealLiveLinkCInterfaceTypes.h"
+
+#ifdef WIN32
+#define APICALL __declspec(dllexport)
+#else
+#define APICALL __attribute__((visibility("default")))
+#endif
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+APICALL void UnrealLiveLink_Initialize();
+APICALL void UnrealLiveLink_Shutdown();
+
+APICALL int UnrealLiveLink_GetVersion();
+
+// all of the functions below in one table, null if Version is older than UNREAL_LIVE_LINK_INTERFACE_API_VERSION
+APICALL const UnrealLiveLink_Interface *UnrealLiveLink_GetInterface(int Version);
+
+APICALL void UnrealLiveLink_SetProviderName(const char *ProviderName);
+
+APICALL int UnrealLiveLink_StartLiveLink();
+
+APICALL int UnrealLiveLink_StopLiveLink();
+
+APICALL void UnrealLiveLink_SetUnicastEndpoint(const char* Endpoint);
+APICALL int UnrealLiveLink_AddStaticEndpoint(const char* Endpoint);
+APICALL int UnrealLiveLink_RemoveStaticEndpoint(const char* Endpoint);
+APICALL int UnrealLiveLink_SetTransportSettings(const UnrealLiveLink_TransportSettings *TransportSettings);
+APICALL int UnrealLiveLink_GetTransportSettings(UnrealLiveLink_TransportSettings *TransportSettings);
+
+APICALL void UnrealLiveLink_RegisterConnectionUpdateCallback(void (*Callback)());
+
+APICALL int UnrealLiveLink_HasConnection();
+
+APICALL int UnrealLiveLink_SetTickerRate(double Rate);
+APICALL int UnrealLiveLink_Pump();
+APICALL int UnrealLiveLink_GetTickerStats(UnrealLiveLink_TickerStats *Stats);
+
+APICALL void UnrealLiveLink_SetBasicStructure(const char *SubjectName, const UnrealLiveLink_Properties *Properties);
+APICALL void UnrealLiveLink_UpdateBasicFrame(const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues);
+
+APICALL void UnrealLiveLink_SetAnimationStructure(
+	const char *SubjectName, const UnrealLiveLink_Properties *Properties, UnrealLiveLink_AnimationStatic *AnimStructure);
+APICALL void UnrealLiveLink_UpdateAnimationFrame(const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
+	const UnrealLiveLink_Animation *Frame);
+
+APICALL void UnrealLiveLink_SetTransformStructure(const char *SubjectName, const UnrealLiveLink_Properties *Properties);
+APICALL void UnrealLiveLink_UpdateTransformFrame(const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
+	const UnrealLiveLink_Transform *Frame);
+
+APICALL void UnrealLiveLink_SetCameraStructure(
+	const char *SubjectName, const UnrealLiveLink_Properties *Properties, UnrealLiveLink_CameraStatic *CameraStructure);
+APICALL void UnrealLiveLink_UpdateCameraFrame(const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues, const UnrealLiveLink_Camera *Frame);
+
+APICALL void UnrealLiveLink_SetLightStructure(
+	const char *SubjectName, const UnrealLiveLink_Properties *Properties, UnrealLiveLink_LightStatic *LightStructure);
+APICALL void UnrealLiveLink_UpdateLightFrame(const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues, const UnrealLiveLink_Light *Frame);
+
+APICALL int UnrealLiveLink_CreateProvider(const char *ProviderName);
+APICALL int UnrealLiveLink_DestroyProvider(int Provider);
+APICALL int UnrealLiveLink_StartProvider(int Provider);
+APICALL int UnrealLiveLink_StopProvider(int Provider);
+
+APICALL int UnrealLiveLink_RegisterProviderConnectionUpdateCallback(int Provider, void (*Callback)());
+APICALL int UnrealLiveLink_ProviderHasConnection(int Provider);
+APICALL int UnrealLiveLink_ProviderGetConnectionStats(int Provider, UnrealLiveLink_ConnectionStats *Stats);
+
+APICALL int UnrealLiveLink_ProviderGetStaticDataStats(int Provider, UnrealLiveLink_StaticDataStats *Stats);
+
+APICALL int UnrealLiveLink_ProviderSetBasicStructure(int Provider, const char *SubjectName, const UnrealLiveLink_Properties *Properties);
+APICALL int UnrealLiveLink_ProviderUpdateBasicFrame(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues);
+
+APICALL int UnrealLiveLink_ProviderSetAnimationStructure(int Provider,
+	const char *SubjectName, const UnrealLiveLink_Properties *Properties, UnrealLiveLink_AnimationStatic *AnimStructure);
+APICALL int UnrealLiveLink_ProviderUpdateAnimationFrame(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
+	const UnrealLiveLink_Animation *Frame);
+APICALL int UnrealLiveLink_ProviderUpdateAnimationFrames(int Provider, const UnrealLiveLink_AnimationSubjectFrame *Frames, int FrameCount);
+
+APICALL int UnrealLiveLink_RegisterSkeletonTemplate(const UnrealLiveLink_Properties *Properties, const UnrealLiveLink_AnimationStatic *AnimStructure);
+APICALL int UnrealLiveLink_UnregisterSkeletonTemplate(int SkeletonTemplate);
+APICALL int UnrealLiveLink_ProviderSetAnimationStructureFromTemplate(int Provider, const char *SubjectName, int SkeletonTemplate);
+
+APICALL int UnrealLiveLink_CreateSkeletonMap(const UnrealLiveLink_Properties *SourceNames, const UnrealLiveLink_AnimationStatic *AnimStructure);
+APICALL int UnrealLiveLink_DestroySkeletonMap(int SkeletonMap);
+APICALL int UnrealLiveLink_ProviderUpdateAnimationFrameMapped(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_PackedMetadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
+	int SkeletonMap, const UnrealLiveLink_Animation *Frame);
+
+APICALL int UnrealLiveLink_ProviderUpdateBasicFrameSparse(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_PackedMetadata *Metadata, const UnrealLiveLink_SparsePropertyValues *PropValues);
+APICALL int UnrealLiveLink_ProviderUpdateAnimationFrameSparse(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_PackedMetadata *Metadata, const UnrealLiveLink_SparsePropertyValues *PropValues,
+	const UnrealLiveLink_SparseTransforms *Frame);
+
+APICALL int UnrealLiveLink_ProviderSetAnimationTransformSpace(int Provider, const char *SubjectName, UnrealLiveLink_TransformSpace Space);
+
+APICALL int UnrealLiveLink_ProviderSetTransformStructure(int Provider, const char *SubjectName, const UnrealLiveLink_Properties *Properties);
+APICALL int UnrealLiveLink_ProviderUpdateTransformFrame(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
+	const UnrealLiveLink_Transform *Frame);
+
+APICALL int UnrealLiveLink_ProviderSetCameraStructure(int Provider,
+	const char *SubjectName, const UnrealLiveLink_Properties *Properties, UnrealLiveLink_CameraStatic *CameraStructure);
+APICALL int UnrealLiveLink_ProviderUpdateCameraFrame(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues, const UnrealLiveLink_Camera *Frame);
+
+APICALL int UnrealLiveLink_ProviderSetLightStructure(int Provider,
+	const char *SubjectName, const UnrealLiveLink_Properties *Properties, UnrealLiveLink_LightStatic *LightStructure);
+APICALL int UnrealLiveLink_ProviderUpdateLightFrame(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues, const UnrealLiveLink_Light *Frame);
+APICALL int UnrealLiveLink_ProviderSetRotationOrder(int Provider, const char *SubjectName, UnrealLiveLink_RotationOrder Order, int IsRadians);
+
+APICALL int UnrealLiveLink_ProviderSetValidation(int Provider, const char *SubjectName, UnrealLiveLink_ValidationMode Mode, float MaxAbsValue);
+APICALL int UnrealLiveLink_ProviderGetValidationStats(int Provider, UnrealLiveLink_ValidationStats *Stats);
+APICALL int UnrealLiveLink_ProviderSetFilter(int Provider, const char *SubjectName, UnrealLiveLink_FilterChannel Channel,
+	const UnrealLiveLink_FilterSettings *Settings);
+APICALL int UnrealLiveLink_ProviderSetResampling(int Provider, const char *SubjectName, double OutputRate, double Delay);
+APICALL int UnrealLiveLink_ProviderSetExtrapolation(int Provider, const char *SubjectName, const UnrealLiveLink_ExtrapolationSettings *Settings);
+APICALL int UnrealLiveLink_ProviderGetExtrapolationStats(int Provider, UnrealLiveLink_ExtrapolationStats *Stats);
+APICALL int UnrealLiveLink_ProviderSetClock(int Provider, const UnrealLiveLink_ClockSettings *Settings);
+APICALL int UnrealLiveLink_ProviderGetClockStats(int Provider, UnrealLiveLink_ClockStats *Stats);
+
+APICALL int UnrealLiveLink_ProviderUpdateTransformFrameMatrix(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues, const UnrealLiveLink_Matrix *Frame);
+APICALL int UnrealLiveLink_ProviderUpdateAnimationFrameMatrices(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues, const UnrealLiveLink_AnimationMatrices *Frame);
+APICALL int UnrealLiveLink_ProviderUpdateCameraFrameMatrix(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
+	const UnrealLiveLink_Camera *Frame, const UnrealLiveLink_Matrix *Transform);
+APICALL int UnrealLiveLink_ProviderUpdateLightFrameMatrix(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_Metadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
+	const UnrealLiveLink_Light *Frame, const UnrealLiveLink_Matrix *Transform);
+
+APICALL int UnrealLiveLink_ProviderSetBasicStructurePacked(int Provider, const char *SubjectName,
+	const UnrealLiveLink_PackedStrings *PropertyNames);
+APICALL int UnrealLiveLink_ProviderUpdateBasicFramePacked(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_PackedMetadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues);
+APICALL int UnrealLiveLink_ProviderSetAnimationStructurePacked(int Provider, const char *SubjectName,
+	const UnrealLiveLink_PackedStrings *PropertyNames, const UnrealLiveLink_PackedAnimationStatic *AnimStructure);
+APICALL int UnrealLiveLink_ProviderUpdateAnimationFramePacked(int Provider, const char *SubjectName, const double WorldTime,
+	const UnrealLiveLink_PackedMetadata *Metadata, const UnrealLiveLink_PropertyValues *PropValues,
+	const UnrealLiveLink_Animation *Frame);
+APICALL int UnrealLiveLink_ProviderGetSkeletonSetupStats(int Provider, UnrealLiveLink_SkeletonSetupStats *Stats);
+
+#ifdef __cplusplus
+}
+#endif
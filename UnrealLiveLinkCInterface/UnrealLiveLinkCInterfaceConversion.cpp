@@ -0,0 +1,93 @@
+
+#include "UnrealLiveLinkCInterfaceConversion.h"
+
+
+void SetFTransformFromMatrix(FTransform &Transform, const UnrealLiveLink_Matrix &InMatrix)
+{
+	FMatrix Matrix;
+	for (int32 Row = 0; Row < 4; Row++)
+	{
+		for (int32 Col = 0; Col < 4; Col++)
+		{
+			Matrix.M[Row][Col] = InMatrix.m[Row][Col];
+		}
+	}
+
+	// SetFromMatrix extracts the scale and, for mirrored matrices (negative determinant),
+	// negates the X scale and axis so the remaining rotation is a proper quaternion
+	Transform.SetFromMatrix(Matrix);
+}
+
+void ConvertMatricesToTransforms(const UnrealLiveLink_Matrix *Matrices, int32 Count, TArray<FTransform> &Transforms)
+{
+	Transforms.SetNumUninitialized(Count);
+	for (int32 Idx = 0; Idx < Count; Idx++)
+	{
+		SetFTransformFromMatrix(Transforms[Idx], Matrices[Idx]);
+	}
+}
+
+FQuat EulerToQuat(const float *Angles, UnrealLiveLink_RotationOrder Order, bool bRadians)
+{
+	// axes in the order they are applied, indexed by UnrealLiveLink_RotationOrder - 1
+	static const int32 AxisOrders[6][3] =
+	{
+		{ 0, 1, 2 },	// XYZ
+		{ 0, 2, 1 },	// XZY
+		{ 1, 0, 2 },	// YXZ
+		{ 1, 2, 0 },	// YZX
+		{ 2, 0, 1 },	// ZXY
+		{ 2, 1, 0 }		// ZYX
+	};
+
+	check(Order > UNREAL_LIVE_LINK_ROTATION_QUATERNION && Order <= UNREAL_LIVE_LINK_ROTATION_EULER_ZYX);
+	const int32 *Axes = AxisOrders[Order - 1];
+	const float HalfScale = bRadians ? 0.5f : PI / 360.0f;
+
+	FQuat Result = FQuat::Identity;
+	for (int32 Idx = 0; Idx < 3; Idx++)
+	{
+		const int32 Axis = Axes[Idx];
+
+		float Sin, Cos;
+		FMath::SinCos(&Sin, &Cos, Angles[Axis] * HalfScale);
+
+		float Vector[3] = { 0.0f, 0.0f, 0.0f };
+		Vector[Axis] = Sin;
+		const FQuat AxisQuat(Vector[0], Vector[1], Vector[2], Cos);
+
+		// later rotations are applied on top of earlier ones
+		Result = AxisQuat * Result;
+	}
+
+	return Result;
+}
+
+bool AreBoneParentsOrdered(const TArray<int32> &BoneParents)
+{
+	for (int32 Idx = 0; Idx < BoneParents.Num(); Idx++)
+	{
+		if (BoneParents[Idx] < INDEX_NONE || BoneParents[Idx] >= Idx)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void ConvertWorldToLocalTransforms(TArray<FTransform> &Transforms, const TArray<int32> &BoneParents)
+{
+	check(Transforms.Num() == BoneParents.Num());
+
+	// children are visited before their parents so each parent is still in world space when used,
+	// GetRelativeTransform is the vectorized inverse parent rotation times child plus translation and scale
+	for (int32 Idx = Transforms.Num() - 1; Idx >= 0; Idx--)
+	{
+		const int32 Parent = BoneParents[Idx];
+		if (Parent != INDEX_NONE)
+		{
+			Transforms[Idx] = Transforms[Idx].GetRelativeTransform(Transforms[Parent]);
+		}
+	}
+}
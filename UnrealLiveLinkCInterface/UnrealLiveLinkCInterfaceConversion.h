@@ -0,0 +1,21 @@
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UnrealLiveLinkCInterfaceTypes.h"
+
+
+// true if every bone's parent is the root (-1) or comes before the bone
+bool AreBoneParentsOrdered(const TArray<int32> &BoneParents);
+
+// set FTransform from a 4x4 matrix, a negative determinant is folded into the X scale
+void SetFTransformFromMatrix(FTransform &Transform, const UnrealLiveLink_Matrix &InMatrix);
+
+// decompose a batch of matrices, replacing the contents of Transforms
+void ConvertMatricesToTransforms(const UnrealLiveLink_Matrix *Matrices, int32 Count, TArray<FTransform> &Transforms);
+
+// quaternion from X, Y and Z Euler angles applied in the given order (not UNREAL_LIVE_LINK_ROTATION_QUATERNION)
+FQuat EulerToQuat(const float *Angles, UnrealLiveLink_RotationOrder Order, bool bRadians);
+
+// convert world space bone transforms to parent-local in place, bone parents must be ordered
+void ConvertWorldToLocalTransforms(TArray<FTransform> &Transforms, const TArray<int32> &BoneParents);
@@ -0,0 +1,641 @@
+
+#include "UnrealLiveLinkCInterfaceFrameProcessing.h"
+
+#include "Roles/LiveLinkAnimationTypes.h"
+#include "Roles/LiveLinkTransformTypes.h"
+
+
+TArrayView<FTransform> GetFrameTransforms(FLiveLinkFrameDataStruct &FrameData)
+{
+	if (FLiveLinkAnimationFrameData *AnimData = FrameData.Cast<FLiveLinkAnimationFrameData>())
+	{
+		return AnimData->Transforms;
+	}
+
+	// camera and light frame data derive from the transform frame data
+	if (FLiveLinkTransformFrameData *XformData = FrameData.Cast<FLiveLinkTransformFrameData>())
+	{
+		return TArrayView<FTransform>(&XformData->Transform, 1);
+	}
+
+	return TArrayView<FTransform>();
+}
+
+void CacheFrame(FFrameCacheState &State, const FLiveLinkFrameDataStruct &FrameData)
+{
+	if (const FLiveLinkAnimationFrameData *AnimData = FrameData.Cast<FLiveLinkAnimationFrameData>())
+	{
+		State.Transforms = AnimData->Transforms;
+	}
+	State.PropertyValues = FrameData.GetBaseData()->PropertyValues;
+}
+
+static bool AreIndicesInRange(TArrayView<const int32> Indices, const int32 Count)
+{
+	for (const int32 Idx : Indices)
+	{
+		if (Idx < 0 || Idx >= Count)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool MergeSparseFrame(FFrameCacheState &State, const FSparseFrame &Sparse, int32 BoneCount, const int32 PropertyCount,
+	FLiveLinkFrameDataStruct &FrameData)
+{
+	FLiveLinkAnimationFrameData *AnimData = FrameData.Cast<FLiveLinkAnimationFrameData>();
+	if (!AnimData)
+	{
+		BoneCount = 0;
+	}
+
+	if (!AreIndicesInRange(Sparse.BoneIndices, BoneCount) || !AreIndicesInRange(Sparse.PropertyIndices, PropertyCount))
+	{
+		return false;
+	}
+
+	// a changed structure keeps the values of the bones and properties it still has
+	if (AnimData)
+	{
+		State.Transforms.SetNum(BoneCount);
+	}
+	State.PropertyValues.SetNumZeroed(PropertyCount);
+
+	for (int32 Idx = 0; Idx < Sparse.BoneIndices.Num(); Idx++)
+	{
+		State.Transforms[Sparse.BoneIndices[Idx]] = Sparse.Transforms[Idx];
+	}
+	for (int32 Idx = 0; Idx < Sparse.PropertyIndices.Num(); Idx++)
+	{
+		State.PropertyValues[Sparse.PropertyIndices[Idx]] = Sparse.PropertyValues[Idx];
+	}
+
+	if (AnimData)
+	{
+		AnimData->Transforms = State.Transforms;
+	}
+	FrameData.GetBaseData()->PropertyValues = State.PropertyValues;
+	return true;
+}
+
+static bool IsValueInRange(const float Value, const float MaxAbsValue)
+{
+	return FMath::IsFinite(Value) && (MaxAbsValue <= 0.0f || FMath::Abs(Value) <= MaxAbsValue);
+}
+
+EFrameValidationResult ValidateFrame(UnrealLiveLink_ValidationMode Mode, float MaxAbsValue,
+	FFrameValidationState &State, FLiveLinkFrameDataStruct &FrameData, uint64 &OutNormalizedCount)
+{
+	bool bRepaired = false;
+
+	TArrayView<FTransform> Transforms = GetFrameTransforms(FrameData);
+	for (int32 Idx = 0; Idx < Transforms.Num(); Idx++)
+	{
+		FTransform &Transform = Transforms[Idx];
+
+		// ContainsNaN checks rotation, translation and scale for NaN and Inf in vector registers
+		bool bValid = !Transform.ContainsNaN() && Transform.GetRotation().SizeSquared() > KINDA_SMALL_NUMBER;
+		if (bValid && MaxAbsValue > 0.0f)
+		{
+			bValid = Transform.GetTranslation().GetAbsMax() <= MaxAbsValue && Transform.GetScale3D().GetAbsMax() <= MaxAbsValue;
+		}
+
+		if (bValid)
+		{
+			if (!Transform.IsRotationNormalized())
+			{
+				Transform.NormalizeRotation();
+				OutNormalizedCount++;
+			}
+			continue;
+		}
+
+		if (Mode == UNREAL_LIVE_LINK_VALIDATION_REJECT)
+		{
+			return EFrameValidationResult::Rejected;
+		}
+
+		Transform = State.Transforms.IsValidIndex(Idx) ? State.Transforms[Idx] : FTransform::Identity;
+		bRepaired = true;
+	}
+
+	TArray<float> &PropertyValues = FrameData.GetBaseData()->PropertyValues;
+	for (int32 Idx = 0; Idx < PropertyValues.Num(); Idx++)
+	{
+		if (IsValueInRange(PropertyValues[Idx], MaxAbsValue))
+		{
+			continue;
+		}
+
+		if (Mode == UNREAL_LIVE_LINK_VALIDATION_REJECT)
+		{
+			return EFrameValidationResult::Rejected;
+		}
+
+		PropertyValues[Idx] = State.PropertyValues.IsValidIndex(Idx) ? State.PropertyValues[Idx] : 0.0f;
+		bRepaired = true;
+	}
+
+	// Reset keeps the allocation, the state isn't reallocated while the frame size doesn't change
+	State.Transforms.Reset();
+	State.Transforms.Append(Transforms.GetData(), Transforms.Num());
+	State.PropertyValues = PropertyValues;
+
+	return bRepaired ? EFrameValidationResult::Repaired : EFrameValidationResult::Valid;
+}
+
+
+// smoothing factor of an exponential filter with the given cutoff frequency
+static float OneEuroAlpha(const float Cutoff, const float DeltaTime)
+{
+	const float Tau = 1.0f / (2.0f * PI * Cutoff);
+	return 1.0f / (1.0f + Tau / DeltaTime);
+}
+
+static bool IsFilterEnabled(const UnrealLiveLink_FilterSettings &Filter)
+{
+	return Filter.minCutoff > 0.0f;
+}
+
+// size the channel for Count values, true if it had a different size and must restart from the raw values
+static bool ResetChannel(FOneEuroChannel &Channel, const int32 Count)
+{
+	if (Channel.Values.Num() == Count)
+	{
+		return false;
+	}
+
+	Channel.Values.SetNumUninitialized(Count);
+	Channel.Derivatives.SetNumZeroed(Count);
+	return true;
+}
+
+static void FilterValues(const UnrealLiveLink_FilterSettings &Filter, const float DeltaTime, const int32 Count,
+	float *Values, float *Filtered, float *Derivatives)
+{
+	// the derivative alpha is shared by all values, only the value cutoff depends on each value's speed
+	const float DerivativeAlpha = OneEuroAlpha(Filter.derivativeCutoff, DeltaTime);
+
+	for (int32 Idx = 0; Idx < Count; Idx++)
+	{
+		const float Speed = (Values[Idx] - Filtered[Idx]) / DeltaTime;
+		Derivatives[Idx] += DerivativeAlpha * (Speed - Derivatives[Idx]);
+
+		const float Cutoff = Filter.minCutoff + Filter.beta * FMath::Abs(Derivatives[Idx]);
+		Filtered[Idx] += OneEuroAlpha(Cutoff, DeltaTime) * (Values[Idx] - Filtered[Idx]);
+		Values[Idx] = Filtered[Idx];
+	}
+}
+
+// filter the translations or scales of the transforms through a flat component array
+static void FilterVectors(const UnrealLiveLink_FilterSettings &Filter, const float DeltaTime, const bool bRestart,
+	FOneEuroChannel &Channel, TArrayView<FTransform> Transforms, TArray<float> &Scratch, const bool bScale)
+{
+	const int32 Count = Transforms.Num() * 3;
+	const bool bReset = ResetChannel(Channel, Count) || bRestart;
+
+	Scratch.SetNumUninitialized(Count);
+	for (int32 Idx = 0; Idx < Transforms.Num(); Idx++)
+	{
+		const FVector Vector = bScale ? Transforms[Idx].GetScale3D() : Transforms[Idx].GetTranslation();
+		Scratch[Idx * 3] = static_cast<float>(Vector.X);
+		Scratch[Idx * 3 + 1] = static_cast<float>(Vector.Y);
+		Scratch[Idx * 3 + 2] = static_cast<float>(Vector.Z);
+	}
+
+	if (bReset)
+	{
+		FMemory::Memcpy(Channel.Values.GetData(), Scratch.GetData(), Count * sizeof(float));
+		FMemory::Memzero(Channel.Derivatives.GetData(), Count * sizeof(float));
+		return;
+	}
+
+	FilterValues(Filter, DeltaTime, Count, Scratch.GetData(), Channel.Values.GetData(), Channel.Derivatives.GetData());
+
+	for (int32 Idx = 0; Idx < Transforms.Num(); Idx++)
+	{
+		const FVector Vector(Scratch[Idx * 3], Scratch[Idx * 3 + 1], Scratch[Idx * 3 + 2]);
+		if (bScale)
+		{
+			Transforms[Idx].SetScale3D(Vector);
+		}
+		else
+		{
+			Transforms[Idx].SetTranslation(Vector);
+		}
+	}
+}
+
+static void FilterRotations(const UnrealLiveLink_FilterSettings &Filter, const float DeltaTime, const bool bRestart,
+	FFrameFilterState &State, TArrayView<FTransform> Transforms)
+{
+	if (bRestart || State.Rotations.Num() != Transforms.Num())
+	{
+		State.Rotations.SetNumUninitialized(Transforms.Num());
+		State.RotationDerivatives.SetNumZeroed(Transforms.Num());
+		for (int32 Idx = 0; Idx < Transforms.Num(); Idx++)
+		{
+			State.Rotations[Idx] = Transforms[Idx].GetRotation();
+			State.RotationDerivatives[Idx] = 0.0f;
+		}
+		return;
+	}
+
+	const float DerivativeAlpha = OneEuroAlpha(Filter.derivativeCutoff, DeltaTime);
+
+	for (int32 Idx = 0; Idx < Transforms.Num(); Idx++)
+	{
+		FQuat &Filtered = State.Rotations[Idx];
+		const FQuat Rotation = Transforms[Idx].GetRotation();
+
+		// angular speed in radians per second, AngularDistance takes the shorter way around
+		const float Speed = static_cast<float>(Filtered.AngularDistance(Rotation)) / DeltaTime;
+		float &Derivative = State.RotationDerivatives[Idx];
+		Derivative += DerivativeAlpha * (Speed - Derivative);
+
+		const float Cutoff = Filter.minCutoff + Filter.beta * Derivative;
+		Filtered = FQuat::Slerp(Filtered, Rotation, OneEuroAlpha(Cutoff, DeltaTime));
+		Transforms[Idx].SetRotation(Filtered);
+	}
+}
+
+// most arrivals in a clock estimate, older ones are dropped first
+static constexpr int32 MaxClockSamples = 512;
+
+double EstimateFrameClock(FFrameClockState &State, const double ProducerTime, const double ArrivalTime, const double Window)
+{
+	TArray<FFrameClockState::FSample> &Samples = State.Samples;
+
+	if (Samples.Num() && ProducerTime < Samples.Last().ProducerTime - Window)
+	{
+		State = FFrameClockState();
+	}
+
+	// subjects sharing a producer time (or arriving slightly out of order) add nothing new, the first arrival is the least delayed
+	if (Samples.Num() == 0 || ProducerTime > Samples.Last().ProducerTime)
+	{
+		Samples.Add({ProducerTime, ArrivalTime});
+
+		int32 Expired = 0;
+		while (Expired < Samples.Num() - 1 &&
+			(Samples[Expired].ProducerTime < ProducerTime - Window || Samples.Num() - Expired > MaxClockSamples))
+		{
+			Expired++;
+		}
+		Samples.RemoveAt(0, Expired);
+
+		State.Origin = Samples[0].ProducerTime;
+
+		double SumX = 0.0;
+		double SumY = 0.0;
+		for (const FFrameClockState::FSample &Sample : Samples)
+		{
+			SumX += Sample.ProducerTime - State.Origin;
+			SumY += Sample.ArrivalTime - Sample.ProducerTime;
+		}
+		const double MeanX = SumX / Samples.Num();
+		const double MeanY = SumY / Samples.Num();
+
+		double Covariance = 0.0;
+		double Variance = 0.0;
+		for (const FFrameClockState::FSample &Sample : Samples)
+		{
+			const double X = Sample.ProducerTime - State.Origin - MeanX;
+			Covariance += X * (Sample.ArrivalTime - Sample.ProducerTime - MeanY);
+			Variance += X * X;
+		}
+		State.Drift = Variance > UE_DOUBLE_SMALL_NUMBER ? Covariance / Variance : 0.0;
+
+		const double Intercept = MeanY - State.Drift * MeanX;
+		double MinResidual = TNumericLimits<double>::Max();
+		double SquaredResiduals = 0.0;
+		for (const FFrameClockState::FSample &Sample : Samples)
+		{
+			const double Residual = Sample.ArrivalTime - Sample.ProducerTime - (Intercept + State.Drift * (Sample.ProducerTime - State.Origin));
+			MinResidual = FMath::Min(MinResidual, Residual);
+			SquaredResiduals += Residual * Residual;
+		}
+		State.Offset = Intercept + MinResidual;
+		State.Jitter = FMath::Sqrt(SquaredResiduals / Samples.Num());
+	}
+
+	return ProducerTime + State.Offset + State.Drift * (ProducerTime - State.Origin);
+}
+
+static double GetFrameWorldTime(const FLiveLinkFrameDataStruct &FrameData)
+{
+	return FrameData.GetBaseData()->WorldTime.GetSourceTime();
+}
+
+void BufferFrame(FFrameResampleState &State, FLiveLinkFrameDataStruct &&FrameData, const double ArrivalTime)
+{
+	if (State.Frames.Num() && GetFrameWorldTime(State.Frames.Last()) >= GetFrameWorldTime(FrameData))
+	{
+		State.Frames.Pop();
+	}
+
+	State.Frames.Add(MoveTemp(FrameData));
+	State.LatestArrivalTime = ArrivalTime;
+}
+
+// mean of frames with matching sizes into OutFrameData, rotations are aligned to the first before summing
+static void AverageFrames(TArrayView<FLiveLinkFrameDataStruct> Frames, FLiveLinkFrameDataStruct &OutFrameData)
+{
+	TArrayView<FTransform> OutTransforms = GetFrameTransforms(OutFrameData);
+	TArray<float> &OutValues = OutFrameData.GetBaseData()->PropertyValues;
+
+	TArray<FVector> Translations, Scales;
+	TArray<FQuat> Rotations;
+	Translations.SetNumZeroed(OutTransforms.Num());
+	Scales.SetNumZeroed(OutTransforms.Num());
+	Rotations.Init(FQuat(0.0f, 0.0f, 0.0f, 0.0f), OutTransforms.Num());
+	TArray<float> Values;
+	Values.SetNumZeroed(OutValues.Num());
+
+	int32 TransformFrames = 0, ValueFrames = 0;
+	for (FLiveLinkFrameDataStruct &Frame : Frames)
+	{
+		TArrayView<FTransform> Transforms = GetFrameTransforms(Frame);
+		if (Transforms.Num() == OutTransforms.Num())
+		{
+			for (int32 Idx = 0; Idx < Transforms.Num(); Idx++)
+			{
+				const FQuat Rotation = Transforms[Idx].GetRotation();
+				const bool bFlip = (OutTransforms[Idx].GetRotation() | Rotation) < 0.0f;
+
+				Translations[Idx] += Transforms[Idx].GetTranslation();
+				Scales[Idx] += Transforms[Idx].GetScale3D();
+				Rotations[Idx] += bFlip ? Rotation * -1.0f : Rotation;
+			}
+			TransformFrames++;
+		}
+
+		const TArray<float> &FrameValues = Frame.GetBaseData()->PropertyValues;
+		if (FrameValues.Num() == Values.Num())
+		{
+			for (int32 Idx = 0; Idx < Values.Num(); Idx++)
+			{
+				Values[Idx] += FrameValues[Idx];
+			}
+			ValueFrames++;
+		}
+	}
+
+	for (int32 Idx = 0; Idx < OutTransforms.Num() && TransformFrames; Idx++)
+	{
+		OutTransforms[Idx].SetTranslation(Translations[Idx] / TransformFrames);
+		OutTransforms[Idx].SetScale3D(Scales[Idx] / TransformFrames);
+		OutTransforms[Idx].SetRotation(Rotations[Idx].GetNormalized());
+	}
+	for (int32 Idx = 0; Idx < Values.Num() && ValueFrames; Idx++)
+	{
+		OutValues[Idx] = Values[Idx] / ValueFrames;
+	}
+}
+
+// interpolate OutFrameData (a copy of the newer frame) toward the older frame by 1 - Alpha
+static void InterpolateFrames(FLiveLinkFrameDataStruct &Older, const float Alpha, FLiveLinkFrameDataStruct &OutFrameData)
+{
+	TArrayView<FTransform> OlderTransforms = GetFrameTransforms(Older);
+	TArrayView<FTransform> OutTransforms = GetFrameTransforms(OutFrameData);
+	if (OlderTransforms.Num() == OutTransforms.Num())
+	{
+		for (int32 Idx = 0; Idx < OutTransforms.Num(); Idx++)
+		{
+			const FTransform &From = OlderTransforms[Idx];
+			FTransform &To = OutTransforms[Idx];
+
+			To.SetRotation(FQuat::Slerp(From.GetRotation(), To.GetRotation(), Alpha));
+			To.SetTranslation(FMath::Lerp(From.GetTranslation(), To.GetTranslation(), Alpha));
+			To.SetScale3D(FMath::Lerp(From.GetScale3D(), To.GetScale3D(), Alpha));
+		}
+	}
+
+	const TArray<float> &OlderValues = Older.GetBaseData()->PropertyValues;
+	TArray<float> &OutValues = OutFrameData.GetBaseData()->PropertyValues;
+	if (OlderValues.Num() == OutValues.Num())
+	{
+		for (int32 Idx = 0; Idx < OutValues.Num(); Idx++)
+		{
+			OutValues[Idx] = FMath::Lerp(OlderValues[Idx], OutValues[Idx], Alpha);
+		}
+	}
+}
+
+bool ResampleFrame(FFrameResampleState &State, const double SampleTime, const double Period, FLiveLinkFrameDataStruct &OutFrameData)
+{
+	TArray<FLiveLinkFrameDataStruct> &Frames = State.Frames;
+	if (Frames.Num() == 0)
+	{
+		return false;
+	}
+
+	// drop frames before the output period, keeping the newest of them to interpolate from
+	int32 FirstInPeriod = 0;
+	while (FirstInPeriod < Frames.Num() && GetFrameWorldTime(Frames[FirstInPeriod]) <= SampleTime - Period)
+	{
+		FirstInPeriod++;
+	}
+	if (FirstInPeriod > 1)
+	{
+		Frames.RemoveAt(0, FirstInPeriod - 1);
+		FirstInPeriod = 1;
+	}
+
+	// first frame after the sample time
+	int32 Next = FirstInPeriod;
+	while (Next < Frames.Num() && GetFrameWorldTime(Frames[Next]) <= SampleTime)
+	{
+		Next++;
+	}
+
+	if (Next - FirstInPeriod > 1)
+	{
+		// decimating, box filter the frames of the output period
+		OutFrameData.InitializeWith(Frames[Next - 1]);
+		AverageFrames(MakeArrayView(&Frames[FirstInPeriod], Next - FirstInPeriod), OutFrameData);
+	}
+	else if (Next == 0 || Next == Frames.Num())
+	{
+		// before the first or after the last frame, hold it
+		OutFrameData.InitializeWith(Frames[Next == 0 ? 0 : Next - 1]);
+	}
+	else
+	{
+		FLiveLinkFrameDataStruct &Older = Frames[Next - 1];
+		FLiveLinkFrameDataStruct &Newer = Frames[Next];
+
+		const double OlderTime = GetFrameWorldTime(Older);
+		const float Alpha = static_cast<float>((SampleTime - OlderTime) / (GetFrameWorldTime(Newer) - OlderTime));
+
+		OutFrameData.InitializeWith(Newer);
+		InterpolateFrames(Older, Alpha, OutFrameData);
+	}
+
+	OutFrameData.GetBaseData()->WorldTime = SampleTime;
+	return true;
+}
+
+void FExtrapolationError::Add(const FExtrapolationError &Other)
+{
+	SampleCount += Other.SampleCount;
+	TranslationErrorSum += Other.TranslationErrorSum;
+	MaxTranslationError = FMath::Max(MaxTranslationError, Other.MaxTranslationError);
+	RotationErrorSum += Other.RotationErrorSum;
+	MaxRotationError = FMath::Max(MaxRotationError, Other.MaxRotationError);
+}
+
+// compare the predictions this frame has reached with it and drop them
+static void CheckPredictions(FFrameExtrapolationState &State, const double WorldTime, TArrayView<const FTransform> Transforms, FExtrapolationError &OutError)
+{
+	int32 Checked = 0;
+	for (; Checked < State.Predictions.Num() && State.Predictions[Checked].TargetTime <= WorldTime; Checked++)
+	{
+		const TArray<FTransform> &Predicted = State.Predictions[Checked].Transforms;
+		if (Predicted.Num() != Transforms.Num())
+		{
+			continue;
+		}
+
+		for (int32 Idx = 0; Idx < Transforms.Num(); Idx++)
+		{
+			const double TranslationError = FVector::Distance(Predicted[Idx].GetTranslation(), Transforms[Idx].GetTranslation());
+			const double RotationError = FMath::RadiansToDegrees(Predicted[Idx].GetRotation().AngularDistance(Transforms[Idx].GetRotation()));
+
+			OutError.SampleCount++;
+			OutError.TranslationErrorSum += TranslationError;
+			OutError.MaxTranslationError = FMath::Max(OutError.MaxTranslationError, TranslationError);
+			OutError.RotationErrorSum += RotationError;
+			OutError.MaxRotationError = FMath::Max(OutError.MaxRotationError, RotationError);
+		}
+	}
+
+	State.Predictions.RemoveAt(0, Checked);
+}
+
+void ExtrapolateFrame(const UnrealLiveLink_ExtrapolationSettings &Settings, FFrameExtrapolationState &State,
+	FLiveLinkFrameDataStruct &FrameData, FExtrapolationError &OutError)
+{
+	FLiveLinkBaseFrameData &BaseData = *FrameData.GetBaseData();
+	TArrayView<FTransform> Transforms = GetFrameTransforms(FrameData);
+	TArray<float> &PropertyValues = BaseData.PropertyValues;
+
+	const double WorldTime = BaseData.WorldTime.GetSourceTime();
+	const double DeltaTime = WorldTime - State.LastWorldTime;
+	const bool bHasVelocity = State.bHasLastFrame && DeltaTime > 0.0;
+
+	// time going back (looping playback, a producer restart) leaves pending predictions unreachable, they would
+	// otherwise block the queue and later be scored against unrelated frames
+	if (DeltaTime <= 0.0)
+	{
+		State.Predictions.Reset();
+	}
+
+	CheckPredictions(State, WorldTime, Transforms, OutError);
+
+	// keep the frame as received, velocities are always estimated between unpredicted frames
+	TArray<FTransform> Previous = MoveTemp(State.Transforms);
+	TArray<float> PreviousValues = MoveTemp(State.PropertyValues);
+	State.Transforms = TArray<FTransform>(Transforms.GetData(), Transforms.Num());
+	State.PropertyValues = PropertyValues;
+	State.LastWorldTime = WorldTime;
+	State.bHasLastFrame = true;
+
+	if (!bHasVelocity)
+	{
+		return;
+	}
+
+	const double Scale = Settings.horizon / DeltaTime;
+	const float MaxRotation = FMath::DegreesToRadians(Settings.maxRotation);
+
+	if (Previous.Num() == Transforms.Num())
+	{
+		for (int32 Idx = 0; Idx < Transforms.Num(); Idx++)
+		{
+			FTransform &Transform = Transforms[Idx];
+
+			FVector Translation = (Transform.GetTranslation() - Previous[Idx].GetTranslation()) * Scale;
+			if (Settings.maxTranslation > 0.0f)
+			{
+				Translation = Translation.GetClampedToMaxSize(Settings.maxTranslation);
+			}
+			Transform.AddToTranslation(Translation);
+
+			// rotation over the last frame, scaled to the horizon about the same axis
+			FQuat Delta = Transform.GetRotation() * Previous[Idx].GetRotation().Inverse();
+			Delta.EnforceShortestArcWith(FQuat::Identity);
+
+			FVector Axis;
+			float Angle;
+			Delta.ToAxisAndAngle(Axis, Angle);
+			Angle *= Scale;
+			if (MaxRotation > 0.0f)
+			{
+				Angle = FMath::Min(Angle, MaxRotation);
+			}
+			Transform.SetRotation((FQuat(Axis, Angle) * Transform.GetRotation()).GetNormalized());
+		}
+
+		FFramePrediction &Prediction = State.Predictions.AddDefaulted_GetRef();
+		Prediction.TargetTime = WorldTime + Settings.horizon;
+		Prediction.Transforms = TArray<FTransform>(Transforms.GetData(), Transforms.Num());
+	}
+
+	if (PreviousValues.Num() == PropertyValues.Num())
+	{
+		for (int32 Idx = 0; Idx < PropertyValues.Num(); Idx++)
+		{
+			float Change = static_cast<float>((PropertyValues[Idx] - PreviousValues[Idx]) * Scale);
+			if (Settings.maxPropertyChange > 0.0f)
+			{
+				Change = FMath::Clamp(Change, -Settings.maxPropertyChange, Settings.maxPropertyChange);
+			}
+			PropertyValues[Idx] += Change;
+		}
+	}
+}
+
+void FilterFrame(const UnrealLiveLink_FilterSettings *Filters, FFrameFilterState &State, FLiveLinkFrameDataStruct &FrameData)
+{
+	FLiveLinkBaseFrameData &BaseData = *FrameData.GetBaseData();
+
+	// restart all channels on the first frame or when time doesn't move forward
+	const double WorldTime = BaseData.WorldTime.GetSourceTime();
+	const float DeltaTime = static_cast<float>(WorldTime - State.LastWorldTime);
+	const bool bRestart = !State.bHasLastFrame || DeltaTime <= 0.0f;
+	State.LastWorldTime = WorldTime;
+	State.bHasLastFrame = true;
+
+	TArrayView<FTransform> Transforms = GetFrameTransforms(FrameData);
+
+	if (IsFilterEnabled(Filters[UNREAL_LIVE_LINK_FILTER_TRANSLATION]))
+	{
+		FilterVectors(Filters[UNREAL_LIVE_LINK_FILTER_TRANSLATION], DeltaTime, bRestart, State.Translations, Transforms, State.Scratch, false);
+	}
+	if (IsFilterEnabled(Filters[UNREAL_LIVE_LINK_FILTER_ROTATION]))
+	{
+		FilterRotations(Filters[UNREAL_LIVE_LINK_FILTER_ROTATION], DeltaTime, bRestart, State, Transforms);
+	}
+	if (IsFilterEnabled(Filters[UNREAL_LIVE_LINK_FILTER_SCALE]))
+	{
+		FilterVectors(Filters[UNREAL_LIVE_LINK_FILTER_SCALE], DeltaTime, bRestart, State.Scales, Transforms, State.Scratch, true);
+	}
+
+	if (IsFilterEnabled(Filters[UNREAL_LIVE_LINK_FILTER_PROPERTIES]))
+	{
+		TArray<float> &PropertyValues = BaseData.PropertyValues;
+		if (ResetChannel(State.PropertyValues, PropertyValues.Num()) || bRestart)
+		{
+			FMemory::Memcpy(State.PropertyValues.Values.GetData(), PropertyValues.GetData(), PropertyValues.Num() * sizeof(float));
+			FMemory::Memzero(State.PropertyValues.Derivatives.GetData(), PropertyValues.Num() * sizeof(float));
+		}
+		else
+		{
+			FilterValues(Filters[UNREAL_LIVE_LINK_FILTER_PROPERTIES], DeltaTime, PropertyValues.Num(),
+				PropertyValues.GetData(), State.PropertyValues.Values.GetData(), State.PropertyValues.Derivatives.GetData());
+		}
+	}
+}
@@ -0,0 +1,179 @@
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LiveLinkTypes.h"
+#include "UnrealLiveLinkCInterfaceTypes.h"
+
+
+// transforms of a transform, camera, light or animation frame, empty for basic frames
+TArrayView<FTransform> GetFrameTransforms(FLiveLinkFrameDataStruct &FrameData);
+
+// producer times (in seconds) and the platform times they arrived, with the fit of one against the other
+struct FFrameClockState
+{
+	struct FSample
+	{
+		double ProducerTime;
+		double ArrivalTime;
+	};
+
+	// oldest first, one per distinct producer time
+	TArray<FSample> Samples;
+
+	// ArrivalTime = ProducerTime + Offset + Drift * (ProducerTime - Origin), Origin keeps the fit well conditioned
+	double Origin = 0.0;
+	double Offset = 0.0;
+	double Drift = 0.0;
+	double Jitter = 0.0;
+};
+
+/**
+ * add a frame arrival to the clock estimate and return ProducerTime mapped onto the platform clock
+ * the drift is a least squares fit over the last Window seconds of producer time, the fit is then lowered onto the
+ * earliest arrival so delays in reaching the library don't bias the offset
+ * a producer clock jumping back by more than Window restarts the estimate
+ */
+double EstimateFrameClock(FFrameClockState &State, const double ProducerTime, const double ArrivalTime, const double Window);
+
+// last frame of a subject taking sparse updates, kept from its first sparse update on
+struct FFrameCacheState
+{
+	bool bEnabled = false;
+	TArray<FTransform> Transforms;
+	TArray<float> PropertyValues;
+};
+
+// values of a sparse update, Transforms[i] replaces bone BoneIndices[i] and PropertyValues[i] property PropertyIndices[i]
+struct FSparseFrame
+{
+	TArrayView<const int32> BoneIndices;
+	TArray<FTransform> Transforms;
+	TArrayView<const int32> PropertyIndices;
+	TArrayView<const float> PropertyValues;
+};
+
+// keep the transforms and property values of a full frame
+void CacheFrame(FFrameCacheState &State, const FLiveLinkFrameDataStruct &FrameData);
+
+/**
+ * patch the sparse values into the last frame and copy the merged values into FrameData
+ * the last frame is sized to BoneCount bones (animation frames only) and PropertyCount properties, added ones are identity or 0
+ * false if an index is out of range, the last frame is then unchanged
+ */
+bool MergeSparseFrame(FFrameCacheState &State, const FSparseFrame &Sparse, int32 BoneCount, const int32 PropertyCount,
+	FLiveLinkFrameDataStruct &FrameData);
+
+enum class EFrameValidationResult
+{
+	Valid,
+	Repaired,
+	Rejected
+};
+
+// last values that passed validation, used to repair later frames
+struct FFrameValidationState
+{
+	TArray<FTransform> Transforms;
+	TArray<float> PropertyValues;
+};
+
+/**
+ * check a frame for NaN/Inf, degenerate rotations and values out of range
+ * non-unit rotations are normalized, invalid values are held from the last good frame (identity or zero without one)
+ * or the frame is rejected depending on the mode
+ */
+EFrameValidationResult ValidateFrame(UnrealLiveLink_ValidationMode Mode, float MaxAbsValue,
+	FFrameValidationState &State, FLiveLinkFrameDataStruct &FrameData, uint64 &OutNormalizedCount);
+
+// filtered values and their smoothed derivatives of one scalar channel, flattened over the frame
+struct FOneEuroChannel
+{
+	TArray<float> Values;
+	TArray<float> Derivatives;
+};
+
+// filter state of a subject, a channel restarts from the raw values when its size changes
+struct FFrameFilterState
+{
+	double LastWorldTime = 0.0;
+	bool bHasLastFrame = false;
+
+	FOneEuroChannel Translations;
+	FOneEuroChannel Scales;
+	FOneEuroChannel PropertyValues;
+
+	TArray<FQuat> Rotations;
+	TArray<float> RotationDerivatives;
+
+	// flattened translation or scale components of the frame being filtered
+	TArray<float> Scratch;
+};
+
+/**
+ * One Euro filter the frame's channels (indexed by UnrealLiveLink_FilterChannel) using the frame world time in seconds
+ * rotations are filtered on their angular speed and blended with slerp
+ * channels with a minCutoff of 0 are left as is
+ */
+void FilterFrame(const UnrealLiveLink_FilterSettings *Filters, FFrameFilterState &State, FLiveLinkFrameDataStruct &FrameData);
+
+// input frames of a resampled subject, oldest first
+struct FFrameResampleState
+{
+	TArray<FLiveLinkFrameDataStruct> Frames;
+
+	// platform time the newest frame arrived, maps platform time to the subject's world time
+	double LatestArrivalTime = 0.0;
+
+	// platform time of the next output frame, 0 until scheduled
+	double NextEmitTime = 0.0;
+};
+
+// add a frame to the resample buffer, frames not newer than the last buffered one replace it
+void BufferFrame(FFrameResampleState &State, FLiveLinkFrameDataStruct &&FrameData, const double ArrivalTime);
+
+/**
+ * build the output frame at SampleTime (world time) from the buffered frames
+ * when several input frames fall in the output period (Period seconds up to SampleTime) they are averaged to avoid aliasing,
+ * otherwise the bracketing frames are interpolated, slerp for rotations and lerp for the rest
+ * frames no longer needed are dropped, false if nothing is buffered
+ */
+bool ResampleFrame(FFrameResampleState &State, const double SampleTime, const double Period, FLiveLinkFrameDataStruct &OutFrameData);
+
+// transforms predicted for a world time, checked against the first frame at or after it
+struct FFramePrediction
+{
+	double TargetTime = 0.0;
+	TArray<FTransform> Transforms;
+};
+
+// last frame as received (before extrapolation) and the predictions not yet checked
+struct FFrameExtrapolationState
+{
+	double LastWorldTime = 0.0;
+	bool bHasLastFrame = false;
+	TArray<FTransform> Transforms;
+	TArray<float> PropertyValues;
+
+	TArray<FFramePrediction> Predictions;
+};
+
+// accumulated prediction error
+struct FExtrapolationError
+{
+	uint64 SampleCount = 0;
+	double TranslationErrorSum = 0.0;
+	double MaxTranslationError = 0.0;
+	double RotationErrorSum = 0.0;
+	double MaxRotationError = 0.0;
+
+	void Add(const FExtrapolationError &Other);
+};
+
+/**
+ * predict the frame's transforms and property values Settings.horizon seconds ahead from the velocities between
+ * the previous and this frame, clamped to the settings' limits
+ * earlier predictions that this frame reaches are compared with it and added to OutError, pending ones are dropped if its world time is not after the previous frame's
+ */
+void ExtrapolateFrame(const UnrealLiveLink_ExtrapolationSettings &Settings, FFrameExtrapolationState &State,
+	FLiveLinkFrameDataStruct &FrameData, FExtrapolationError &OutError);
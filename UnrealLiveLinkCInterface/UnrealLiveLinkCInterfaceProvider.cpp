@@ -0,0 +1,669 @@
+
+#include "UnrealLiveLinkCInterfaceProvider.h"
+
+#include "Containers/Ticker.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "UnrealLiveLinkCInterfaceTypes.h"
+
+
+DEFINE_LOG_CATEGORY_STATIC(LogUnrealLiveLinkCInterfaceProvider, Log, All);
+
+// guards ticking and the tick stats
+static FCriticalSection CoreTickerLock;
+static double LastTickTime = 0.0;
+static uint64 TickCount = 0;
+static double TotalTickInterval = 0.0;
+static double MaxTickInterval = 0.0;
+
+// the core ticker thread, so heartbeats and connection changes are handled without the caller's help
+static FCriticalSection CoreTickerThreadLock;
+static TUniquePtr<FThread> CoreTickerThread;
+static FEvent *CoreTickerEvent = nullptr;
+static std::atomic<double> CoreTickerRate{0.0};
+static std::atomic<bool> bStopCoreTicker{false};
+
+void UnrealLiveLink_TickCoreTicker()
+{
+	FScopeLock Lock(&CoreTickerLock);
+
+	const double Now = FPlatformTime::Seconds();
+	const double DeltaTime = LastTickTime > 0.0 ? Now - LastTickTime : 0.0;
+	if (LastTickTime > 0.0)
+	{
+		TotalTickInterval += DeltaTime;
+		MaxTickInterval = FMath::Max(MaxTickInterval, DeltaTime);
+	}
+	LastTickTime = Now;
+	TickCount++;
+
+	FTSTicker::GetCoreTicker().Tick(static_cast<float>(DeltaTime));
+}
+
+void UnrealLiveLink_GetCoreTickerStats(UnrealLiveLink_TickerStats &OutStats)
+{
+	FScopeLock Lock(&CoreTickerLock);
+	OutStats.tickCount = TickCount;
+	OutStats.meanInterval = TickCount > 1 ? TotalTickInterval / (TickCount - 1) : 0.0;
+	OutStats.maxInterval = MaxTickInterval;
+}
+
+static void RunCoreTicker()
+{
+	double NextTickTime = FPlatformTime::Seconds();
+
+	while (!bStopCoreTicker)
+	{
+		UnrealLiveLink_TickCoreTicker();
+
+		// a tick taking longer than the period skips to now rather than catching up with a burst
+		const double Now = FPlatformTime::Seconds();
+		NextTickTime = FMath::Max(NextTickTime + 1.0 / CoreTickerRate, Now);
+
+		const double WaitTime = NextTickTime - Now;
+		if (WaitTime > 0.0)
+		{
+			CoreTickerEvent->Wait(FTimespan::FromSeconds(WaitTime));
+		}
+	}
+}
+
+void UnrealLiveLink_SetCoreTickerRate(double Rate)
+{
+	FScopeLock Lock(&CoreTickerThreadLock);
+
+	CoreTickerRate = FMath::Max(Rate, 0.0);
+	if (CoreTickerRate > 0.0)
+	{
+		if (!CoreTickerThread.IsValid())
+		{
+			bStopCoreTicker = false;
+			CoreTickerEvent = FPlatformProcess::GetSynchEventFromPool();
+			CoreTickerThread = MakeUnique<FThread>(TEXT("UnrealLiveLinkCInterfaceCoreTicker"), []() { RunCoreTicker(); });
+		}
+		else
+		{
+			// wake to pick up the new rate
+			CoreTickerEvent->Trigger();
+		}
+	}
+	else if (CoreTickerThread.IsValid())
+	{
+		bStopCoreTicker = true;
+		CoreTickerEvent->Trigger();
+		CoreTickerThread->Join();
+		CoreTickerThread.Reset();
+
+		FPlatformProcess::ReturnSynchEventToPool(CoreTickerEvent);
+		CoreTickerEvent = nullptr;
+	}
+}
+
+
+FUnrealLiveLinkCInterfaceProvider::FUnrealLiveLinkCInterfaceProvider(const FString &InProviderName)
+	: ProviderName(InProviderName)
+{
+}
+
+FUnrealLiveLinkCInterfaceProvider::~FUnrealLiveLinkCInterfaceProvider()
+{
+	Stop();
+}
+
+void FUnrealLiveLinkCInterfaceProvider::SetProviderName(const FString &InProviderName)
+{
+	FScopeLock Lock(&ProviderLock);
+	ProviderName = InProviderName;
+}
+
+FString FUnrealLiveLinkCInterfaceProvider::GetProviderName() const
+{
+	FScopeLock Lock(&ProviderLock);
+	return ProviderName;
+}
+
+int FUnrealLiveLinkCInterfaceProvider::Start()
+{
+	{
+		FScopeLock Lock(&ProviderLock);
+
+		if (ProviderName.IsEmpty())
+		{
+			ProviderName = "C Interface";
+		}
+
+		if (LiveLinkProvider != nullptr)
+		{
+			UE_LOG(LogUnrealLiveLinkCInterfaceProvider, Display, TEXT("Live Link C Interface Provider %s already Initialized"), *ProviderName);
+			return UNREAL_LIVE_LINK_FAILED;
+		}
+
+		TSharedPtr<ILiveLinkProvider> StartedProvider = ILiveLinkProvider::CreateLiveLinkProvider(ProviderName);
+		ConnectionStatusChangedHandle = StartedProvider->RegisterConnStatusChangedHandle(
+			FLiveLinkProviderConnectionStatusChanged::FDelegate::CreateRaw(this, &FUnrealLiveLinkCInterfaceProvider::OnConnectionStatusChanged));
+
+		{
+			FWriteScopeLock PublishLock(LiveLinkProviderLock);
+			LiveLinkProvider = MoveTemp(StartedProvider);
+			ProviderGeneration++;
+		}
+
+		UE_LOG(LogUnrealLiveLinkCInterfaceProvider, Display, TEXT("Live Link C Interface Provider %s Initialized"), *ProviderName);
+	}
+
+	{
+		FScopeLock Lock(&ConnectionStatsLock);
+		StartTime = FPlatformTime::Seconds();
+		FirstConnectionTime = 0.0;
+	}
+
+	UnrealLiveLink_TickCoreTicker();
+
+	return UNREAL_LIVE_LINK_OK;
+}
+
+int FUnrealLiveLinkCInterfaceProvider::Stop()
+{
+	TSharedPtr<ILiveLinkProvider> StoppedProvider;
+
+	{
+		FScopeLock Lock(&ProviderLock);
+
+		if (!LiveLinkProvider.IsValid())
+		{
+			return UNREAL_LIVE_LINK_OK;
+		}
+
+		UE_LOG(LogUnrealLiveLinkCInterfaceProvider, Display, TEXT("Live Link C Interface Provider %s Shutting Down"), *ProviderName);
+
+		if (ConnectionStatusChangedHandle.IsValid())
+		{
+			LiveLinkProvider->UnregisterConnStatusChangedHandle(ConnectionStatusChangedHandle);
+			ConnectionStatusChangedHandle.Reset();
+		}
+
+		{
+			FWriteScopeLock PublishLock(LiveLinkProviderLock);
+			StoppedProvider = MoveTemp(LiveLinkProvider);
+			LiveLinkProvider = nullptr;
+			ProviderGeneration++;
+		}
+	}
+
+	// after the provider is cleared so updates that fetched it before can't start the thread again
+	StopResampling();
+
+	// a new Live Link provider knows none of the subjects, static data has to be sent again and frames
+	// from before the stop are not filtered, extrapolated or merged into frames after it
+	{
+		FReadScopeLock Lock(SubjectsLock);
+		for (TPair<FName, TSharedRef<FUnrealLiveLinkCInterfaceSubject>> &Subject : Subjects)
+		{
+			FScopeLock SubjectLock(&Subject.Value->Lock);
+			Subject.Value->bHasStaticData = false;
+			Subject.Value->Filter = FFrameFilterState();
+			Subject.Value->Resample = FFrameResampleState();
+			Subject.Value->Extrapolation = FFrameExtrapolationState();
+			Subject.Value->Cache = FFrameCacheState();
+		}
+	}
+
+	UnrealLiveLink_TickCoreTicker();
+
+	// release outside of the lock, in-flight updates on other threads may still hold a reference
+	StoppedProvider.Reset();
+
+	return UNREAL_LIVE_LINK_OK;
+}
+
+bool FUnrealLiveLinkCInterfaceProvider::IsStarted() const
+{
+	FReadScopeLock Lock(LiveLinkProviderLock);
+	return LiveLinkProvider.IsValid();
+}
+
+bool FUnrealLiveLinkCInterfaceProvider::HasConnection() const
+{
+	TSharedPtr<ILiveLinkProvider> Provider = GetLiveLinkProvider();
+	return Provider.IsValid() && Provider->HasConnection();
+}
+
+void FUnrealLiveLinkCInterfaceProvider::RegisterConnectionCallback(void (*Callback)())
+{
+	FScopeLock Lock(&CallbackLock);
+	ConnectionCallbacks.Push(Callback);
+}
+
+void FUnrealLiveLinkCInterfaceProvider::GetConnectionStats(UnrealLiveLink_ConnectionStats &OutStats) const
+{
+	FScopeLock Lock(&ConnectionStatsLock);
+	OutStats.connectSeconds = FirstConnectionTime > 0.0 ? FirstConnectionTime - StartTime : -1.0;
+	OutStats.changeCount = ConnectionChangeCount;
+}
+
+TSharedRef<FUnrealLiveLinkCInterfaceSubject> FUnrealLiveLinkCInterfaceProvider::FindOrAddSubject(const FName SubjectName)
+{
+	{
+		FReadScopeLock Lock(SubjectsLock);
+		if (const TSharedRef<FUnrealLiveLinkCInterfaceSubject> *Subject = Subjects.Find(SubjectName))
+		{
+			return *Subject;
+		}
+	}
+
+	FWriteScopeLock Lock(SubjectsLock);
+	if (const TSharedRef<FUnrealLiveLinkCInterfaceSubject> *Subject = Subjects.Find(SubjectName))
+	{
+		return *Subject;
+	}
+	return Subjects.Add(SubjectName, MakeShared<FUnrealLiveLinkCInterfaceSubject>());
+}
+
+TSharedRef<const FUnrealLiveLinkCInterfaceSubjectSettings> FUnrealLiveLinkCInterfaceProvider::GetSubjectSettings(const FName SubjectName)
+{
+	TSharedRef<FUnrealLiveLinkCInterfaceSubject> Subject = FindOrAddSubject(SubjectName);
+	FScopeLock SubjectLock(&Subject->Lock);
+	return Subject->Settings;
+}
+
+bool FUnrealLiveLinkCInterfaceProvider::UpdateSubjectSettings(
+	const FName SubjectName, TFunctionRef<bool(FUnrealLiveLinkCInterfaceSubjectSettings &)> Edit)
+{
+	TSharedRef<FUnrealLiveLinkCInterfaceSubject> Subject = FindOrAddSubject(SubjectName);
+	FScopeLock SubjectLock(&Subject->Lock);
+
+	TSharedRef<FUnrealLiveLinkCInterfaceSubjectSettings> Settings = MakeShared<FUnrealLiveLinkCInterfaceSubjectSettings>(*Subject->Settings);
+	if (!Edit(*Settings))
+	{
+		return false;
+	}
+
+	Subject->Settings = Settings;
+	return true;
+}
+
+bool FUnrealLiveLinkCInterfaceProvider::IsStaticDataCurrent(const FName SubjectName, const uint64 StaticDataHash)
+{
+	if (!IsStarted())
+	{
+		return false;
+	}
+
+	TSharedRef<FUnrealLiveLinkCInterfaceSubject> Subject = FindOrAddSubject(SubjectName);
+	FScopeLock SubjectLock(&Subject->Lock);
+
+	if (Subject->bHasStaticData && Subject->StaticDataHash == StaticDataHash)
+	{
+		StaticDataSkippedCount++;
+		return true;
+	}
+	return false;
+}
+
+bool FUnrealLiveLinkCInterfaceProvider::UpdateSubjectStaticData(
+	const FName SubjectName, TSubclassOf<ULiveLinkRole> Role, const uint64 StaticDataHash, FLiveLinkStaticDataStruct &&StaticData)
+{
+	TSharedPtr<ILiveLinkProvider> Provider = GetLiveLinkProvider();
+	if (!Provider.IsValid())
+	{
+		return false;
+	}
+
+	TSharedRef<FUnrealLiveLinkCInterfaceSubject> Subject = FindOrAddSubject(SubjectName);
+	FScopeLock SubjectLock(&Subject->Lock);
+
+	const int32 PropertyCount = StaticData.GetBaseData()->PropertyNames.Num();
+	if (!Provider->UpdateSubjectStaticData(SubjectName, Role, MoveTemp(StaticData)))
+	{
+		Subject->bHasStaticData = false;
+		return false;
+	}
+
+	Subject->StaticDataHash = StaticDataHash;
+	Subject->bHasStaticData = true;
+	Subject->PropertyCount = PropertyCount;
+	StaticDataAppliedCount++;
+	return true;
+}
+
+void FUnrealLiveLinkCInterfaceProvider::GetStaticDataStats(uint64 &OutAppliedCount, uint64 &OutSkippedCount) const
+{
+	OutAppliedCount = StaticDataAppliedCount;
+	OutSkippedCount = StaticDataSkippedCount;
+}
+
+bool FUnrealLiveLinkCInterfaceProvider::UpdateSubjectFrameData(const FName SubjectName, FLiveLinkFrameDataStruct &&FrameData)
+{
+	return SubmitFrame(SubjectName, nullptr, MoveTemp(FrameData)) == UNREAL_LIVE_LINK_OK;
+}
+
+int FUnrealLiveLinkCInterfaceProvider::UpdateSubjectFrameSparse(const FName SubjectName, const FSparseFrame &Sparse, FLiveLinkFrameDataStruct &&FrameData)
+{
+	return SubmitFrame(SubjectName, &Sparse, MoveTemp(FrameData));
+}
+
+int FUnrealLiveLinkCInterfaceProvider::SubmitFrame(const FName SubjectName, const FSparseFrame *Sparse, FLiveLinkFrameDataStruct &&FrameData)
+{
+	uint64 Generation = 0;
+	TSharedPtr<ILiveLinkProvider> Provider = GetLiveLinkProvider(Generation);
+	if (!Provider.IsValid())
+	{
+		return UNREAL_LIVE_LINK_FAILED;
+	}
+
+	if (bClockEnabled)
+	{
+		ApplyClock(FrameData);
+	}
+
+	TSharedRef<FUnrealLiveLinkCInterfaceSubject> Subject = FindOrAddSubject(SubjectName);
+	{
+		FScopeLock SubjectLock(&Subject->Lock);
+
+		// merged under the subject lock so producers updating different parts of the subject never lose each other's values
+		if (Sparse)
+		{
+			Subject->Cache.bEnabled = true;
+			if (!MergeSparseFrame(Subject->Cache, *Sparse, Subject->Settings->BoneParents.Num(), Subject->PropertyCount, FrameData))
+			{
+				return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+			}
+		}
+		else if (Subject->Cache.bEnabled)
+		{
+			CacheFrame(Subject->Cache, FrameData);
+		}
+
+		if (!ProcessFrame(*Subject, FrameData))
+		{
+			return UNREAL_LIVE_LINK_FAILED;
+		}
+
+		if (Subject->Settings->OutputRate <= 0.0)
+		{
+			return SendFrame(*Provider, SubjectName, *Subject, MoveTemp(FrameData)) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_FAILED;
+		}
+
+		// a stop since the provider was fetched has cleared the buffers (under this lock), the frame would outlive it
+		if (ProviderGeneration != Generation)
+		{
+			return UNREAL_LIVE_LINK_FAILED;
+		}
+
+		BufferFrame(Subject->Resample, MoveTemp(FrameData), FPlatformTime::Seconds());
+	}
+
+	// outside of the subject lock, stopping the thread waits for it and it takes subject locks
+	StartResampling(Generation);
+	return UNREAL_LIVE_LINK_OK;
+}
+
+void FUnrealLiveLinkCInterfaceProvider::SetSkeletonSetupStats(const UnrealLiveLink_SkeletonSetupStats &Stats)
+{
+	FScopeLock Lock(&SkeletonSetupStatsLock);
+	SkeletonSetupStats = Stats;
+}
+
+void FUnrealLiveLinkCInterfaceProvider::GetSkeletonSetupStats(UnrealLiveLink_SkeletonSetupStats &OutStats) const
+{
+	FScopeLock Lock(&SkeletonSetupStatsLock);
+	OutStats = SkeletonSetupStats;
+}
+
+void FUnrealLiveLinkCInterfaceProvider::GetValidationStats(UnrealLiveLink_ValidationStats &OutStats) const
+{
+	OutStats.checkedCount = ValidationCheckedCount;
+	OutStats.normalizedCount = ValidationNormalizedCount;
+	OutStats.repairedCount = ValidationRepairedCount;
+	OutStats.rejectedCount = ValidationRejectedCount;
+}
+
+void FUnrealLiveLinkCInterfaceProvider::GetExtrapolationStats(UnrealLiveLink_ExtrapolationStats &OutStats) const
+{
+	FScopeLock Lock(&ExtrapolationErrorLock);
+
+	OutStats.sampleCount = ExtrapolationError.SampleCount;
+	OutStats.meanTranslationError = ExtrapolationError.SampleCount ? ExtrapolationError.TranslationErrorSum / ExtrapolationError.SampleCount : 0.0;
+	OutStats.maxTranslationError = ExtrapolationError.MaxTranslationError;
+	OutStats.meanRotationError = ExtrapolationError.SampleCount ? ExtrapolationError.RotationErrorSum / ExtrapolationError.SampleCount : 0.0;
+	OutStats.maxRotationError = ExtrapolationError.MaxRotationError;
+}
+
+void FUnrealLiveLinkCInterfaceProvider::SetClockSettings(const UnrealLiveLink_ClockSettings &Settings)
+{
+	FScopeLock Lock(&ClockLock);
+	ClockSettings = Settings;
+	Clock = FFrameClockState();
+	bClockEnabled = ClockSettings.timeScale > 0.0;
+}
+
+void FUnrealLiveLinkCInterfaceProvider::GetClockStats(UnrealLiveLink_ClockStats &OutStats) const
+{
+	FScopeLock Lock(&ClockLock);
+	OutStats.offset = Clock.Offset;
+	OutStats.drift = Clock.Drift;
+	OutStats.jitter = Clock.Jitter;
+	OutStats.sampleCount = Clock.Samples.Num();
+}
+
+void FUnrealLiveLinkCInterfaceProvider::ApplyClock(FLiveLinkFrameDataStruct &FrameData)
+{
+	// seconds of frames estimated over when not set
+	const double DefaultClockWindow = 10.0;
+
+	FScopeLock Lock(&ClockLock);
+	if (ClockSettings.timeScale <= 0.0)
+	{
+		return;
+	}
+
+	FLiveLinkBaseFrameData *BaseData = FrameData.GetBaseData();
+	const double ProducerTime = BaseData->WorldTime.GetSourceTime() * ClockSettings.timeScale;
+	const double Window = ClockSettings.window > 0.0 ? ClockSettings.window : DefaultClockWindow;
+	const double ClockTime = EstimateFrameClock(Clock, ProducerTime, FPlatformTime::Seconds(), Window);
+
+	if (ClockSettings.rewriteWorldTime)
+	{
+		BaseData->WorldTime = ClockTime;
+	}
+}
+
+bool FUnrealLiveLinkCInterfaceProvider::ProcessFrame(FUnrealLiveLinkCInterfaceSubject &Subject, FLiveLinkFrameDataStruct &FrameData)
+{
+	const FUnrealLiveLinkCInterfaceSubjectSettings &Settings = *Subject.Settings;
+
+	if (Settings.ValidationMode != UNREAL_LIVE_LINK_VALIDATION_OFF)
+	{
+		uint64 NormalizedCount = 0;
+		const EFrameValidationResult Result = ValidateFrame(Settings.ValidationMode, Settings.MaxAbsValue, Subject.Validation, FrameData, NormalizedCount);
+
+		ValidationCheckedCount++;
+		if (NormalizedCount)
+		{
+			ValidationNormalizedCount += NormalizedCount;
+		}
+		if (Result == EFrameValidationResult::Repaired)
+		{
+			ValidationRepairedCount++;
+		}
+		else if (Result == EFrameValidationResult::Rejected)
+		{
+			ValidationRejectedCount++;
+			return false;
+		}
+	}
+
+	if (Settings.bFiltered)
+	{
+		FilterFrame(Settings.Filters, Subject.Filter, FrameData);
+	}
+
+	return true;
+}
+
+bool FUnrealLiveLinkCInterfaceProvider::SendFrame(
+	ILiveLinkProvider &Provider, const FName SubjectName, FUnrealLiveLinkCInterfaceSubject &Subject, FLiveLinkFrameDataStruct &&FrameData)
+{
+	const UnrealLiveLink_ExtrapolationSettings &Extrapolation = Subject.Settings->Extrapolation;
+	if (Extrapolation.horizon > 0.0f)
+	{
+		FExtrapolationError Error;
+		ExtrapolateFrame(Extrapolation, Subject.Extrapolation, FrameData, Error);
+
+		if (Error.SampleCount)
+		{
+			FScopeLock Lock(&ExtrapolationErrorLock);
+			ExtrapolationError.Add(Error);
+		}
+	}
+
+	return Provider.UpdateSubjectFrameData(SubjectName, MoveTemp(FrameData));
+}
+
+void FUnrealLiveLinkCInterfaceProvider::StartResampling(const uint64 Generation)
+{
+	// every buffered frame gets here, only take the lock when the thread may need starting
+	if (bResampleThreadRunning)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&ResampleThreadLock);
+	// a stop after the frame's provider was fetched has already stopped the thread, or is waiting for this lock to stop it
+	if (ResampleThread.IsValid() || ProviderGeneration != Generation)
+	{
+		return;
+	}
+
+	bStopResampling = false;
+	ResampleEvent = FPlatformProcess::GetSynchEventFromPool();
+	ResampleThread = MakeUnique<FThread>(TEXT("UnrealLiveLinkCInterfaceResample"), [this]() { RunResampling(); });
+	bResampleThreadRunning = true;
+}
+
+void FUnrealLiveLinkCInterfaceProvider::StopResampling()
+{
+	FScopeLock Lock(&ResampleThreadLock);
+	if (!ResampleThread.IsValid())
+	{
+		return;
+	}
+
+	bStopResampling = true;
+	ResampleEvent->Trigger();
+	ResampleThread->Join();
+	ResampleThread.Reset();
+	bResampleThreadRunning = false;
+
+	FPlatformProcess::ReturnSynchEventToPool(ResampleEvent);
+	ResampleEvent = nullptr;
+}
+
+void FUnrealLiveLinkCInterfaceProvider::RunResampling()
+{
+	// longest wait when no subject is due, picks up subjects that start resampling
+	const double IdleWait = 0.1;
+
+	TArray<TPair<FName, TSharedRef<FUnrealLiveLinkCInterfaceSubject>>> Snapshot;
+
+	while (!bStopResampling)
+	{
+		double NextWakeTime = FPlatformTime::Seconds() + IdleWait;
+
+		TSharedPtr<ILiveLinkProvider> Provider = GetLiveLinkProvider();
+		if (Provider.IsValid())
+		{
+			{
+				FReadScopeLock Lock(SubjectsLock);
+				Snapshot.Reset();
+				for (TPair<FName, TSharedRef<FUnrealLiveLinkCInterfaceSubject>> &Subject : Subjects)
+				{
+					Snapshot.Add(Subject);
+				}
+			}
+
+			for (TPair<FName, TSharedRef<FUnrealLiveLinkCInterfaceSubject>> &Entry : Snapshot)
+			{
+				FUnrealLiveLinkCInterfaceSubject &Subject = *Entry.Value;
+				FScopeLock SubjectLock(&Subject.Lock);
+
+				const FUnrealLiveLinkCInterfaceSubjectSettings &Settings = *Subject.Settings;
+				FFrameResampleState &Resample = Subject.Resample;
+				if (Settings.OutputRate <= 0.0 || Resample.Frames.Num() == 0)
+				{
+					continue;
+				}
+
+				const double Period = 1.0 / Settings.OutputRate;
+				const double Now = FPlatformTime::Seconds();
+
+				// restart the schedule when first emitting or after falling more than a period behind
+				if (Resample.NextEmitTime == 0.0 || Resample.NextEmitTime < Now - Period)
+				{
+					Resample.NextEmitTime = Now;
+				}
+
+				if (Resample.NextEmitTime <= Now)
+				{
+					// map the scheduled platform time onto the subject's world time through the newest input frame
+					const double NewestTime = Resample.Frames.Last().GetBaseData()->WorldTime.GetSourceTime();
+					const double SampleTime = NewestTime + (Resample.NextEmitTime - Resample.LatestArrivalTime) - Settings.ResampleDelay;
+
+					FLiveLinkFrameDataStruct FrameData;
+					if (ResampleFrame(Resample, SampleTime, Period, FrameData))
+					{
+						SendFrame(*Provider, Entry.Key, Subject, MoveTemp(FrameData));
+					}
+
+					Resample.NextEmitTime += Period;
+				}
+
+				NextWakeTime = FMath::Min(NextWakeTime, Resample.NextEmitTime);
+			}
+		}
+
+		const double WaitTime = NextWakeTime - FPlatformTime::Seconds();
+		if (WaitTime > 0.0)
+		{
+			ResampleEvent->Wait(FTimespan::FromSeconds(WaitTime));
+		}
+	}
+}
+
+TSharedPtr<ILiveLinkProvider> FUnrealLiveLinkCInterfaceProvider::GetLiveLinkProvider() const
+{
+	FReadScopeLock Lock(LiveLinkProviderLock);
+	return LiveLinkProvider;
+}
+
+TSharedPtr<ILiveLinkProvider> FUnrealLiveLinkCInterfaceProvider::GetLiveLinkProvider(uint64 &OutGeneration) const
+{
+	FReadScopeLock Lock(LiveLinkProviderLock);
+	OutGeneration = ProviderGeneration;
+	return LiveLinkProvider;
+}
+
+void FUnrealLiveLinkCInterfaceProvider::OnConnectionStatusChanged()
+{
+	{
+		// the first change after starting is the connection, not asking the provider as it may be broadcasting under its lock
+		FScopeLock Lock(&ConnectionStatsLock);
+		ConnectionChangeCount++;
+		if (FirstConnectionTime == 0.0 && StartTime > 0.0)
+		{
+			FirstConnectionTime = FPlatformTime::Seconds();
+		}
+	}
+
+	TArray<void (*)()> Callbacks;
+	{
+		FScopeLock Lock(&CallbackLock);
+		Callbacks = ConnectionCallbacks;
+	}
+
+	for (const TArray<void (*)()>::ElementType &Callback : Callbacks)
+	{
+		Callback();
+	}
+}
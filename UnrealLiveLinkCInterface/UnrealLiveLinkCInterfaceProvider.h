@@ -0,0 +1,207 @@
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Event.h"
+#include "HAL/Thread.h"
+#include "Misc/ScopeRWLock.h"
+#include "Templates/Function.h"
+#include "LiveLinkProvider.h"
+#include "LiveLinkTypes.h"
+#include "UnrealLiveLinkCInterfaceFrameProcessing.h"
+#include "UnrealLiveLinkCInterfaceTypes.h"
+
+#include <atomic>
+
+
+/**
+ * per subject settings made at structure time
+ * never modified once shared, changes replace the whole settings so frames can be built from a snapshot without a lock
+ */
+struct FUnrealLiveLinkCInterfaceSubjectSettings
+{
+	// animation role bone parents from the animation structure
+	TArray<int32> BoneParents;
+
+	// animation frames arrive in world space and are converted to parent-local
+	bool bWorldSpaceTransforms = false;
+
+	// how the rotation of each transform is given, Euler angles are converted to quaternions
+	UnrealLiveLink_RotationOrder RotationOrder = UNREAL_LIVE_LINK_ROTATION_QUATERNION;
+	bool bRadians = false;
+
+	// frame validation before sending
+	UnrealLiveLink_ValidationMode ValidationMode = UNREAL_LIVE_LINK_VALIDATION_OFF;
+	float MaxAbsValue = 0.0f;
+
+	// filter parameters by UnrealLiveLink_FilterChannel, all disabled by default
+	UnrealLiveLink_FilterSettings Filters[UNREAL_LIVE_LINK_FILTER_CHANNEL_COUNT] = {};
+	bool bFiltered = false;
+
+	// frames are emitted at this rate (Hz) from the provider's resampling thread, 0 sends them as they arrive
+	double OutputRate = 0.0;
+	// seconds the output lags the newest input so it can interpolate between input frames
+	double ResampleDelay = 0.0;
+
+	// prediction applied just before sending, a horizon of 0 disables it
+	UnrealLiveLink_ExtrapolationSettings Extrapolation = {};
+};
+
+/**
+ * per subject state, sharded so threads updating different subjects never share a lock
+ * all calls for one subject are serialized by its Lock
+ */
+struct FUnrealLiveLinkCInterfaceSubject
+{
+	FCriticalSection Lock;
+
+	TSharedRef<const FUnrealLiveLinkCInterfaceSubjectSettings> Settings = MakeShared<FUnrealLiveLinkCInterfaceSubjectSettings>();
+
+	// content hash of the static data last sent to Unreal
+	uint64 StaticDataHash = 0;
+	bool bHasStaticData = false;
+	// number of properties in that static data
+	int32 PropertyCount = 0;
+
+	// state of the frame processing stages, guarded by Lock
+	FFrameValidationState Validation;
+	FFrameFilterState Filter;
+	FFrameResampleState Resample;
+	FFrameExtrapolationState Extrapolation;
+
+	// last frame before processing, for merging sparse updates into, guarded by Lock
+	FFrameCacheState Cache;
+};
+
+/**
+ * a named Live Link Message Bus Provider and the subjects it owns
+ * each instance appears as its own source in Unreal and has its own connection callbacks
+ *
+ * concurrency: all methods are thread safe. The Live Link provider and the subject table are behind
+ * read/write locks, written only by Start and Stop and when a subject is first seen. Updates to the
+ * same subject are serialized by the subject lock, updates to different subjects run concurrently up
+ * to the hand-off to the ILiveLinkProvider which serializes internally. The other provider wide locks
+ * taken per frame are ClockLock when a clock estimate is set and ExtrapolationErrorLock when
+ * extrapolation has an error sample to add.
+ */
+class FUnrealLiveLinkCInterfaceProvider
+{
+public:
+	explicit FUnrealLiveLinkCInterfaceProvider(const FString &InProviderName);
+	~FUnrealLiveLinkCInterfaceProvider();
+
+	void SetProviderName(const FString &InProviderName);
+	FString GetProviderName() const;
+
+	int Start();
+	int Stop();
+	bool IsStarted() const;
+	bool HasConnection() const;
+
+	void RegisterConnectionCallback(void (*Callback)());
+	void GetConnectionStats(UnrealLiveLink_ConnectionStats &OutStats) const;
+
+	TSharedRef<FUnrealLiveLinkCInterfaceSubject> FindOrAddSubject(const FName SubjectName);
+
+	TSharedRef<const FUnrealLiveLinkCInterfaceSubjectSettings> GetSubjectSettings(const FName SubjectName);
+	// Edit is applied to a copy of the subject settings which replaces them if Edit returns true
+	bool UpdateSubjectSettings(const FName SubjectName, TFunctionRef<bool(FUnrealLiveLinkCInterfaceSubjectSettings &)> Edit);
+
+	// true (and counted as skipped) if the static data with this hash was the last sent for the subject
+	bool IsStaticDataCurrent(const FName SubjectName, const uint64 StaticDataHash);
+	bool UpdateSubjectStaticData(
+		const FName SubjectName, TSubclassOf<ULiveLinkRole> Role, const uint64 StaticDataHash, FLiveLinkStaticDataStruct &&StaticData);
+	void GetStaticDataStats(uint64 &OutAppliedCount, uint64 &OutSkippedCount) const;
+	void SetSkeletonSetupStats(const UnrealLiveLink_SkeletonSetupStats &Stats);
+	void GetSkeletonSetupStats(UnrealLiveLink_SkeletonSetupStats &OutStats) const;
+	// false if the frame is rejected by the subject's processing or not accepted by Live Link
+	bool UpdateSubjectFrameData(const FName SubjectName, FLiveLinkFrameDataStruct &&FrameData);
+	// merge the sparse values into the subject's last frame (FrameData gives the rest of the frame) and send it like UpdateSubjectFrameData
+	int UpdateSubjectFrameSparse(const FName SubjectName, const FSparseFrame &Sparse, FLiveLinkFrameDataStruct &&FrameData);
+	void GetValidationStats(UnrealLiveLink_ValidationStats &OutStats) const;
+	void GetExtrapolationStats(UnrealLiveLink_ExtrapolationStats &OutStats) const;
+	// replaces the clock settings and restarts the estimate
+	void SetClockSettings(const UnrealLiveLink_ClockSettings &Settings);
+	void GetClockStats(UnrealLiveLink_ClockStats &OutStats) const;
+
+private:
+	TSharedPtr<ILiveLinkProvider> GetLiveLinkProvider() const;
+	// also the generation of the provider, changed by every start and stop
+	TSharedPtr<ILiveLinkProvider> GetLiveLinkProvider(uint64 &OutGeneration) const;
+	void OnConnectionStatusChanged();
+
+	// add the frame to the clock estimate and rewrite its world time if configured
+	void ApplyClock(FLiveLinkFrameDataStruct &FrameData);
+
+	// process and send or buffer a frame, merged with the subject's last frame first if Sparse is given
+	int SubmitFrame(const FName SubjectName, const FSparseFrame *Sparse, FLiveLinkFrameDataStruct &&FrameData);
+
+	// run the subject's processing stages on a frame, false if the frame is to be dropped (subject lock held)
+	bool ProcessFrame(FUnrealLiveLinkCInterfaceSubject &Subject, FLiveLinkFrameDataStruct &FrameData);
+	// hand a processed frame to Live Link (subject lock held)
+	bool SendFrame(ILiveLinkProvider &Provider, const FName SubjectName, FUnrealLiveLinkCInterfaceSubject &Subject, FLiveLinkFrameDataStruct &&FrameData);
+
+	// resampled subjects are emitted by a thread started with the first buffered frame and stopped with the provider,
+	// a frame buffered for an earlier provider Generation doesn't start it
+	void StartResampling(const uint64 Generation);
+	void StopResampling();
+	void RunResampling();
+
+	// guards the provider name and the delegate handle, serializes starting and stopping
+	mutable FCriticalSection ProviderLock;
+	FString ProviderName;
+	FDelegateHandle ConnectionStatusChangedHandle;
+	// the Live Link provider and its generation are only written by Start and Stop (holding ProviderLock too),
+	// every frame reads them so readers share the lock rather than queue on ProviderLock
+	mutable FRWLock LiveLinkProviderLock;
+	TSharedPtr<ILiveLinkProvider> LiveLinkProvider;
+	// also read without the lock by frames checking they are still current
+	std::atomic<uint64> ProviderGeneration{0};
+
+	FCriticalSection CallbackLock;
+	TArray<void (*)()> ConnectionCallbacks;
+
+	// platform times of the last start and the first connection change after it (0 if none yet)
+	mutable FCriticalSection ConnectionStatsLock;
+	double StartTime = 0.0;
+	double FirstConnectionTime = 0.0;
+	uint64 ConnectionChangeCount = 0;
+
+	FRWLock SubjectsLock;
+	TMap<FName, TSharedRef<FUnrealLiveLinkCInterfaceSubject>> Subjects;
+
+	std::atomic<uint64> StaticDataAppliedCount{0};
+	std::atomic<uint64> StaticDataSkippedCount{0};
+
+	// cost of the last animation structure built
+	mutable FCriticalSection SkeletonSetupStatsLock;
+	UnrealLiveLink_SkeletonSetupStats SkeletonSetupStats = {};
+
+	std::atomic<uint64> ValidationCheckedCount{0};
+	std::atomic<uint64> ValidationNormalizedCount{0};
+	std::atomic<uint64> ValidationRepairedCount{0};
+	std::atomic<uint64> ValidationRejectedCount{0};
+
+	mutable FCriticalSection ExtrapolationErrorLock;
+	FExtrapolationError ExtrapolationError;
+
+	// the producer clock is shared by all subjects, the lock is only taken when the estimate is on
+	mutable FCriticalSection ClockLock;
+	UnrealLiveLink_ClockSettings ClockSettings = {};
+	FFrameClockState Clock;
+	std::atomic<bool> bClockEnabled{false};
+
+	FCriticalSection ResampleThreadLock;
+	TUniquePtr<FThread> ResampleThread;
+	FEvent *ResampleEvent = nullptr;
+	std::atomic<bool> bStopResampling{false};
+	// ResampleThread.IsValid() for checking without ResampleThreadLock
+	std::atomic<bool> bResampleThreadRunning{false};
+};
+
+// tick the core ticker, serialized as multiple providers, the ticker thread and callers pumping may tick from different threads
+void UnrealLiveLink_TickCoreTicker();
+// run the core ticker thread at Rate (Hz), 0 stops it
+void UnrealLiveLink_SetCoreTickerRate(double Rate);
+void UnrealLiveLink_GetCoreTickerStats(UnrealLiveLink_TickerStats &OutStats);
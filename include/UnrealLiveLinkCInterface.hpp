@@ -0,0 +1,472 @@
+/** 
+ * Copyright (c) 2020 Patrick Palmer, The Jim Henson Company.
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Header only C++20 layer over the C API
+ *
+ * Everything is inline and only builds the same small structures a C caller would build on the stack,
+ * per frame data is passed by pointer from the caller's spans without copies. Results are the
+ * UNREAL_LIVE_LINK_* codes of the C API, nothing throws. Calls the loaded shared object doesn't support
+ * (or made with nothing loaded) return UNREAL_LIVE_LINK_NOT_LOADED.
+ */
+
+#ifndef _UNREAL_LIVE_LINK_C_INTERFACE_HPP
+#define _UNREAL_LIVE_LINK_C_INTERFACE_HPP 1
+
+#include "UnrealLiveLinkCInterfaceAPI.h"
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace UnrealLiveLink
+{
+
+// UNREAL_LIVE_LINK_* result code
+typedef int Result;
+
+/**
+ * the loaded shared object, unloaded with the object
+ * must not be created or destroyed while any other call is in flight
+ */
+class Library
+{
+public:
+#ifdef WIN32
+	static constexpr const char *DefaultFilename = "UnrealLiveLinkCInterface.dll";
+#else
+	static constexpr const char *DefaultFilename = "libUnrealLiveLinkCInterface.so";
+#endif
+
+	explicit Library(const char *SharedObjectFilename = DefaultFilename)
+		: LoadResult(UnrealLiveLink_Load(SharedObjectFilename))
+	{
+	}
+
+	~Library()
+	{
+		if (IsLoaded())
+		{
+			UnrealLiveLink_Unload();
+		}
+	}
+
+	Library(const Library &) = delete;
+	Library &operator=(const Library &) = delete;
+
+	bool IsLoaded() const { return LoadResult == UNREAL_LIVE_LINK_OK; }
+	Result GetResult() const { return LoadResult; }
+
+	// UNREAL_LIVE_LINK_CAPABILITY_* bits
+	unsigned int GetCapabilities() const { return UnrealLiveLink_GetCapabilities(); }
+
+private:
+	Result LoadResult;
+};
+
+namespace Detail
+{
+
+// UNREAL_LIVE_LINK_NOT_LOADED instead of calling a function the loaded shared object doesn't have (or with nothing loaded)
+template <typename... Params, typename... Args>
+inline Result Call(Result (*Function)(Params...), Args &&...Arguments)
+{
+	return Function ? Function(std::forward<Args>(Arguments)...) : UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+// optional functions are only called if the shared object reports their UNREAL_LIVE_LINK_CAPABILITY_* bit
+template <typename... Params, typename... Args>
+inline Result CallOptional(unsigned int Capability, Result (*Function)(Params...), Args &&...Arguments)
+{
+	return (UnrealLiveLink_GetCapabilities() & Capability) ? Call(Function, std::forward<Args>(Arguments)...) : UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+inline UnrealLiveLink_PropertyValues MakePropertyValues(std::span<const float> Values)
+{
+	UnrealLiveLink_PropertyValues PropValues;
+	PropValues.values = const_cast<float *>(Values.data());
+	PropValues.valueCount = static_cast<int>(Values.size());
+	return PropValues;
+}
+
+// names for the packed structure calls, structures are set rarely so the copy here is not on the frame path
+class PackedNames
+{
+public:
+	explicit PackedNames(std::span<const std::string_view> Names)
+	{
+		Offsets.reserve(Names.size());
+		Lengths.reserve(Names.size());
+		for (std::string_view Name : Names)
+		{
+			Offsets.push_back(static_cast<int>(Text.size()));
+			Lengths.push_back(static_cast<int>(Name.size()));
+			Text.append(Name);
+		}
+
+		Strings.text = Text.data();
+		Strings.offsets = Offsets.data();
+		Strings.lengths = Lengths.data();
+		Strings.count = static_cast<int>(Offsets.size());
+	}
+
+	const UnrealLiveLink_PackedStrings *Get() const { return &Strings; }
+
+private:
+	std::string Text;
+	std::vector<int> Offsets;
+	std::vector<int> Lengths;
+	UnrealLiveLink_PackedStrings Strings;
+};
+
+// names for the fixed size structure calls
+class FixedNames
+{
+public:
+	explicit FixedNames(std::span<const std::string_view> InNames)
+		: Names(InNames.size())
+	{
+		for (size_t Idx = 0; Idx < InNames.size(); Idx++)
+		{
+			std::string Name(InNames[Idx]);
+			UnrealLiveLink_CopyName(Name.c_str(), Names[Idx].Name);
+		}
+
+		Properties.names = Names.empty() ? nullptr : &Names[0].Name;
+		Properties.nameCount = static_cast<int>(Names.size());
+	}
+
+	const UnrealLiveLink_Properties *Get() const { return &Properties; }
+
+private:
+	struct FixedName
+	{
+		UnrealLiveLink_Name Name;
+	};
+	static_assert(sizeof(FixedName) == sizeof(UnrealLiveLink_Name));
+
+	std::vector<FixedName> Names;
+	UnrealLiveLink_Properties Properties;
+};
+
+} // namespace Detail
+
+/**
+ * a started Message Bus Provider, stopped with the object (and destroyed if it was created by it)
+ * the default constructed provider is UNREAL_LIVE_LINK_DEFAULT_PROVIDER
+ */
+class Provider
+{
+public:
+	Provider()
+		: Handle(UNREAL_LIVE_LINK_DEFAULT_PROVIDER), bOwned(false)
+	{
+		StartResult = Detail::Call(UnrealLiveLink_StartProvider, Handle);
+	}
+
+	explicit Provider(const char *ProviderName)
+		: Handle(UnrealLiveLink_CreateProvider ? UnrealLiveLink_CreateProvider(ProviderName) : UNREAL_LIVE_LINK_NO_PROVIDER), bOwned(true)
+	{
+		if (IsValid())
+		{
+			StartResult = Detail::Call(UnrealLiveLink_StartProvider, Handle);
+		}
+		else
+		{
+			StartResult = UnrealLiveLink_CreateProvider ? UNREAL_LIVE_LINK_INVALID_PROVIDER : UNREAL_LIVE_LINK_NOT_LOADED;
+		}
+	}
+
+	~Provider()
+	{
+		Release();
+	}
+
+	Provider(const Provider &) = delete;
+	Provider &operator=(const Provider &) = delete;
+
+	Provider(Provider &&Other) noexcept
+		: Handle(std::exchange(Other.Handle, UNREAL_LIVE_LINK_NO_PROVIDER)), bOwned(Other.bOwned), StartResult(Other.StartResult)
+	{
+	}
+
+	Provider &operator=(Provider &&Other) noexcept
+	{
+		if (this != &Other)
+		{
+			Release();
+			Handle = std::exchange(Other.Handle, UNREAL_LIVE_LINK_NO_PROVIDER);
+			bOwned = Other.bOwned;
+			StartResult = Other.StartResult;
+		}
+		return *this;
+	}
+
+	bool IsValid() const { return Handle != UNREAL_LIVE_LINK_NO_PROVIDER; }
+	int GetHandle() const { return Handle; }
+	Result GetResult() const { return StartResult; }
+
+	bool HasConnection() const { return Detail::Call(UnrealLiveLink_ProviderHasConnection, Handle) == UNREAL_LIVE_LINK_OK; }
+
+	// called on a message bus thread, see UnrealLiveLink_RegisterProviderConnectionUpdateCallback
+	Result RegisterConnectionCallback(void (*Callback)()) const { return Detail::Call(UnrealLiveLink_RegisterProviderConnectionUpdateCallback, Handle, Callback); }
+
+private:
+	void Release()
+	{
+		if (!IsValid())
+		{
+			return;
+		}
+
+		if (bOwned)
+		{
+			Detail::Call(UnrealLiveLink_DestroyProvider, Handle);
+		}
+		else
+		{
+			Detail::Call(UnrealLiveLink_StopProvider, Handle);
+		}
+		Handle = UNREAL_LIVE_LINK_NO_PROVIDER;
+	}
+
+	int Handle;
+	bool bOwned;
+	Result StartResult;
+};
+
+/**
+ * a named subject of a provider, the derived classes fix its role at compile time
+ * the provider must outlive its subjects
+ */
+class Subject
+{
+public:
+	const char *GetName() const { return Name.c_str(); }
+	int GetProviderHandle() const { return ProviderHandle; }
+
+protected:
+	Subject(const Provider &InProvider, std::string InName)
+		: ProviderHandle(InProvider.GetHandle()), Name(std::move(InName))
+	{
+	}
+
+	int ProviderHandle;
+	std::string Name;
+};
+
+class BasicSubject : public Subject
+{
+public:
+	BasicSubject(const Provider &InProvider, std::string InName) : Subject(InProvider, std::move(InName)) {}
+
+	Result SetStructure(std::span<const std::string_view> PropertyNames) const
+	{
+		Detail::PackedNames Names(PropertyNames);
+		return Detail::Call(UnrealLiveLink_ProviderSetBasicStructurePacked, ProviderHandle, GetName(), Names.Get());
+	}
+
+	Result Update(double WorldTime, std::span<const float> PropertyValues, const UnrealLiveLink_Metadata *Metadata = nullptr) const
+	{
+		const UnrealLiveLink_PropertyValues PropValues = Detail::MakePropertyValues(PropertyValues);
+		return Detail::Call(UnrealLiveLink_ProviderUpdateBasicFrame, ProviderHandle, GetName(), WorldTime, Metadata, &PropValues);
+	}
+
+	// PropertyValues[i] replaces property PropertyIndices[i] of the last frame
+	Result UpdateSparse(double WorldTime, std::span<const int> PropertyIndices, std::span<const float> PropertyValues,
+		const UnrealLiveLink_PackedMetadata *Metadata = nullptr) const
+	{
+		if (PropertyIndices.size() != PropertyValues.size())
+		{
+			return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+		}
+
+		const UnrealLiveLink_SparsePropertyValues PropValues{ PropertyIndices.data(), PropertyValues.data(), static_cast<int>(PropertyValues.size()) };
+		return Detail::CallOptional(UNREAL_LIVE_LINK_CAPABILITY_SPARSE, UnrealLiveLink_ProviderUpdateBasicFrameSparse, ProviderHandle, GetName(), WorldTime, Metadata, &PropValues);
+	}
+};
+
+class TransformSubject : public Subject
+{
+public:
+	TransformSubject(const Provider &InProvider, std::string InName) : Subject(InProvider, std::move(InName)) {}
+
+	Result SetStructure(std::span<const std::string_view> PropertyNames = {}) const
+	{
+		Detail::FixedNames Names(PropertyNames);
+		return Detail::Call(UnrealLiveLink_ProviderSetTransformStructure, ProviderHandle, GetName(), Names.Get());
+	}
+
+	Result Update(double WorldTime, const UnrealLiveLink_Transform &Frame,
+		std::span<const float> PropertyValues = {}, const UnrealLiveLink_Metadata *Metadata = nullptr) const
+	{
+		const UnrealLiveLink_PropertyValues PropValues = Detail::MakePropertyValues(PropertyValues);
+		return Detail::Call(UnrealLiveLink_ProviderUpdateTransformFrame, ProviderHandle, GetName(), WorldTime, Metadata, &PropValues, &Frame);
+	}
+
+	Result Update(double WorldTime, const UnrealLiveLink_Matrix &Frame,
+		std::span<const float> PropertyValues = {}, const UnrealLiveLink_Metadata *Metadata = nullptr) const
+	{
+		const UnrealLiveLink_PropertyValues PropValues = Detail::MakePropertyValues(PropertyValues);
+		return Detail::Call(UnrealLiveLink_ProviderUpdateTransformFrameMatrix, ProviderHandle, GetName(), WorldTime, Metadata, &PropValues, &Frame);
+	}
+};
+
+class AnimationSubject : public Subject
+{
+public:
+	AnimationSubject(const Provider &InProvider, std::string InName) : Subject(InProvider, std::move(InName)) {}
+
+	// ParentIndices has one entry per bone, -1 for a root
+	Result SetStructure(std::span<const std::string_view> BoneNames, std::span<const int> ParentIndices,
+		std::span<const std::string_view> PropertyNames = {}) const
+	{
+		if (BoneNames.size() != ParentIndices.size())
+		{
+			return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+		}
+
+		Detail::PackedNames Names(PropertyNames);
+		Detail::PackedNames Bones(BoneNames);
+
+		UnrealLiveLink_PackedAnimationStatic AnimStructure;
+		AnimStructure.boneNames = *Bones.Get();
+		AnimStructure.parentIndices = ParentIndices.data();
+		return Detail::Call(UnrealLiveLink_ProviderSetAnimationStructurePacked, ProviderHandle, GetName(), Names.Get(), &AnimStructure);
+	}
+
+	// structure shared through UnrealLiveLink_RegisterSkeletonTemplate
+	Result SetStructure(int SkeletonTemplate) const
+	{
+		return Detail::Call(UnrealLiveLink_ProviderSetAnimationStructureFromTemplate, ProviderHandle, GetName(), SkeletonTemplate);
+	}
+
+	Result Update(double WorldTime, std::span<const UnrealLiveLink_Transform> Transforms,
+		std::span<const float> PropertyValues = {}, const UnrealLiveLink_Metadata *Metadata = nullptr) const
+	{
+		UnrealLiveLink_Animation Frame;
+		Frame.transforms = const_cast<UnrealLiveLink_Transform *>(Transforms.data());
+		Frame.transformCount = static_cast<int>(Transforms.size());
+
+		const UnrealLiveLink_PropertyValues PropValues = Detail::MakePropertyValues(PropertyValues);
+		return Detail::Call(UnrealLiveLink_ProviderUpdateAnimationFrame, ProviderHandle, GetName(), WorldTime, Metadata, &PropValues, &Frame);
+	}
+
+	Result Update(double WorldTime, std::span<const UnrealLiveLink_Matrix> Matrices,
+		std::span<const float> PropertyValues = {}, const UnrealLiveLink_Metadata *Metadata = nullptr) const
+	{
+		UnrealLiveLink_AnimationMatrices Frame;
+		Frame.matrices = const_cast<UnrealLiveLink_Matrix *>(Matrices.data());
+		Frame.matrixCount = static_cast<int>(Matrices.size());
+
+		const UnrealLiveLink_PropertyValues PropValues = Detail::MakePropertyValues(PropertyValues);
+		return Detail::Call(UnrealLiveLink_ProviderUpdateAnimationFrameMatrices, ProviderHandle, GetName(), WorldTime, Metadata, &PropValues, &Frame);
+	}
+
+	// Transforms in source joint order, reordered by a map from UnrealLiveLink_CreateSkeletonMap
+	Result Update(double WorldTime, int SkeletonMap, std::span<const UnrealLiveLink_Transform> Transforms,
+		std::span<const float> PropertyValues = {}, const UnrealLiveLink_PackedMetadata *Metadata = nullptr) const
+	{
+		UnrealLiveLink_Animation Frame;
+		Frame.transforms = const_cast<UnrealLiveLink_Transform *>(Transforms.data());
+		Frame.transformCount = static_cast<int>(Transforms.size());
+
+		const UnrealLiveLink_PropertyValues PropValues = Detail::MakePropertyValues(PropertyValues);
+		return Detail::CallOptional(UNREAL_LIVE_LINK_CAPABILITY_SKELETON_MAPS, UnrealLiveLink_ProviderUpdateAnimationFrameMapped, ProviderHandle, GetName(), WorldTime, Metadata, &PropValues, SkeletonMap, &Frame);
+	}
+
+	// Transforms[i] replaces bone BoneIndices[i] and PropertyValues[i] property PropertyIndices[i] of the last frame
+	Result UpdateSparse(double WorldTime, std::span<const int> BoneIndices, std::span<const UnrealLiveLink_Transform> Transforms,
+		std::span<const int> PropertyIndices = {}, std::span<const float> PropertyValues = {}, const UnrealLiveLink_PackedMetadata *Metadata = nullptr) const
+	{
+		if (BoneIndices.size() != Transforms.size() || PropertyIndices.size() != PropertyValues.size())
+		{
+			return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+		}
+
+		const UnrealLiveLink_SparseTransforms Frame{ BoneIndices.data(), Transforms.data(), static_cast<int>(Transforms.size()) };
+		const UnrealLiveLink_SparsePropertyValues PropValues{ PropertyIndices.data(), PropertyValues.data(), static_cast<int>(PropertyValues.size()) };
+		return Detail::CallOptional(UNREAL_LIVE_LINK_CAPABILITY_SPARSE, UnrealLiveLink_ProviderUpdateAnimationFrameSparse, ProviderHandle, GetName(), WorldTime, Metadata, &PropValues, &Frame);
+	}
+};
+
+class CameraSubject : public Subject
+{
+public:
+	CameraSubject(const Provider &InProvider, std::string InName) : Subject(InProvider, std::move(InName)) {}
+
+	Result SetStructure(const UnrealLiveLink_CameraStatic &Structure, std::span<const std::string_view> PropertyNames = {}) const
+	{
+		Detail::FixedNames Names(PropertyNames);
+		UnrealLiveLink_CameraStatic CameraStructure = Structure;
+		return Detail::Call(UnrealLiveLink_ProviderSetCameraStructure, ProviderHandle, GetName(), Names.Get(), &CameraStructure);
+	}
+
+	Result Update(double WorldTime, const UnrealLiveLink_Camera &Frame,
+		std::span<const float> PropertyValues = {}, const UnrealLiveLink_Metadata *Metadata = nullptr) const
+	{
+		const UnrealLiveLink_PropertyValues PropValues = Detail::MakePropertyValues(PropertyValues);
+		return Detail::Call(UnrealLiveLink_ProviderUpdateCameraFrame, ProviderHandle, GetName(), WorldTime, Metadata, &PropValues, &Frame);
+	}
+
+	// the transform comes from Transform, the one in Frame is ignored
+	Result Update(double WorldTime, const UnrealLiveLink_Camera &Frame, const UnrealLiveLink_Matrix &Transform,
+		std::span<const float> PropertyValues = {}, const UnrealLiveLink_Metadata *Metadata = nullptr) const
+	{
+		const UnrealLiveLink_PropertyValues PropValues = Detail::MakePropertyValues(PropertyValues);
+		return Detail::Call(UnrealLiveLink_ProviderUpdateCameraFrameMatrix, ProviderHandle, GetName(), WorldTime, Metadata, &PropValues, &Frame, &Transform);
+	}
+};
+
+class LightSubject : public Subject
+{
+public:
+	LightSubject(const Provider &InProvider, std::string InName) : Subject(InProvider, std::move(InName)) {}
+
+	Result SetStructure(const UnrealLiveLink_LightStatic &Structure, std::span<const std::string_view> PropertyNames = {}) const
+	{
+		Detail::FixedNames Names(PropertyNames);
+		UnrealLiveLink_LightStatic LightStructure = Structure;
+		return Detail::Call(UnrealLiveLink_ProviderSetLightStructure, ProviderHandle, GetName(), Names.Get(), &LightStructure);
+	}
+
+	Result Update(double WorldTime, const UnrealLiveLink_Light &Frame,
+		std::span<const float> PropertyValues = {}, const UnrealLiveLink_Metadata *Metadata = nullptr) const
+	{
+		const UnrealLiveLink_PropertyValues PropValues = Detail::MakePropertyValues(PropertyValues);
+		return Detail::Call(UnrealLiveLink_ProviderUpdateLightFrame, ProviderHandle, GetName(), WorldTime, Metadata, &PropValues, &Frame);
+	}
+
+	// the transform comes from Transform, the one in Frame is ignored
+	Result Update(double WorldTime, const UnrealLiveLink_Light &Frame, const UnrealLiveLink_Matrix &Transform,
+		std::span<const float> PropertyValues = {}, const UnrealLiveLink_Metadata *Metadata = nullptr) const
+	{
+		const UnrealLiveLink_PropertyValues PropValues = Detail::MakePropertyValues(PropertyValues);
+		return Detail::Call(UnrealLiveLink_ProviderUpdateLightFrameMatrix, ProviderHandle, GetName(), WorldTime, Metadata, &PropValues, &Frame, &Transform);
+	}
+};
+
+} // namespace UnrealLiveLink
+
+#endif // _UNREAL_LIVE_LINK_C_INTERFACE_HPP
@@ -1,273 +1,709 @@
-/** 
- * Copyright (c) 2020 Patrick Palmer, The Jim Henson Company.
- * 
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files (the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions:
- * 
- * The above copyright notice and this permission notice shall be included in
- * all copies or substantial portions of the Software.
- * 
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
- * SOFTWARE.
- */
-
-#ifndef _UNREAL_LIVE_LINK_C_INTERFACE_API_H
-#define _UNREAL_LIVE_LINK_C_INTERFACE_API_H 1
-
-#include "UnrealLiveLinkCInterfaceTypes.h"
-
-#ifdef __cplusplus
-extern "C"
-{
-#endif
-
-/**
- * load the Unreal Live Link C Interface shared object
- * for the load to succeed, the Unreal Live Link C Interface version must match
- * @param cInterfaceSharedObjectFilename shared object filename
- * @return results (success returns UNREAL_LIVE_LINK_OK)
- */
-extern int UnrealLiveLink_Load(const char *cInterfaceSharedObjectFilename);
-
-/**
- * if Unreal Live Link C Interface shared object is loaded
- * @returns UNREAL_LIVE_LINK_OK if loaded, UNREAD_LIVE_LINK_NOT_LOADED if not
- */
-extern int UnrealLiveLink_IsLoaded(void);
-
-/**
- * unload Unreal Live Link C Interface shared object
- */
-extern void UnrealLiveLink_Unload(void);
-
-/**
- * set the name of the Message Bus Provider
- * @param providerName name of Live Link interface appearing in Unreal
- */
-extern void (*UnrealLiveLink_SetProviderName)(const char *providerName);
-
-/**
- * get the current version of the Unreal Live Link C Interface
- * the version integer is specific to this API and not matching against Unreal Versions
- * @return version of the Unreal Live Link C Interface (UNREAL_LIVE_LINK_API_VERSION value at compile time)
- */
-extern int (*UnrealLiveLink_GetVersion)(void);
-
-/**
- * start live link connection
- * @return results (success returns UNREAL_LIVE_LINK_OK)
- */
-extern int (*UnrealLiveLink_StartLiveLink)(void);
-
-/**
- * stop live link connection
- * @return results (success returns UNREAL_LIVE_LINK_OK)
- */
-extern int (*UnrealLiveLink_StopLiveLink)(void);
-
-/**
- * set a unicast endpoint
- * @return results (success returns UNREAL_LIVE_LINK_OK)
- */
-extern void (*UnrealLiveLink_SetUnicastEndpoint)(const char* Endpoint);
-
-/**
- * add a static endpoint
- * @return results (success returns UNREAL_LIVE_LINK_OK)
- */
-extern int (*UnrealLiveLink_AddStaticEndpoint)(const char* Endpoint);
-
-/**
- * remove a static endpoint
- * @return results (success returns UNREAL_LIVE_LINK_OK)
- */
-extern int (*UnrealLiveLink_RemoveStaticEndpoint)(const char* Endpoint);
-
-/**
- * register a function callback if the connection to Unreal changes
- * @param callback callback function
- */
-extern void (*UnrealLiveLink_RegisterConnectionUpdateCallback)(void (*callback)());
-
-/**
- * connection with Unreal?
- * @return UNREAL_LIVE_LINK_OK if connected, UNREAD_LIVE_LINK_NOT_CONNECTED if not
- */
-extern int (*UnrealLiveLink_HasConnection)();
-
-/**
- * initialize the Metadata structure with default values
- * @param metadata Metadata structure
- */
-extern void UnrealLiveLink_InitMetadata(struct UnrealLiveLink_Metadata *metadata);
-
-
-
-
-/** Basic Generic Roll **/
-
-/**
- * Basic Generic Roll setup
- * @param subjectName Unreal subject name
- * @param properties named float properties
- */
-extern void (*UnrealLiveLink_SetBasicStructure)(const char *subjectName, const struct UnrealLiveLink_Properties *properties);
-
-/**
- * Basic Generic Roll per frame values
- * @param subjectName Unreal subject name
- * @param worldTime frame time
- * @param metadata associated metadata (may pass in null for none)
- * @param propValues named properties float values (may pass in null for none)
- */
-extern void (*UnrealLiveLink_UpdateBasicFrame)(const char *subjectName, const double worldTime,
-	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues);
-
-
-
-/** Animation Roll **/
-
-/**
- * Animation Roll setup
- * @param subjectName Unreal subject name
- * @param properties named float properties
- */
-extern void (*UnrealLiveLink_SetAnimationStructure)(
-	const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_AnimationStatic *structure);
-
-/**
- * Animation Roll per frame values
- * @param subjectName Unreal subject name
- * @param worldTime frame time
- * @param metadata associated metadata (may pass in null for none)
- * @param propValues named properties float values (may pass in null for none)
- * @param frame animation frame
- */
-extern void (*UnrealLiveLink_UpdateAnimationFrame)(const char *subjectName, const double worldTime,
-	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
-	const struct UnrealLiveLink_Animation *frame);
-
-
-
-/** Transform Roll **/
-
-/**
- * initialize transform structure to identity
- * @param transform transform to set
- */
-extern void UnrealLiveLink_InitTransform(struct UnrealLiveLink_Transform *transform);
-
-/**
- * Transform Roll setup
- * @param subjectName Unreal subject name
- * @param properties named float properties
- */
-extern void (*UnrealLiveLink_SetTransformStructure)(const char *subjectName, const struct UnrealLiveLink_Properties *properties);
-
-/**
- * Transform Roll per frame values
- * @param subjectName Unreal subject name
- * @param worldTime frame time
- * @param metadata associated metadata (may pass in null for none)
- * @param propValues named properties float values (may pass in null for none)
- * @param frame transform
- */
-extern void (*UnrealLiveLink_UpdateTransformFrame)(const char *subjectName, const double worldTime,
-	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
-	const struct UnrealLiveLink_Transform *frame);
-
-
-
-/** Camera Roll **/
-
-/**
- * initialize camera static to default values
- * @param structure structure to set
- */
-extern void UnrealLiveLink_InitCameraStatic(struct UnrealLiveLink_CameraStatic *structure);
-
-/**
- * initialize camera per frame to default values
- * @param structure structure to set
- */
-extern void UnrealLiveLink_InitCamera(struct UnrealLiveLink_Camera *structure);
-
-/**
- * Camera Roll setup
- * @param subjectName Unreal subject name
- * @param properties named float properties
- */
-extern void (*UnrealLiveLink_SetCameraStructure)(
-	const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_CameraStatic *structure);
-
-/**
- * Camera Roll per frame values
- * @param subjectName Unreal subject name
- * @param worldTime frame time
- * @param metadata associated metadata (may pass in null for none)
- * @param propValues named properties float values (may pass in null for none)
- * @param frame camera values
- */
-extern void (*UnrealLiveLink_UpdateCameraFrame)(const char *subjectName, const double worldTime,
-	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues, const struct UnrealLiveLink_Camera *frame);
-
-
-
-/** Light Roll **/
-
-/**
- * initialize light static to default values
- * @param structure structure to set
- */
-extern void UnrealLiveLink_InitLightStatic(struct UnrealLiveLink_LightStatic *structure);
-
-/**
- * initialize light per frame to default values
- * @param structure structure to set
- */
-extern void UnrealLiveLink_InitLight(struct UnrealLiveLink_Light *structure);
-
-/**
- * Light Roll setup
- * @param subjectName Unreal subject name
- * @param properties named float properties
- */
-extern void (*UnrealLiveLink_SetLightStructure)(
-	const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_LightStatic *structure);
-
-/**
- * Light Roll per frame values
- * @param subjectName Unreal subject name
- * @param worldTime frame time
- * @param metadata associated metadata (may pass in null for none)
- * @param propValues named properties float values (may pass in null for none)
- * @param frame light values
- */
-extern void (*UnrealLiveLink_UpdateLightFrame)(const char *subjectName, const double worldTime,
-	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues, const struct UnrealLiveLink_Light *frame);
-
-
-/** Utilities **/
-
-/**
- * Copy name from src to dst
- * @param src source name
- * @param dst destination UnrealLiveLink_Name
- */
-extern void UnrealLiveLink_CopyName(const char *src, UnrealLiveLink_Name dst);
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif
-
+/** 
+ * Copyright (c) 2020 Patrick Palmer, The Jim Henson Company.
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _UNREAL_LIVE_LINK_C_INTERFACE_API_H
+#define _UNREAL_LIVE_LINK_C_INTERFACE_API_H 1
+
+#include "UnrealLiveLinkCInterfaceTypes.h"
+
+/**
+ * Threading
+ *
+ * UnrealLiveLink_Load and UnrealLiveLink_Unload must not race with any other call.
+ * Once loaded, every function may be called from any thread. State is sharded per subject:
+ * calls for the same subject are serialized in the order they acquire the subject, calls for
+ * different subjects (or different providers) build their frames concurrently, sharing only read
+ * locks. Per provider, the final hand-off to Unreal's Live Link provider, the clock estimate (when
+ * set) and the extrapolation error totals (when extrapolating) are serialized.
+ * Connection callbacks are invoked on a Unreal message bus thread.
+ * src/tests/UnrealLiveLinkThreadTest.c checks the loader and calls from many threads under ThreadSanitizer
+ * against a mock shared object; the sharding inside the real shared object needs Unreal and has no test.
+ */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * load the Unreal Live Link C Interface shared object
+ * all functions come from the single UnrealLiveLink_Interface table the shared object exports, shared objects older
+ * than UNREAL_LIVE_LINK_INTERFACE_API_VERSION without the table are loaded function by function,
+ * for the load to succeed the shared object's version must be UNREAL_LIVE_LINK_MIN_API_VERSION or newer
+ * if the load fails no function is set
+ * @param cInterfaceSharedObjectFilename shared object filename
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int UnrealLiveLink_Load(const char *cInterfaceSharedObjectFilename);
+
+/**
+ * if Unreal Live Link C Interface shared object is loaded
+ * @returns UNREAL_LIVE_LINK_OK if loaded, UNREAD_LIVE_LINK_NOT_LOADED if not
+ */
+extern int UnrealLiveLink_IsLoaded(void);
+
+/**
+ * optional features of the loaded Unreal Live Link C Interface shared object
+ * @return UNREAL_LIVE_LINK_CAPABILITY_* bits, 0 if not loaded
+ */
+extern unsigned int UnrealLiveLink_GetCapabilities(void);
+
+/**
+ * unload Unreal Live Link C Interface shared object
+ */
+extern void UnrealLiveLink_Unload(void);
+
+/**
+ * set the name of the Message Bus Provider
+ * @param providerName name of Live Link interface appearing in Unreal
+ */
+extern void (*UnrealLiveLink_SetProviderName)(const char *providerName);
+
+/**
+ * get the current version of the Unreal Live Link C Interface
+ * the version integer is specific to this API and not matching against Unreal Versions
+ * @return version of the Unreal Live Link C Interface (UNREAL_LIVE_LINK_API_VERSION value at compile time)
+ */
+extern int (*UnrealLiveLink_GetVersion)(void);
+
+/**
+ * start live link connection
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_StartLiveLink)(void);
+
+/**
+ * stop live link connection
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_StopLiveLink)(void);
+
+/**
+ * set a unicast endpoint
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern void (*UnrealLiveLink_SetUnicastEndpoint)(const char* Endpoint);
+
+/**
+ * add a static endpoint
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_AddStaticEndpoint)(const char* Endpoint);
+
+/**
+ * remove a static endpoint
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_RemoveStaticEndpoint)(const char* Endpoint);
+
+/**
+ * apply UdpMessaging transport settings with a single restart of the transport, started providers are restarted with it
+ * optional, null unless UnrealLiveLink_GetCapabilities has UNREAL_LIVE_LINK_CAPABILITY_TRANSPORT_SETTINGS
+ * @param settings transport settings, empty names and values <= 0 are left unchanged
+ * @return results (success returns UNREAL_LIVE_LINK_OK, UNREAL_LIVE_LINK_FAILED if UdpMessaging is not available)
+ */
+extern int (*UnrealLiveLink_SetTransportSettings)(const struct UnrealLiveLink_TransportSettings *settings);
+
+/**
+ * get the UdpMessaging transport settings in effect
+ * optional, null unless UnrealLiveLink_GetCapabilities has UNREAL_LIVE_LINK_CAPABILITY_TRANSPORT_SETTINGS
+ * @param settings filled with the current settings
+ * @return results (success returns UNREAL_LIVE_LINK_OK, UNREAL_LIVE_LINK_FAILED if UdpMessaging is not available)
+ */
+extern int (*UnrealLiveLink_GetTransportSettings)(struct UnrealLiveLink_TransportSettings *settings);
+
+/**
+ * register a function callback if the connection to Unreal changes
+ * @param callback callback function
+ */
+extern void (*UnrealLiveLink_RegisterConnectionUpdateCallback)(void (*callback)());
+
+/**
+ * connection with Unreal?
+ * @return UNREAL_LIVE_LINK_OK if connected, UNREAD_LIVE_LINK_NOT_CONNECTED if not
+ */
+extern int (*UnrealLiveLink_HasConnection)();
+
+/**
+ * set the rate of the library's thread ticking the core ticker, which services heartbeats, connection discovery and
+ * connection callbacks. It runs at UNREAL_LIVE_LINK_DEFAULT_TICKER_RATE after loading.
+ * optional, null unless UnrealLiveLink_GetCapabilities has UNREAL_LIVE_LINK_CAPABILITY_TICKER
+ * @param rate ticks per second, 0 stops the thread for callers pumping from their own loop with UnrealLiveLink_Pump
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_SetTickerRate)(double rate);
+
+/**
+ * tick the core ticker once on the calling thread, safe to mix with the ticker thread
+ * optional, null unless UnrealLiveLink_GetCapabilities has UNREAL_LIVE_LINK_CAPABILITY_TICKER
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_Pump)(void);
+
+/**
+ * get how regularly the core ticker has been ticked
+ * optional, null unless UnrealLiveLink_GetCapabilities has UNREAL_LIVE_LINK_CAPABILITY_TICKER
+ * @param stats ticker stats to fill
+ * @return results (success returns UNREAL_LIVE_LINK_OK, UNREAL_LIVE_LINK_INVALID_STRUCTURE if stats is null)
+ */
+extern int (*UnrealLiveLink_GetTickerStats)(struct UnrealLiveLink_TickerStats *stats);
+
+/**
+ * initialize the Metadata structure with default values
+ * @param metadata Metadata structure
+ */
+extern void UnrealLiveLink_InitMetadata(struct UnrealLiveLink_Metadata *metadata);
+
+
+
+
+/** Basic Generic Roll **/
+
+/**
+ * Basic Generic Roll setup
+ * @param subjectName Unreal subject name
+ * @param properties named float properties
+ */
+extern void (*UnrealLiveLink_SetBasicStructure)(const char *subjectName, const struct UnrealLiveLink_Properties *properties);
+
+/**
+ * Basic Generic Roll per frame values
+ * @param subjectName Unreal subject name
+ * @param worldTime frame time
+ * @param metadata associated metadata (may pass in null for none)
+ * @param propValues named properties float values (may pass in null for none)
+ */
+extern void (*UnrealLiveLink_UpdateBasicFrame)(const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues);
+
+
+
+/** Animation Roll **/
+
+/**
+ * Animation Roll setup
+ * @param subjectName Unreal subject name
+ * @param properties named float properties
+ */
+extern void (*UnrealLiveLink_SetAnimationStructure)(
+	const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_AnimationStatic *structure);
+
+/**
+ * Animation Roll per frame values
+ * @param subjectName Unreal subject name
+ * @param worldTime frame time
+ * @param metadata associated metadata (may pass in null for none)
+ * @param propValues named properties float values (may pass in null for none)
+ * @param frame animation frame
+ */
+extern void (*UnrealLiveLink_UpdateAnimationFrame)(const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Animation *frame);
+
+
+
+/** Transform Roll **/
+
+/**
+ * initialize transform structure to identity
+ * @param transform transform to set
+ */
+extern void UnrealLiveLink_InitTransform(struct UnrealLiveLink_Transform *transform);
+
+/**
+ * Transform Roll setup
+ * @param subjectName Unreal subject name
+ * @param properties named float properties
+ */
+extern void (*UnrealLiveLink_SetTransformStructure)(const char *subjectName, const struct UnrealLiveLink_Properties *properties);
+
+/**
+ * Transform Roll per frame values
+ * @param subjectName Unreal subject name
+ * @param worldTime frame time
+ * @param metadata associated metadata (may pass in null for none)
+ * @param propValues named properties float values (may pass in null for none)
+ * @param frame transform
+ */
+extern void (*UnrealLiveLink_UpdateTransformFrame)(const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Transform *frame);
+
+
+
+/** Camera Roll **/
+
+/**
+ * initialize camera static to default values
+ * @param structure structure to set
+ */
+extern void UnrealLiveLink_InitCameraStatic(struct UnrealLiveLink_CameraStatic *structure);
+
+/**
+ * initialize camera per frame to default values
+ * @param structure structure to set
+ */
+extern void UnrealLiveLink_InitCamera(struct UnrealLiveLink_Camera *structure);
+
+/**
+ * Camera Roll setup
+ * @param subjectName Unreal subject name
+ * @param properties named float properties
+ */
+extern void (*UnrealLiveLink_SetCameraStructure)(
+	const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_CameraStatic *structure);
+
+/**
+ * Camera Roll per frame values
+ * @param subjectName Unreal subject name
+ * @param worldTime frame time
+ * @param metadata associated metadata (may pass in null for none)
+ * @param propValues named properties float values (may pass in null for none)
+ * @param frame camera values
+ */
+extern void (*UnrealLiveLink_UpdateCameraFrame)(const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues, const struct UnrealLiveLink_Camera *frame);
+
+
+
+/** Light Roll **/
+
+/**
+ * initialize light static to default values
+ * @param structure structure to set
+ */
+extern void UnrealLiveLink_InitLightStatic(struct UnrealLiveLink_LightStatic *structure);
+
+/**
+ * initialize light per frame to default values
+ * @param structure structure to set
+ */
+extern void UnrealLiveLink_InitLight(struct UnrealLiveLink_Light *structure);
+
+/**
+ * Light Roll setup
+ * @param subjectName Unreal subject name
+ * @param properties named float properties
+ */
+extern void (*UnrealLiveLink_SetLightStructure)(
+	const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_LightStatic *structure);
+
+/**
+ * Light Roll per frame values
+ * @param subjectName Unreal subject name
+ * @param worldTime frame time
+ * @param metadata associated metadata (may pass in null for none)
+ * @param propValues named properties float values (may pass in null for none)
+ * @param frame light values
+ */
+extern void (*UnrealLiveLink_UpdateLightFrame)(const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues, const struct UnrealLiveLink_Light *frame);
+
+
+/** Providers **/
+
+/**
+ * create an additional named Message Bus Provider
+ * each provider appears as its own source in Unreal, owns its subjects and connection callbacks
+ * and may be driven from its own thread
+ * @param providerName name of Live Link interface appearing in Unreal
+ * @return provider handle
+ */
+extern int (*UnrealLiveLink_CreateProvider)(const char *providerName);
+
+/**
+ * stop and destroy a provider (the default provider can't be destroyed)
+ * @param provider provider handle
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_DestroyProvider)(int provider);
+
+/**
+ * start provider live link connection
+ * @param provider provider handle
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_StartProvider)(int provider);
+
+/**
+ * stop provider live link connection
+ * @param provider provider handle
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_StopProvider)(int provider);
+
+/**
+ * register a function callback if the provider connection to Unreal changes
+ * @param provider provider handle
+ * @param callback callback function
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_RegisterProviderConnectionUpdateCallback)(int provider, void (*callback)());
+
+/**
+ * provider connection with Unreal?
+ * @param provider provider handle
+ * @return UNREAL_LIVE_LINK_OK if connected, UNREAD_LIVE_LINK_NOT_CONNECTED if not
+ */
+extern int (*UnrealLiveLink_ProviderHasConnection)(int provider);
+
+/**
+ * get how quickly a provider detected its connection to Unreal
+ * optional, null unless UnrealLiveLink_GetCapabilities has UNREAL_LIVE_LINK_CAPABILITY_TICKER
+ * @param provider provider handle
+ * @param stats connection stats to fill
+ * @return results (success returns UNREAL_LIVE_LINK_OK, UNREAL_LIVE_LINK_INVALID_STRUCTURE if stats is null)
+ */
+extern int (*UnrealLiveLink_ProviderGetConnectionStats)(int provider, struct UnrealLiveLink_ConnectionStats *stats);
+
+/**
+ * static data counters of a provider
+ * the Set*Structure functions hash the role, property names, bones and capability flags and
+ * skip rebuilding and resending static data that matches what was last sent for the subject
+ * @param provider provider handle
+ * @param stats counters to fill in
+ * @return results (success returns UNREAL_LIVE_LINK_OK, UNREAL_LIVE_LINK_INVALID_STRUCTURE if stats is null)
+ */
+extern int (*UnrealLiveLink_ProviderGetStaticDataStats)(int provider, struct UnrealLiveLink_StaticDataStats *stats);
+
+/**
+ * per provider versions of the role functions
+ * these match the role functions above with the provider handle as the first parameter
+ * and return UNREAL_LIVE_LINK_OK on success
+ */
+extern int (*UnrealLiveLink_ProviderSetBasicStructure)(int provider, const char *subjectName, const struct UnrealLiveLink_Properties *properties);
+extern int (*UnrealLiveLink_ProviderUpdateBasicFrame)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues);
+
+extern int (*UnrealLiveLink_ProviderSetAnimationStructure)(int provider,
+	const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_AnimationStatic *structure);
+extern int (*UnrealLiveLink_ProviderUpdateAnimationFrame)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Animation *frame);
+
+extern int (*UnrealLiveLink_ProviderSetTransformStructure)(int provider, const char *subjectName, const struct UnrealLiveLink_Properties *properties);
+extern int (*UnrealLiveLink_ProviderUpdateTransformFrame)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Transform *frame);
+
+extern int (*UnrealLiveLink_ProviderSetCameraStructure)(int provider,
+	const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_CameraStatic *structure);
+extern int (*UnrealLiveLink_ProviderUpdateCameraFrame)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues, const struct UnrealLiveLink_Camera *frame);
+
+extern int (*UnrealLiveLink_ProviderSetLightStructure)(int provider,
+	const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_LightStatic *structure);
+extern int (*UnrealLiveLink_ProviderUpdateLightFrame)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues, const struct UnrealLiveLink_Light *frame);
+
+
+/** Crowds **/
+
+/**
+ * Animation Roll per frame values for many subjects at once
+ * transform conversion and frame building run in parallel across the machine's cores,
+ * only the final hand-off to Unreal is serialized
+ * @param provider provider handle
+ * @param frames one entry per subject
+ * @param frameCount number of entries in frames
+ * @return results (success returns UNREAL_LIVE_LINK_OK), UNREAL_LIVE_LINK_INVALID_STRUCTURE if frameCount is negative,
+ * frames is null or an entry has no subject name or frame (the other entries are still sent)
+ */
+extern int (*UnrealLiveLink_ProviderUpdateAnimationFrames)(int provider, const struct UnrealLiveLink_AnimationSubjectFrame *frames, int frameCount);
+
+/**
+ * register a skeleton shared by many Animation Roll subjects
+ * bone and property names are converted once, subjects created from the template share them
+ * @param properties named float properties (may pass in null for none)
+ * @param structure bone names and parents
+ * @return skeleton template handle (UNREAL_LIVE_LINK_NO_HANDLE on failure)
+ */
+extern int (*UnrealLiveLink_RegisterSkeletonTemplate)(
+	const struct UnrealLiveLink_Properties *properties, const struct UnrealLiveLink_AnimationStatic *structure);
+
+/**
+ * release a skeleton template, subjects already created from it are not affected
+ * @param skeletonTemplate skeleton template handle
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_UnregisterSkeletonTemplate)(int skeletonTemplate);
+
+/**
+ * Animation Roll setup from a registered skeleton template
+ * @param provider provider handle
+ * @param subjectName Unreal subject name
+ * @param skeletonTemplate skeleton template handle
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_ProviderSetAnimationStructureFromTemplate)(int provider, const char *subjectName, int skeletonTemplate);
+
+
+/** Input Conversion **/
+
+/**
+ * set the space of the transforms passed to the Animation Roll per frame values
+ * world space transforms are converted to parent-local using the bone parents of the animation structure,
+ * which must list parents before children (checked here and when the structure is set)
+ * @param provider provider handle
+ * @param subjectName Unreal subject name
+ * @param space UNREAL_LIVE_LINK_LOCAL_SPACE (default) or UNREAL_LIVE_LINK_WORLD_SPACE
+ * @return results (success returns UNREAL_LIVE_LINK_OK, UNREAL_LIVE_LINK_INVALID_STRUCTURE if parents are not ordered)
+ */
+extern int (*UnrealLiveLink_ProviderSetAnimationTransformSpace)(int provider, const char *subjectName, enum UnrealLiveLink_TransformSpace space);
+
+/**
+ * set the rotation format of the transforms passed to a subject's per frame values (all roles with a transform)
+ * typically called next to the subject's Set*Structure, the format is kept until changed
+ * Euler angles are converted to quaternions in the library
+ * @param provider provider handle
+ * @param subjectName Unreal subject name
+ * @param order UNREAL_LIVE_LINK_ROTATION_QUATERNION (default) or one of the UNREAL_LIVE_LINK_ROTATION_EULER_* orders
+ * @param isRadians (bool) Euler angles are in radians rather than degrees
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_ProviderSetRotationOrder)(int provider, const char *subjectName, enum UnrealLiveLink_RotationOrder order, int isRadians);
+
+/**
+ * enable validation of a subject's frames before they are sent
+ * checks transforms and property values for NaN/Inf, degenerate rotations and values out of range
+ * rejected frames return UNREAL_LIVE_LINK_FAILED from the update call
+ * @param provider provider handle
+ * @param subjectName Unreal subject name
+ * @param mode UNREAL_LIVE_LINK_VALIDATION_OFF (default), _REPAIR or _REJECT
+ * @param maxAbsValue largest accepted absolute translation, scale or property value, 0 for no limit
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_ProviderSetValidation)(int provider, const char *subjectName, enum UnrealLiveLink_ValidationMode mode, float maxAbsValue);
+
+/**
+ * get the frame validation counters of a provider, totals over all its subjects
+ * @param provider provider handle
+ * @param stats counters to fill
+ * @return results (success returns UNREAL_LIVE_LINK_OK, UNREAL_LIVE_LINK_INVALID_STRUCTURE if stats is null)
+ */
+extern int (*UnrealLiveLink_ProviderGetValidationStats)(int provider, struct UnrealLiveLink_ValidationStats *stats);
+
+/**
+ * filter a channel of a subject's frames in the library, after validation
+ * translations, scales and properties are One Euro filtered per component,
+ * rotations are filtered on their angular speed and blended with slerp
+ * @param provider provider handle
+ * @param subjectName Unreal subject name
+ * @param channel channel to filter
+ * @param settings filter parameters, null disables the channel's filter
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_ProviderSetFilter)(int provider, const char *subjectName, enum UnrealLiveLink_FilterChannel channel,
+	const struct UnrealLiveLink_FilterSettings *settings);
+
+/**
+ * send a subject's frames at a fixed rate instead of as they arrive
+ * input frames are buffered by their world time (seconds) and output frames are emitted from a library thread,
+ * interpolated between input frames when upsampling and averaged over the output period when decimating
+ * @param provider provider handle
+ * @param subjectName Unreal subject name
+ * @param outputRate output frames per second, 0 to send frames as they arrive (default)
+ * @param delay seconds the output lags the newest input, about one input frame lets upsampling interpolate
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_ProviderSetResampling)(int provider, const char *subjectName, double outputRate, double delay);
+
+/**
+ * predict a subject's transforms and property values forward to hide network and solver latency
+ * velocities are estimated from the last two frames and predictions are clamped to the given limits,
+ * the frame keeps its world time. Applied last, after filtering and resampling
+ * @param provider provider handle
+ * @param subjectName Unreal subject name
+ * @param settings extrapolation parameters, null disables
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_ProviderSetExtrapolation)(int provider, const char *subjectName, const struct UnrealLiveLink_ExtrapolationSettings *settings);
+
+/**
+ * get the prediction error of a provider's extrapolated subjects, for tuning the horizon and limits
+ * @param provider provider handle
+ * @param stats error statistics to fill
+ * @return results (success returns UNREAL_LIVE_LINK_OK, UNREAL_LIVE_LINK_INVALID_STRUCTURE if stats is null)
+ */
+extern int (*UnrealLiveLink_ProviderGetExtrapolationStats)(int provider, struct UnrealLiveLink_ExtrapolationStats *stats);
+
+/**
+ * estimate the offset and drift of the clock behind a provider's world times against the library's clock from
+ * frame arrivals, and optionally send world times mapped onto the library's clock so Unreal buffers and interpolates
+ * on a steady clock in seconds. Applied before the other frame processing
+ * optional, null unless UnrealLiveLink_GetCapabilities has UNREAL_LIVE_LINK_CAPABILITY_CLOCK
+ * @param provider provider handle
+ * @param settings clock settings, null disables and resets the estimate
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_ProviderSetClock)(int provider, const struct UnrealLiveLink_ClockSettings *settings);
+
+/**
+ * get the current clock estimate of a provider
+ * optional, null unless UnrealLiveLink_GetCapabilities has UNREAL_LIVE_LINK_CAPABILITY_CLOCK
+ * @param provider provider handle
+ * @param stats clock estimate to fill
+ * @return results (success returns UNREAL_LIVE_LINK_OK, UNREAL_LIVE_LINK_INVALID_STRUCTURE if stats is null)
+ */
+extern int (*UnrealLiveLink_ProviderGetClockStats)(int provider, struct UnrealLiveLink_ClockStats *stats);
+
+/**
+ * build a table from a source's own joint order to the bone order of an animation structure, matched by name
+ * source joints not in the structure are ignored, and bones the source doesn't have are sent as identity
+ * optional, null unless UnrealLiveLink_GetCapabilities has UNREAL_LIVE_LINK_CAPABILITY_SKELETON_MAPS
+ * @param sourceNames joint names in the order the source produces them
+ * @param structure bone names and parents the subject was set up with
+ * @return skeleton map handle (UNREAL_LIVE_LINK_NO_HANDLE on failure)
+ */
+extern int (*UnrealLiveLink_CreateSkeletonMap)(
+	const struct UnrealLiveLink_Properties *sourceNames, const struct UnrealLiveLink_AnimationStatic *structure);
+
+/**
+ * release a skeleton map
+ * optional, null unless UnrealLiveLink_GetCapabilities has UNREAL_LIVE_LINK_CAPABILITY_SKELETON_MAPS
+ * @param skeletonMap skeleton map handle
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_DestroySkeletonMap)(int skeletonMap);
+
+/**
+ * Animation Roll frame update with the transforms in source joint order, reordered to the bone order by the skeleton map
+ * optional, null unless UnrealLiveLink_GetCapabilities has UNREAL_LIVE_LINK_CAPABILITY_SKELETON_MAPS
+ * @param provider provider handle
+ * @param subjectName Unreal subject name
+ * @param worldTime world time in seconds (see UnrealLiveLink_UpdateAnimationFrame)
+ * @param metadata optional packed metadata (see UnrealLiveLink_ProviderUpdateAnimationFramePacked), may be null
+ * @param propValues optional property values, may be null
+ * @param skeletonMap skeleton map handle
+ * @param frame one transform per source joint
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_ProviderUpdateAnimationFrameMapped)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_PackedMetadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	int skeletonMap, const struct UnrealLiveLink_Animation *frame);
+
+/**
+ * partial frame updates, the given properties (and bones) are merged into the subject's last frame and the merged
+ * frame is sent, so producers updating different parts of a subject don't need to share a full frame
+ * values not yet given are 0 and bones identity, full frames sent after a subject's first sparse update also replace them
+ * sparse transforms are parent-local, subjects set to UNREAL_LIVE_LINK_WORLD_SPACE return UNREAL_LIVE_LINK_INVALID_STRUCTURE
+ * optional, null unless UnrealLiveLink_GetCapabilities has UNREAL_LIVE_LINK_CAPABILITY_SPARSE
+ * @param provider provider handle
+ * @param subjectName Unreal subject name
+ * @param worldTime world time in seconds (see UnrealLiveLink_Update*Frame)
+ * @param metadata optional packed metadata (see UnrealLiveLink_ProviderUpdateBasicFramePacked), may be null
+ * @param propValues changed property values, may be null
+ * @param frame changed bones, may be null
+ * @return results (UNREAL_LIVE_LINK_INVALID_STRUCTURE if an index is outside the subject's structure)
+ */
+extern int (*UnrealLiveLink_ProviderUpdateBasicFrameSparse)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_PackedMetadata *metadata, const struct UnrealLiveLink_SparsePropertyValues *propValues);
+extern int (*UnrealLiveLink_ProviderUpdateAnimationFrameSparse)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_PackedMetadata *metadata, const struct UnrealLiveLink_SparsePropertyValues *propValues,
+	const struct UnrealLiveLink_SparseTransforms *frame);
+
+/**
+ * matrix input variants of the per frame updates, matrices are decomposed to rotation, translation and scale in the library
+ * the camera and light variants take their transform from the matrix and ignore the frame's transform field
+ * @param provider provider handle
+ * @param subjectName Unreal subject name
+ * @param worldTime world time in seconds (see UnrealLiveLink_Update*Frame)
+ * @param metadata optional metadata, may be null
+ * @param propValues optional property values, may be null
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_ProviderUpdateTransformFrameMatrix)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Matrix *frame);
+extern int (*UnrealLiveLink_ProviderUpdateAnimationFrameMatrices)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_AnimationMatrices *frame);
+extern int (*UnrealLiveLink_ProviderUpdateCameraFrameMatrix)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Camera *frame, const struct UnrealLiveLink_Matrix *transform);
+extern int (*UnrealLiveLink_ProviderUpdateLightFrameMatrix)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Light *frame, const struct UnrealLiveLink_Matrix *transform);
+
+/**
+ * packed string variants of the basic and animation updates, names and metadata are passed as one string buffer
+ * with offsets and lengths instead of fixed size UnrealLiveLink_Name entries, so only the used characters are copied
+ * and names are not truncated
+ * @param provider provider handle
+ * @param subjectName Unreal subject name
+ * @param propertyNames optional property names, may be null
+ * @param worldTime world time in seconds (see UnrealLiveLink_Update*Frame)
+ * @param metadata optional metadata, may be null
+ * @param propValues optional property values, may be null
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int (*UnrealLiveLink_ProviderSetBasicStructurePacked)(int provider, const char *subjectName,
+	const struct UnrealLiveLink_PackedStrings *propertyNames);
+extern int (*UnrealLiveLink_ProviderUpdateBasicFramePacked)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_PackedMetadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues);
+extern int (*UnrealLiveLink_ProviderSetAnimationStructurePacked)(int provider, const char *subjectName,
+	const struct UnrealLiveLink_PackedStrings *propertyNames, const struct UnrealLiveLink_PackedAnimationStatic *structure);
+extern int (*UnrealLiveLink_ProviderUpdateAnimationFramePacked)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_PackedMetadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Animation *frame);
+
+/**
+ * get the cost of the last animation structure set on a provider, for sizing the setup of very large rigs
+ * names are interned in parallel for large structures, UnrealLiveLink_ProviderSetAnimationStructurePacked also avoids
+ * the fixed size name copies
+ * @param provider provider handle
+ * @param stats setup timing to fill
+ * @return results (success returns UNREAL_LIVE_LINK_OK, UNREAL_LIVE_LINK_INVALID_STRUCTURE if stats is null)
+ */
+extern int (*UnrealLiveLink_ProviderGetSkeletonSetupStats)(int provider, struct UnrealLiveLink_SkeletonSetupStats *stats);
+
+
+/** Utilities **/
+
+/**
+ * Copy name from src to dst
+ * @param src source name
+ * @param dst destination UnrealLiveLink_Name
+ */
+extern void UnrealLiveLink_CopyName(const char *src, UnrealLiveLink_Name dst);
+
+/**
+ * allocate zeroed, UNREAL_LIVE_LINK_BUFFER_ALIGNMENT aligned storage for property values,
+ * for high channel counts fill it in place each frame instead of building a new array
+ * @param propValues property values to set up, free with UnrealLiveLink_FreePropertyValues
+ * @param count number of values
+ * @return results (success returns UNREAL_LIVE_LINK_OK, UNREAL_LIVE_LINK_FAILED if out of memory)
+ */
+extern int UnrealLiveLink_AllocPropertyValues(struct UnrealLiveLink_PropertyValues *propValues, int count);
+
+/**
+ * free property values storage from UnrealLiveLink_AllocPropertyValues
+ * @param propValues property values, reset to empty
+ */
+extern void UnrealLiveLink_FreePropertyValues(struct UnrealLiveLink_PropertyValues *propValues);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -1,259 +1,757 @@
-
-/** 
- * Copyright (c) 2020 Patrick Palmer, The Jim Henson Company.
- * 
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files (the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions:
- * 
- * The above copyright notice and this permission notice shall be included in
- * all copies or substantial portions of the Software.
- * 
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
- * SOFTWARE.
- */
-
-#ifndef _UNREAL_LIVE_LINK_C_INTERFACE_TYPES_H
-#define _UNREAL_LIVE_LINK_C_INTERFACE_TYPES_H 1
-
-#include <stdint.h>
-
-#define UNREAL_LIVE_LINK_API_VERSION 6
-
-#define UNREAL_LIVE_LINK_MAX_NAME_LENGTH 128
-
-/**
- * function result values (if return success as an int)
- */
-#define UNREAL_LIVE_LINK_OK			0
-#define UNREAL_LIVE_LINK_WRONG_VERSION		1
-#define UNREAL_LIVE_LINK_MISSING_LIB		2
-#define UNREAL_LIVE_LINK_INCOMPLETE		3
-#define UNREAL_LIVE_LINK_NOT_LOADED		4
-#define UNREAL_LIVE_LINK_NOT_CONNECTED		5
-#define UNREAL_LIVE_LINK_FAILED			6
-
-
-typedef char UnrealLiveLink_Name[UNREAL_LIVE_LINK_MAX_NAME_LENGTH];
-
-/* transformation
- * rotation is quaternion, w is 4th field
- */
-struct UnrealLiveLink_Transform
-{
-	float rotation[4];
-	float translation[3];
-	float scale[3];
-};
-
-/**
- * timecode formats
- * SMPTE standards: SMPTE ST12-1 p6, SMPTE ST428-11:2013 p3
- */ 
-enum UnrealLiveLink_TimecodeFormat
-{
-	UNREAL_LIVE_LINK_TIMECODE_UNKNOWN = 0,
-	
-	UNREAL_LIVE_LINK_TIMECODE_23_98,
-	UNREAL_LIVE_LINK_TIMECODE_24,
-	UNREAL_LIVE_LINK_TIMECODE_25,
-	UNREAL_LIVE_LINK_TIMECODE_29_97_NDF,
-	UNREAL_LIVE_LINK_TIMECODE_29_97_DF,
-	UNREAL_LIVE_LINK_TIMECODE_30,
-	UNREAL_LIVE_LINK_TIMECODE_47_95,
-	UNREAL_LIVE_LINK_TIMECODE_48,
-	UNREAL_LIVE_LINK_TIMECODE_50,
-	UNREAL_LIVE_LINK_TIMECODE_59_94_NDF,
-	UNREAL_LIVE_LINK_TIMECODE_59_94_DF,
-	UNREAL_LIVE_LINK_TIMECODE_60,
-	UNREAL_LIVE_LINK_TIMECODE_72,
-	UNREAL_LIVE_LINK_TIMECODE_96,
-	UNREAL_LIVE_LINK_TIMECODE_100,
-	UNREAL_LIVE_LINK_TIMECODE_120
-};
-
-struct UnrealLiveLink_Timecode
-{
-	int32_t hours;
-	int32_t minutes;
-	int32_t seconds;
-	int32_t frames;
-	enum UnrealLiveLink_TimecodeFormat format;
-};
-
-/* property names */
-struct UnrealLiveLink_Properties
-{
-	UnrealLiveLink_Name *names;
-	int nameCount;
-};
-
-/* property values (array values match the Property Names index) */
-struct UnrealLiveLink_PropertyValues
-{
-	float *values;
-	int valueCount;
-};
-
-struct UnrealLiveLink_KeyValue
-{
-	UnrealLiveLink_Name name;
-	UnrealLiveLink_Name value;
-};
-
-struct UnrealLiveLink_Metadata
-{
-	/* string map */
-	struct UnrealLiveLink_KeyValue *keyValues;
-	int keyValueCount;
-
-	/* frame timecode */
-	struct UnrealLiveLink_Timecode timecode;
-};
-
-struct UnrealLiveLink_Bone
-{
-	/* bone name */
-	UnrealLiveLink_Name name;
-
-	/* bone parent index, use parentIndex=-1 for root */
-	int parentIndex;
-};
-
-struct UnrealLiveLink_AnimationStatic
-{
-	/* list of bone names and their parents */
-	struct UnrealLiveLink_Bone *bones;
-	int boneCount;
-};
-
-struct UnrealLiveLink_Animation
-{
-	/* bone transforms */
-	struct UnrealLiveLink_Transform *transforms;
-	int transformCount;
-};
-
-struct UnrealLiveLink_CameraStatic
-{
-	/* (bool) whether to use field of view per frame */
-	int isFieldOfViewSupported;
-
-	/* (bool) whether to use aspect ratio per frame */
-	int isAspectRatioSupported;
-
-	/* (bool) whether to use focal length per frame */
-	int isFocalLengthSupported;
-
-	/* (bool) whether to use projection mode per frame */
-	int isProjectionModeSupported;
-
-	/* film back, only for cinematic camera, values greater than 0 will be applied */
-	float filmBackWidth;
-	float filmBackHeight;
-
-	/* (bool) whether to use aperture per frame */
-	int isApertureSupported;
-
-	/* (bool) whether to use focus distance per frame */
-	int isFocusDistanceSupported;
-};
-
-struct UnrealLiveLink_Camera
-{
-	/* transform */
-	struct UnrealLiveLink_Transform transform;
-
-	/* Field of View of the camera in degrees */
-	float fieldOfView;
-
-	/* Aspect Ratio of the camera (Width / Height) */
-	float aspectRatio;
-
-	/* Focal length of the camera */
-	float focalLength;
-
-	/* Aperture of the camera in terms of f-stop */
-	float aperture;
-
-	/* Focus distance of the camera in cm. Works only in manual focus method */
-	float focusDistance;
-
-	/* projection mode of the camera */
-	/* (bool) true is perspective, false is orthographic */
-	int isPerspective;
-};
-
-struct UnrealLiveLink_LightStatic
-{
-	/* (bool) whether to use temperature per frame */
-	int isTemperatureSupported;
-
-	/* (bool) whether to use intensity per frame */
-	int isIntensitySupported;
-
-	/* (bool) whether to use light color per frame */
-	int isLightColorSupported;
-
-	/* (bool) whether to use inner cone angle per frame, spotlight only */
-	int isInnerConeAngleSupported;
-
-	/* (bool) whether to use outer cone angle per frame, spotlight only */
-	int isOuterConeAngleSupported;
-
-	/* (bool) whether to use attenuation radius per frame */
-	int isAttenuationRadiusSupported;
-
-	/* (bool) whether to use source length per frame */
-	int isSourceLengthSupported;
-
-	/* (bool) whether to use source radius per frame */
-	int isSourceRadiusSupported;
-
-	/* (bool) whether to use soft source radius per frame */
-	int isSoftSourceRadiusSupported;
-};
-
-struct UnrealLiveLink_Light
-{
-	/* transform */
-	struct UnrealLiveLink_Transform transform;
-
-	/* color temperature in Kelvin of the blackbody illuminant */
-	float temperature;
-
-	/* total energy that the light emits in lux. */
-	float intensity;
-
-	/* filter color of the light (rgb). */
-	uint8_t lightColor[3];
-
-	/* inner cone angle in degrees for a Spotlight. */
-	float innerConeAngle;
-
-	/* outer cone angle in degrees for a Spotlight. */
-	float outerConeAngle;
-
-	/* light visible influence. Works for Pointlight and Spotlight. */
-	float attenuationRadius;
-
-	/* radius of light source shape. Works for Pointlight and Spotlight. */
-	float sourceRadius;
-
-	/* soft radius of light source shape. Works for Pointlight and Spotlight. */
-	float softSourceRadius;
-
-	/* length of light source shape. Works for Pointlight and Spotlight. */
-	float sourceLength;
-};
-
-#endif
-
+
+/** 
+ * Copyright (c) 2020 Patrick Palmer, The Jim Henson Company.
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _UNREAL_LIVE_LINK_C_INTERFACE_TYPES_H
+#define _UNREAL_LIVE_LINK_C_INTERFACE_TYPES_H 1
+
+#include <stdint.h>
+
+#define UNREAL_LIVE_LINK_API_VERSION 8
+
+/* oldest version of the shared object (and client) this version works with */
+#define UNREAL_LIVE_LINK_MIN_API_VERSION 6
+
+/* first version of the shared object exporting UnrealLiveLink_Interface, older ones are loaded function by function */
+#define UNREAL_LIVE_LINK_INTERFACE_API_VERSION 8
+
+#define UNREAL_LIVE_LINK_MAX_NAME_LENGTH 128
+
+/* rate (Hz) of the library's core ticker thread after loading, see UnrealLiveLink_SetTickerRate */
+#define UNREAL_LIVE_LINK_DEFAULT_TICKER_RATE 60.0
+
+/* alignment in bytes of buffers allocated by the library utilities */
+#define UNREAL_LIVE_LINK_BUFFER_ALIGNMENT 64
+
+/**
+ * function result values (if return success as an int)
+ */
+#define UNREAL_LIVE_LINK_OK			0
+#define UNREAL_LIVE_LINK_WRONG_VERSION		1
+#define UNREAL_LIVE_LINK_MISSING_LIB		2
+#define UNREAL_LIVE_LINK_INCOMPLETE		3
+#define UNREAL_LIVE_LINK_NOT_LOADED		4
+#define UNREAL_LIVE_LINK_NOT_CONNECTED		5
+#define UNREAL_LIVE_LINK_FAILED			6
+#define UNREAL_LIVE_LINK_INVALID_PROVIDER	7
+#define UNREAL_LIVE_LINK_INVALID_HANDLE		8
+#define UNREAL_LIVE_LINK_INVALID_STRUCTURE	9
+
+/**
+ * provider handles
+ * the default provider always exists and is the one driven by the non-handle functions
+ */
+#define UNREAL_LIVE_LINK_DEFAULT_PROVIDER	0
+#define UNREAL_LIVE_LINK_NO_PROVIDER		-1
+
+/* returned by functions creating other handles (skeleton templates, ...) on failure */
+#define UNREAL_LIVE_LINK_NO_HANDLE		-1
+
+
+typedef char UnrealLiveLink_Name[UNREAL_LIVE_LINK_MAX_NAME_LENGTH];
+
+/* transformation
+ * rotation is quaternion, w is 4th field
+ */
+struct UnrealLiveLink_Transform
+{
+	float rotation[4];
+	float translation[3];
+	float scale[3];
+};
+
+/* transformation as a 4x4 matrix
+ * row vector convention, translation is m[3][0..2] (Unreal and Maya layout),
+ * column-major column vector matrices (OpenGL) have the same memory layout
+ * shear is discarded, a negative determinant is kept as a negative X scale
+ */
+struct UnrealLiveLink_Matrix
+{
+	float m[4][4];
+};
+
+/**
+ * space of the animation role transforms passed per frame
+ * local transforms are relative to the parent bone, world transforms are converted to local by the library
+ */
+enum UnrealLiveLink_TransformSpace
+{
+	UNREAL_LIVE_LINK_LOCAL_SPACE = 0,
+	UNREAL_LIVE_LINK_WORLD_SPACE
+};
+
+/**
+ * rotation format of the transforms passed per frame
+ * Euler orders name the axes in the order they are applied (XYZ rotates about X first, then Y, then Z)
+ * with Euler input rotation[0..2] holds the X, Y and Z angles and rotation[3] is ignored
+ */
+enum UnrealLiveLink_RotationOrder
+{
+	UNREAL_LIVE_LINK_ROTATION_QUATERNION = 0,
+
+	UNREAL_LIVE_LINK_ROTATION_EULER_XYZ,
+	UNREAL_LIVE_LINK_ROTATION_EULER_XZY,
+	UNREAL_LIVE_LINK_ROTATION_EULER_YXZ,
+	UNREAL_LIVE_LINK_ROTATION_EULER_YZX,
+	UNREAL_LIVE_LINK_ROTATION_EULER_ZXY,
+	UNREAL_LIVE_LINK_ROTATION_EULER_ZYX
+};
+
+/**
+ * per frame validation of transforms and property values
+ * REPAIR holds the last good value of an invalid channel (identity transform or zero without one),
+ * REJECT drops the frame; both normalize non-unit rotations
+ */
+enum UnrealLiveLink_ValidationMode
+{
+	UNREAL_LIVE_LINK_VALIDATION_OFF = 0,
+	UNREAL_LIVE_LINK_VALIDATION_REPAIR,
+	UNREAL_LIVE_LINK_VALIDATION_REJECT
+};
+
+/* channels of a subject's frames that can be filtered */
+enum UnrealLiveLink_FilterChannel
+{
+	UNREAL_LIVE_LINK_FILTER_TRANSLATION = 0,
+	UNREAL_LIVE_LINK_FILTER_ROTATION,
+	UNREAL_LIVE_LINK_FILTER_SCALE,
+	UNREAL_LIVE_LINK_FILTER_PROPERTIES,
+
+	UNREAL_LIVE_LINK_FILTER_CHANNEL_COUNT
+};
+
+/**
+ * timecode formats
+ * SMPTE standards: SMPTE ST12-1 p6, SMPTE ST428-11:2013 p3
+ */ 
+enum UnrealLiveLink_TimecodeFormat
+{
+	UNREAL_LIVE_LINK_TIMECODE_UNKNOWN = 0,
+	
+	UNREAL_LIVE_LINK_TIMECODE_23_98,
+	UNREAL_LIVE_LINK_TIMECODE_24,
+	UNREAL_LIVE_LINK_TIMECODE_25,
+	UNREAL_LIVE_LINK_TIMECODE_29_97_NDF,
+	UNREAL_LIVE_LINK_TIMECODE_29_97_DF,
+	UNREAL_LIVE_LINK_TIMECODE_30,
+	UNREAL_LIVE_LINK_TIMECODE_47_95,
+	UNREAL_LIVE_LINK_TIMECODE_48,
+	UNREAL_LIVE_LINK_TIMECODE_50,
+	UNREAL_LIVE_LINK_TIMECODE_59_94_NDF,
+	UNREAL_LIVE_LINK_TIMECODE_59_94_DF,
+	UNREAL_LIVE_LINK_TIMECODE_60,
+	UNREAL_LIVE_LINK_TIMECODE_72,
+	UNREAL_LIVE_LINK_TIMECODE_96,
+	UNREAL_LIVE_LINK_TIMECODE_100,
+	UNREAL_LIVE_LINK_TIMECODE_120
+};
+
+struct UnrealLiveLink_Timecode
+{
+	int32_t hours;
+	int32_t minutes;
+	int32_t seconds;
+	int32_t frames;
+	enum UnrealLiveLink_TimecodeFormat format;
+};
+
+/* property names */
+struct UnrealLiveLink_Properties
+{
+	UnrealLiveLink_Name *names;
+	int nameCount;
+};
+
+/* property values (array values match the Property Names index) */
+struct UnrealLiveLink_PropertyValues
+{
+	float *values;
+	int valueCount;
+};
+
+struct UnrealLiveLink_KeyValue
+{
+	UnrealLiveLink_Name name;
+	UnrealLiveLink_Name value;
+};
+
+struct UnrealLiveLink_Metadata
+{
+	/* string map */
+	struct UnrealLiveLink_KeyValue *keyValues;
+	int keyValueCount;
+
+	/* frame timecode */
+	struct UnrealLiveLink_Timecode timecode;
+};
+
+struct UnrealLiveLink_Bone
+{
+	/* bone name */
+	UnrealLiveLink_Name name;
+
+	/* bone parent index, use parentIndex=-1 for root */
+	int parentIndex;
+};
+
+struct UnrealLiveLink_AnimationStatic
+{
+	/* list of bone names and their parents */
+	struct UnrealLiveLink_Bone *bones;
+	int boneCount;
+};
+
+/*
+ * strings packed into one buffer, string i is lengths[i] characters at text + offsets[i]
+ * strings need no terminator and have no length limit
+ */
+struct UnrealLiveLink_PackedStrings
+{
+	const char *text;
+	const int *offsets;
+	const int *lengths;
+	int count;
+};
+
+/* packed alternative to UnrealLiveLink_Metadata, key i maps to value i */
+struct UnrealLiveLink_PackedMetadata
+{
+	/* string map */
+	struct UnrealLiveLink_PackedStrings keys;
+	struct UnrealLiveLink_PackedStrings values;
+
+	/* frame timecode */
+	struct UnrealLiveLink_Timecode timecode;
+};
+
+/* cost of the most recent animation structure a provider built, structures skipped as unchanged are not counted */
+struct UnrealLiveLink_SkeletonSetupStats
+{
+	/* names in the structure */
+	int boneCount;
+	int propertyCount;
+
+	/* seconds spent converting and interning the names */
+	double internSeconds;
+
+	/* seconds for the whole call, including the hand-off to Live Link */
+	double totalSeconds;
+};
+
+/* packed alternative to UnrealLiveLink_AnimationStatic */
+struct UnrealLiveLink_PackedAnimationStatic
+{
+	/* bone names */
+	struct UnrealLiveLink_PackedStrings boneNames;
+
+	/* bone parent indices (boneNames.count entries), use -1 for root */
+	const int *parentIndices;
+};
+
+struct UnrealLiveLink_Animation
+{
+	/* bone transforms */
+	struct UnrealLiveLink_Transform *transforms;
+	int transformCount;
+};
+
+struct UnrealLiveLink_AnimationMatrices
+{
+	/* bone transforms as matrices */
+	struct UnrealLiveLink_Matrix *matrices;
+	int matrixCount;
+};
+
+/* static data counters of a provider */
+struct UnrealLiveLink_StaticDataStats
+{
+	/* static data updates sent to Unreal */
+	uint64_t appliedCount;
+
+	/* static data updates skipped as they matched what was last sent for the subject */
+	uint64_t skippedCount;
+};
+
+/**
+ * One Euro filter parameters of a channel, based on the frame world time in seconds
+ * a beta of 0 is a plain exponential filter with minCutoff as its cutoff
+ */
+struct UnrealLiveLink_FilterSettings
+{
+	/* cutoff frequency in Hz at low speed, lower removes more jitter, 0 disables the filter */
+	float minCutoff;
+
+	/* cutoff increase per unit of speed, higher reduces lag on fast motion */
+	float beta;
+
+	/* cutoff frequency in Hz of the speed estimate, typically 1 */
+	float derivativeCutoff;
+};
+
+/* latency compensation by predicting transforms and property values forward */
+struct UnrealLiveLink_ExtrapolationSettings
+{
+	/* seconds to predict ahead, 0 disables */
+	float horizon;
+
+	/* largest predicted translation change of a transform, 0 for no limit */
+	float maxTranslation;
+
+	/* largest predicted rotation change of a transform in degrees, 0 for no limit */
+	float maxRotation;
+
+	/* largest predicted change of a property value, 0 for no limit */
+	float maxPropertyChange;
+};
+
+/* prediction error of a provider's extrapolated transforms against the frames that arrived at the predicted time */
+struct UnrealLiveLink_ExtrapolationStats
+{
+	/* transforms compared */
+	uint64_t sampleCount;
+
+	/* translation error in Unreal units */
+	double meanTranslationError;
+	double maxTranslationError;
+
+	/* rotation error in degrees */
+	double meanRotationError;
+	double maxRotationError;
+};
+
+/* frame validation counters of a provider */
+struct UnrealLiveLink_ValidationStats
+{
+	/* frames checked by validation */
+	uint64_t checkedCount;
+
+	/* non-unit rotations normalized */
+	uint64_t normalizedCount;
+
+	/* frames sent with invalid values replaced */
+	uint64_t repairedCount;
+
+	/* frames dropped */
+	uint64_t rejectedCount;
+};
+
+/* one subject of a batched (crowd) animation update */
+struct UnrealLiveLink_AnimationSubjectFrame
+{
+	const char *subjectName;
+	double worldTime;
+
+	/* may be null for none */
+	const struct UnrealLiveLink_Metadata *metadata;
+	const struct UnrealLiveLink_PropertyValues *propValues;
+
+	const struct UnrealLiveLink_Animation *frame;
+};
+
+/* bones of a sparse animation update, transforms[i] replaces bone indices[i] of the subject's last frame */
+struct UnrealLiveLink_SparseTransforms
+{
+	const int *indices;
+	const struct UnrealLiveLink_Transform *transforms;
+	int count;
+};
+
+/* properties of a sparse update, values[i] replaces property indices[i] of the subject's last frame */
+struct UnrealLiveLink_SparsePropertyValues
+{
+	const int *indices;
+	const float *values;
+	int count;
+};
+
+struct UnrealLiveLink_CameraStatic
+{
+	/* (bool) whether to use field of view per frame */
+	int isFieldOfViewSupported;
+
+	/* (bool) whether to use aspect ratio per frame */
+	int isAspectRatioSupported;
+
+	/* (bool) whether to use focal length per frame */
+	int isFocalLengthSupported;
+
+	/* (bool) whether to use projection mode per frame */
+	int isProjectionModeSupported;
+
+	/* film back, only for cinematic camera, values greater than 0 will be applied */
+	float filmBackWidth;
+	float filmBackHeight;
+
+	/* (bool) whether to use aperture per frame */
+	int isApertureSupported;
+
+	/* (bool) whether to use focus distance per frame */
+	int isFocusDistanceSupported;
+};
+
+struct UnrealLiveLink_Camera
+{
+	/* transform */
+	struct UnrealLiveLink_Transform transform;
+
+	/* Field of View of the camera in degrees */
+	float fieldOfView;
+
+	/* Aspect Ratio of the camera (Width / Height) */
+	float aspectRatio;
+
+	/* Focal length of the camera */
+	float focalLength;
+
+	/* Aperture of the camera in terms of f-stop */
+	float aperture;
+
+	/* Focus distance of the camera in cm. Works only in manual focus method */
+	float focusDistance;
+
+	/* projection mode of the camera */
+	/* (bool) true is perspective, false is orthographic */
+	int isPerspective;
+};
+
+struct UnrealLiveLink_LightStatic
+{
+	/* (bool) whether to use temperature per frame */
+	int isTemperatureSupported;
+
+	/* (bool) whether to use intensity per frame */
+	int isIntensitySupported;
+
+	/* (bool) whether to use light color per frame */
+	int isLightColorSupported;
+
+	/* (bool) whether to use inner cone angle per frame, spotlight only */
+	int isInnerConeAngleSupported;
+
+	/* (bool) whether to use outer cone angle per frame, spotlight only */
+	int isOuterConeAngleSupported;
+
+	/* (bool) whether to use attenuation radius per frame */
+	int isAttenuationRadiusSupported;
+
+	/* (bool) whether to use source length per frame */
+	int isSourceLengthSupported;
+
+	/* (bool) whether to use source radius per frame */
+	int isSourceRadiusSupported;
+
+	/* (bool) whether to use soft source radius per frame */
+	int isSoftSourceRadiusSupported;
+};
+
+struct UnrealLiveLink_Light
+{
+	/* transform */
+	struct UnrealLiveLink_Transform transform;
+
+	/* color temperature in Kelvin of the blackbody illuminant */
+	float temperature;
+
+	/* total energy that the light emits in lux. */
+	float intensity;
+
+	/* filter color of the light (rgb). */
+	uint8_t lightColor[3];
+
+	/* inner cone angle in degrees for a Spotlight. */
+	float innerConeAngle;
+
+	/* outer cone angle in degrees for a Spotlight. */
+	float outerConeAngle;
+
+	/* light visible influence. Works for Pointlight and Spotlight. */
+	float attenuationRadius;
+
+	/* radius of light source shape. Works for Pointlight and Spotlight. */
+	float sourceRadius;
+
+	/* soft radius of light source shape. Works for Pointlight and Spotlight. */
+	float softSourceRadius;
+
+	/* length of light source shape. Works for Pointlight and Spotlight. */
+	float sourceLength;
+};
+
+
+/* servicing of the message bus by the core ticker */
+struct UnrealLiveLink_TickerStats
+{
+	/* ticks from the ticker thread, UnrealLiveLink_Pump and providers starting or stopping */
+	uint64_t tickCount;
+
+	/* seconds between ticks */
+	double meanInterval;
+	double maxInterval;
+};
+
+/* connection detection of a provider */
+struct UnrealLiveLink_ConnectionStats
+{
+	/* seconds from the provider starting to its first connection, negative until connected */
+	double connectSeconds;
+
+	/* connection changes since the provider was created */
+	uint64_t changeCount;
+};
+
+/* how a provider treats the worldTime given to its updates */
+struct UnrealLiveLink_ClockSettings
+{
+	/* seconds per unit of worldTime (1 for seconds, 0.001 for milliseconds), 0 turns the clock estimate off */
+	double timeScale;
+
+	/* seconds of frames the offset and drift are estimated over, 0 for the default of 10 */
+	double window;
+
+	/* send world times mapped onto the library's clock (seconds since an arbitrary start, as Unreal's own providers send), otherwise as given */
+	int rewriteWorldTime;
+};
+
+/* estimate of a producer's clock against the library's clock */
+struct UnrealLiveLink_ClockStats
+{
+	/* library clock minus producer time in seconds, including the smallest call latency seen */
+	double offset;
+
+	/* producer clock rate error in seconds per second, positive if the producer clock runs slow */
+	double drift;
+
+	/* deviation in seconds of frame arrivals from the fit */
+	double jitter;
+
+	/* distinct world times in the estimate */
+	int sampleCount;
+};
+
+/**
+ * UdpMessaging transport settings shared by all providers
+ * fill with UnrealLiveLink_GetTransportSettings and change what is needed, empty names and values <= 0 are left unchanged
+ */
+struct UnrealLiveLink_TransportSettings
+{
+	/* address:port messages are received on, its address also selects the network interface used for multicast */
+	UnrealLiveLink_Name unicastEndpoint;
+
+	/* multicast group address:port used for discovery */
+	UnrealLiveLink_Name multicastEndpoint;
+
+	/* hops multicast packets may take (1 to 255) */
+	int multicastTimeToLive;
+
+	/* size of the transport's work queue of pending messages */
+	int workQueueSize;
+
+	/* maximum send rate in Gbit/s */
+	float maxSendRate;
+};
+
+/**
+ * capabilities of the loaded Unreal Live Link C Interface (UnrealLiveLink_GetCapabilities)
+ * functions added to UnrealLiveLink_Interface after UNREAL_LIVE_LINK_INTERFACE_API_VERSION may be null, test their bit before use
+ * shared objects older than UNREAL_LIVE_LINK_INTERFACE_API_VERSION report no bits, only their UNREAL_LIVE_LINK_MIN_API_VERSION
+ * functions are guaranteed and any others are null if they don't export them
+ */
+#define UNREAL_LIVE_LINK_CAPABILITY_PROVIDERS		0x0001	/* named providers (UnrealLiveLink_CreateProvider, ...) */
+#define UNREAL_LIVE_LINK_CAPABILITY_BATCH		0x0002	/* UnrealLiveLink_ProviderUpdateAnimationFrames */
+#define UNREAL_LIVE_LINK_CAPABILITY_SKELETON_TEMPLATES	0x0004	/* UnrealLiveLink_RegisterSkeletonTemplate, ... */
+#define UNREAL_LIVE_LINK_CAPABILITY_MATRICES		0x0008	/* matrix frame updates */
+#define UNREAL_LIVE_LINK_CAPABILITY_PACKED		0x0010	/* packed names and metadata */
+#define UNREAL_LIVE_LINK_CAPABILITY_FRAME_PROCESSING	0x0020	/* validation, filters, resampling and extrapolation */
+#define UNREAL_LIVE_LINK_CAPABILITY_PARALLEL_SETUP	0x0040	/* large skeleton names interned on worker threads */
+#define UNREAL_LIVE_LINK_CAPABILITY_TRANSPORT_SETTINGS	0x0080	/* UnrealLiveLink_SetTransportSettings, UnrealLiveLink_GetTransportSettings */
+#define UNREAL_LIVE_LINK_CAPABILITY_TICKER		0x0100	/* UnrealLiveLink_SetTickerRate, UnrealLiveLink_Pump and their stats */
+#define UNREAL_LIVE_LINK_CAPABILITY_CLOCK		0x0200	/* UnrealLiveLink_ProviderSetClock, UnrealLiveLink_ProviderGetClockStats */
+#define UNREAL_LIVE_LINK_CAPABILITY_SKELETON_MAPS	0x0400	/* UnrealLiveLink_CreateSkeletonMap, UnrealLiveLink_ProviderUpdateAnimationFrameMapped, ... */
+#define UNREAL_LIVE_LINK_CAPABILITY_SPARSE		0x0800	/* UnrealLiveLink_ProviderUpdateBasicFrameSparse, UnrealLiveLink_ProviderUpdateAnimationFrameSparse */
+
+/**
+ * the Unreal Live Link C Interface functions returned by the shared object's UnrealLiveLink_GetInterface
+ * the table is only appended to so a client and shared object of different versions share the prefix both know,
+ * members past size are treated as null
+ */
+struct UnrealLiveLink_Interface
+{
+	/* UNREAL_LIVE_LINK_API_VERSION of the shared object */
+	int version;
+
+	/* sizeof the table in the shared object */
+	int size;
+
+	/* UNREAL_LIVE_LINK_CAPABILITY_* bits */
+	unsigned int capabilities;
+
+	void (*Initialize)(void);
+	void (*Shutdown)(void);
+
+	int (*GetVersion)(void);
+
+	void (*SetProviderName)(const char *);
+
+	int (*StartLiveLink)(void);
+	int (*StopLiveLink)(void);
+
+	void (*SetUnicastEndpoint)(const char* endpoint);
+	int (*AddStaticEndpoint)(const char* endpoint);
+	int (*RemoveStaticEndpoint)(const char* endpoint);
+
+	void (*RegisterConnectionUpdateCallback)(void (*callback)());
+	int (*HasConnection)(void);
+
+	void (*SetBasicStructure)(const char *subjectName, const struct UnrealLiveLink_Properties *properties);
+	void (*UpdateBasicFrame)(const char *subjectName, const double worldTime, const struct UnrealLiveLink_Metadata *metadata,
+		const struct UnrealLiveLink_PropertyValues *propValues);
+
+	void (*SetAnimationStructure)(
+		const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_AnimationStatic *structure);
+	void (*UpdateAnimationFrame)(const char *subjectName, const double worldTime,
+		const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+		const struct UnrealLiveLink_Animation *frame);
+
+	void (*SetTransformStructure)(const char *subjectName, const struct UnrealLiveLink_Properties *properties);
+	void (*UpdateTransformFrame)(const char *subjectName, const double worldTime,
+		const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+		const struct UnrealLiveLink_Transform *frame);
+
+	void (*SetCameraStructure)(
+		const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_CameraStatic *structure);
+	void (*UpdateCameraFrame)(const char *subjectName, const double worldTime, const struct UnrealLiveLink_Metadata *metadata,
+		const struct UnrealLiveLink_PropertyValues *propValues, const struct UnrealLiveLink_Camera *frame);
+
+	void (*SetLightStructure)(
+		const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_LightStatic *structure);
+	void (*UpdateLightFrame)(const char *subjectName, const double worldTime, const struct UnrealLiveLink_Metadata *metadata,
+		const struct UnrealLiveLink_PropertyValues *propValues, const struct UnrealLiveLink_Light *frame);
+
+	int (*CreateProvider)(const char *providerName);
+	int (*DestroyProvider)(int provider);
+	int (*StartProvider)(int provider);
+	int (*StopProvider)(int provider);
+
+	int (*RegisterProviderConnectionUpdateCallback)(int provider, void (*callback)());
+	int (*ProviderHasConnection)(int provider);
+
+	int (*ProviderGetStaticDataStats)(int provider, struct UnrealLiveLink_StaticDataStats *stats);
+
+	int (*ProviderSetBasicStructure)(int provider, const char *subjectName, const struct UnrealLiveLink_Properties *properties);
+	int (*ProviderUpdateBasicFrame)(int provider, const char *subjectName, const double worldTime,
+		const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues);
+
+	int (*ProviderSetAnimationStructure)(int provider,
+		const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_AnimationStatic *structure);
+	int (*ProviderUpdateAnimationFrame)(int provider, const char *subjectName, const double worldTime,
+		const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+		const struct UnrealLiveLink_Animation *frame);
+	int (*ProviderUpdateAnimationFrames)(int provider, const struct UnrealLiveLink_AnimationSubjectFrame *frames, int frameCount);
+
+	int (*RegisterSkeletonTemplate)(
+		const struct UnrealLiveLink_Properties *properties, const struct UnrealLiveLink_AnimationStatic *structure);
+	int (*UnregisterSkeletonTemplate)(int skeletonTemplate);
+	int (*ProviderSetAnimationStructureFromTemplate)(int provider, const char *subjectName, int skeletonTemplate);
+
+	int (*ProviderSetAnimationTransformSpace)(int provider, const char *subjectName, enum UnrealLiveLink_TransformSpace space);
+	int (*ProviderSetRotationOrder)(int provider, const char *subjectName, enum UnrealLiveLink_RotationOrder order, int isRadians);
+
+	int (*ProviderSetValidation)(int provider, const char *subjectName, enum UnrealLiveLink_ValidationMode mode, float maxAbsValue);
+	int (*ProviderGetValidationStats)(int provider, struct UnrealLiveLink_ValidationStats *stats);
+	int (*ProviderSetFilter)(int provider, const char *subjectName, enum UnrealLiveLink_FilterChannel channel,
+		const struct UnrealLiveLink_FilterSettings *settings);
+	int (*ProviderSetResampling)(int provider, const char *subjectName, double outputRate, double delay);
+	int (*ProviderSetExtrapolation)(int provider, const char *subjectName, const struct UnrealLiveLink_ExtrapolationSettings *settings);
+	int (*ProviderGetExtrapolationStats)(int provider, struct UnrealLiveLink_ExtrapolationStats *stats);
+
+	int (*ProviderUpdateTransformFrameMatrix)(int provider, const char *subjectName, const double worldTime,
+		const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+		const struct UnrealLiveLink_Matrix *frame);
+	int (*ProviderUpdateAnimationFrameMatrices)(int provider, const char *subjectName, const double worldTime,
+		const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+		const struct UnrealLiveLink_AnimationMatrices *frame);
+	int (*ProviderUpdateCameraFrameMatrix)(int provider, const char *subjectName, const double worldTime,
+		const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+		const struct UnrealLiveLink_Camera *frame, const struct UnrealLiveLink_Matrix *transform);
+	int (*ProviderUpdateLightFrameMatrix)(int provider, const char *subjectName, const double worldTime,
+		const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+		const struct UnrealLiveLink_Light *frame, const struct UnrealLiveLink_Matrix *transform);
+
+	int (*ProviderSetBasicStructurePacked)(int provider, const char *subjectName,
+		const struct UnrealLiveLink_PackedStrings *propertyNames);
+	int (*ProviderUpdateBasicFramePacked)(int provider, const char *subjectName, const double worldTime,
+		const struct UnrealLiveLink_PackedMetadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues);
+	int (*ProviderSetAnimationStructurePacked)(int provider, const char *subjectName,
+		const struct UnrealLiveLink_PackedStrings *propertyNames, const struct UnrealLiveLink_PackedAnimationStatic *structure);
+	int (*ProviderUpdateAnimationFramePacked)(int provider, const char *subjectName, const double worldTime,
+		const struct UnrealLiveLink_PackedMetadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+		const struct UnrealLiveLink_Animation *frame);
+	int (*ProviderGetSkeletonSetupStats)(int provider, struct UnrealLiveLink_SkeletonSetupStats *stats);
+
+	int (*ProviderSetTransformStructure)(int provider, const char *subjectName, const struct UnrealLiveLink_Properties *properties);
+	int (*ProviderUpdateTransformFrame)(int provider, const char *subjectName, const double worldTime,
+		const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+		const struct UnrealLiveLink_Transform *frame);
+
+	int (*ProviderSetCameraStructure)(int provider,
+		const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_CameraStatic *structure);
+	int (*ProviderUpdateCameraFrame)(int provider, const char *subjectName, const double worldTime,
+		const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+		const struct UnrealLiveLink_Camera *frame);
+
+	int (*ProviderSetLightStructure)(int provider,
+		const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_LightStatic *structure);
+	int (*ProviderUpdateLightFrame)(int provider, const char *subjectName, const double worldTime,
+		const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+		const struct UnrealLiveLink_Light *frame);
+
+	/* UNREAL_LIVE_LINK_CAPABILITY_TRANSPORT_SETTINGS */
+	int (*SetTransportSettings)(const struct UnrealLiveLink_TransportSettings *settings);
+	int (*GetTransportSettings)(struct UnrealLiveLink_TransportSettings *settings);
+
+	/* UNREAL_LIVE_LINK_CAPABILITY_TICKER */
+	int (*SetTickerRate)(double rate);
+	int (*Pump)(void);
+	int (*GetTickerStats)(struct UnrealLiveLink_TickerStats *stats);
+	int (*ProviderGetConnectionStats)(int provider, struct UnrealLiveLink_ConnectionStats *stats);
+
+	/* UNREAL_LIVE_LINK_CAPABILITY_CLOCK */
+	int (*ProviderSetClock)(int provider, const struct UnrealLiveLink_ClockSettings *settings);
+	int (*ProviderGetClockStats)(int provider, struct UnrealLiveLink_ClockStats *stats);
+
+	/* UNREAL_LIVE_LINK_CAPABILITY_SKELETON_MAPS */
+	int (*CreateSkeletonMap)(const struct UnrealLiveLink_Properties *sourceNames, const struct UnrealLiveLink_AnimationStatic *structure);
+	int (*DestroySkeletonMap)(int skeletonMap);
+	int (*ProviderUpdateAnimationFrameMapped)(int provider, const char *subjectName, const double worldTime,
+		const struct UnrealLiveLink_PackedMetadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+		int skeletonMap, const struct UnrealLiveLink_Animation *frame);
+
+	/* UNREAL_LIVE_LINK_CAPABILITY_SPARSE */
+	int (*ProviderUpdateBasicFrameSparse)(int provider, const char *subjectName, const double worldTime,
+		const struct UnrealLiveLink_PackedMetadata *metadata, const struct UnrealLiveLink_SparsePropertyValues *propValues);
+	int (*ProviderUpdateAnimationFrameSparse)(int provider, const char *subjectName, const double worldTime,
+		const struct UnrealLiveLink_PackedMetadata *metadata, const struct UnrealLiveLink_SparsePropertyValues *propValues,
+		const struct UnrealLiveLink_SparseTransforms *frame);
+};
+
+#endif
+
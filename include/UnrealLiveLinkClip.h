@@ -0,0 +1,145 @@
+/** 
+ * Copyright (c) 2020 Patrick Palmer, The Jim Henson Company.
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef _UNREAL_LIVE_LINK_CLIP_H
+#define _UNREAL_LIVE_LINK_CLIP_H 1
+
+#include <stddef.h>
+
+#include "UnrealLiveLinkCInterfaceTypes.h"
+
+/**
+ * Compressed Animation Clips
+ *
+ * A clip holds the transforms of one skeleton over a run of frames at a fixed rate. The frames are split
+ * into blocks of blockFrames frames that decode independently, so playback can start at any frame by
+ * decoding a single block.
+ *
+ * Each bone has ten scalar tracks: rotation x, y, z and w, translation x, y and z and scale x, y and z.
+ * Within a block every track is quantized, reduced to the keys needed to stay within the tolerance when
+ * interpolated linearly, and stored as deltas between keys with a Rice code chosen per track.
+ * Rotations are quantized to 1/32767 per quaternion component after flipping each quaternion into the
+ * hemisphere of the previous frame's, decoded rotations are renormalized.
+ *
+ * These functions are part of the static library and don't need the shared object to be loaded.
+ * Decoders are independent of each other, one per subject can be used from separate threads.
+ */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define UNREAL_LIVE_LINK_CLIP_VERSION 1
+
+#define UNREAL_LIVE_LINK_CLIP_DEFAULT_BLOCK_FRAMES		32
+#define UNREAL_LIVE_LINK_CLIP_DEFAULT_TRANSLATION_PRECISION	0.001f
+#define UNREAL_LIVE_LINK_CLIP_DEFAULT_SCALE_PRECISION		0.0001f
+
+struct UnrealLiveLink_ClipSettings
+{
+	/* frames per block (seek granularity, at most 4096), 0 for UNREAL_LIVE_LINK_CLIP_DEFAULT_BLOCK_FRAMES */
+	int blockFrames;
+
+	/* largest error key reduction may add to a quaternion component, a translation and a scale, 0 keeps every frame */
+	float rotationTolerance;
+	float translationTolerance;
+	float scaleTolerance;
+
+	/* quantization steps, 0 for the UNREAL_LIVE_LINK_CLIP_DEFAULT_*_PRECISION values
+	 * translations and scales are limited to +/- 2^29 steps */
+	float translationPrecision;
+	float scalePrecision;
+};
+
+struct UnrealLiveLink_ClipInfo
+{
+	int boneCount;
+	int frameCount;
+	double frameRate;
+	int blockFrames;
+};
+
+/* decoding state of an open clip */
+struct UnrealLiveLink_ClipDecoder;
+
+/**
+ * compress frames of transforms into a clip
+ * @param transforms frameCount frames of boneCount transforms each, frame after frame
+ * @param boneCount transforms per frame
+ * @param frameCount number of frames
+ * @param frameRate frames per second, stored for playback
+ * @param settings compression settings (may pass in null for the defaults, which keep every frame)
+ * @param data receives the clip, release it with UnrealLiveLink_FreeClip
+ * @param size receives the size of the clip in bytes
+ * @return results (success returns UNREAL_LIVE_LINK_OK), UNREAL_LIVE_LINK_INVALID_STRUCTURE if the frame rate is not
+ * positive and finite or a precision is so large the decoded values could overflow
+ */
+extern int UnrealLiveLink_EncodeClip(const struct UnrealLiveLink_Transform *transforms, int boneCount, int frameCount, double frameRate,
+	const struct UnrealLiveLink_ClipSettings *settings, unsigned char **data, size_t *size);
+
+/**
+ * release a clip returned by UnrealLiveLink_EncodeClip
+ * @param data clip data
+ */
+extern void UnrealLiveLink_FreeClip(unsigned char *data);
+
+/**
+ * open a clip for decoding, the clip data is not copied and must stay valid until the decoder is closed
+ * @param data clip data
+ * @param size size of the clip in bytes
+ * @param decoder receives the decoder
+ * @return results (UNREAL_LIVE_LINK_INVALID_STRUCTURE if the data is not a clip of this version or its header
+ * holds a frame rate or precision UnrealLiveLink_EncodeClip doesn't write)
+ */
+extern int UnrealLiveLink_OpenClip(const unsigned char *data, size_t size, struct UnrealLiveLink_ClipDecoder **decoder);
+
+/**
+ * close a clip decoder
+ * @param decoder clip decoder
+ */
+extern void UnrealLiveLink_CloseClip(struct UnrealLiveLink_ClipDecoder *decoder);
+
+/**
+ * get the layout of an open clip
+ * @param decoder clip decoder
+ * @param info clip layout to fill
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int UnrealLiveLink_GetClipInfo(const struct UnrealLiveLink_ClipDecoder *decoder, struct UnrealLiveLink_ClipInfo *info);
+
+/**
+ * decode one frame of a clip, ready for UnrealLiveLink_ProviderUpdateAnimationFrame
+ * the frame's block is decoded whole on first use, later frames of the same block are copies
+ * @param decoder clip decoder
+ * @param frame frame index, 0 to frameCount - 1
+ * @param animation receives boneCount transforms, transformCount must be at least boneCount
+ * @return results (success returns UNREAL_LIVE_LINK_OK)
+ */
+extern int UnrealLiveLink_DecodeClipFrame(struct UnrealLiveLink_ClipDecoder *decoder, int frame, struct UnrealLiveLink_Animation *animation);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
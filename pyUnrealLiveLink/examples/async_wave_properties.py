@@ -0,0 +1,106 @@
+
+# 
+# Copyright (c) 2025 Patrick Palmer
+# 
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+# 
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+# 
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+
+#
+# Application showing the streaming of live link properties from asyncio
+# Frames are paced by a native frame clock and submitted without blocking the event loop
+# Use Unreal Live Link Debug UI to view the animated properties
+#
+
+import sys
+import math
+import asyncio
+import pyUnrealLiveLink as pyuell
+
+# number of steps to perform the wave
+STEP_COUNT = 10000
+
+
+async def report_connection():
+    while True:
+        connected = await pyuell.connection_changed()
+        print("Unreal connected" if connected else "Unreal disconnected")
+
+
+async def stream_wave():
+
+    channel_count = 32
+
+    channel = pyuell.PropertyValues()
+    channel.resize(channel_count)
+
+    channel_offset = math.pi * 2.0 / 32.0 / 3.0
+
+    # set up live link role
+    prop = pyuell.Properties()
+    for i in range(channel_count):
+        prop.append(f'Channel {i+1}')
+    pyuell.set_basic_structure("wave", prop)
+
+    metadata = pyuell.Metadata()
+
+    # 24 fps
+    clock = pyuell.FrameClock(24.0)
+
+    for i in range(STEP_COUNT):
+
+        frame_number = await clock.tick()
+
+        if (i % 96) == 0:
+            print(f'frame {frame_number}')
+
+        for c in range(channel_count):
+
+            f = float(frame_number + (channel_count - c)) * channel_offset
+
+            channel[c] = (math.sin(f) + 1.0) / 2.0
+
+        # the frame is copied on submit, channel can be changed straight away
+        rc = await pyuell.submit_basic_frame("wave", clock.time, metadata, channel)
+        if rc:
+            print(f"error: frame {frame_number} not sent (error {rc})")
+
+
+async def main():
+    connection = asyncio.create_task(report_connection())
+    await stream_wave()
+    connection.cancel()
+
+
+rc = pyuell.load()
+if rc:
+    print(f"error: unable to load Unreal Live Link shared object (error {rc})")
+    sys.exit(1)
+
+print("Starting...\n")
+
+pyuell.set_provider_name("AsyncWaveProperties")
+pyuell.start_live_link()
+
+asyncio.run(main())
+
+print("Done.")
+
+pyuell.unload()
+
+sys.exit(0)
@@ -1,510 +1,1781 @@
-/** 
- * Copyright (c) 2025 Patrick Palmer
- * 
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files (the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions:
- * 
- * The above copyright notice and this permission notice shall be included in
- * all copies or substantial portions of the Software.
- * 
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
- * SOFTWARE.
- */
-
-#include <pybind11/pybind11.h>
-#include <pybind11/stl.h>
-#include <pybind11/stl_bind.h>
-#include <string>
-#include <array>
-#include <vector>
-
-extern "C" {
-#include "UnrealLiveLinkCInterfaceAPI.h"
-}
-
-#define STRINGIFY(x) #x
-#define MACRO_STRINGIFY(x) STRINGIFY(x)
-
-namespace py = pybind11;
-
-PYBIND11_MAKE_OPAQUE(std::vector<std::string>);
-PYBIND11_MAKE_OPAQUE(std::vector<float>);
-
-
-struct Transform
-{
-    std::array<float, 4> rotation = { 0, 0, 0, 0 };
-    std::array<float, 3> translation = { 0, 0, 0 };
-    std::array<float, 3> scale = { 1, 1, 1 };
-};
-
-typedef std::vector<std::string> Properties;
-typedef std::vector<float> PropertyValues;
-
-struct KeyValue
-{
-    std::string key;
-    std::string value;
-};
-
-struct Metadata
-{
-    std::vector<KeyValue> keyValues;
-    UnrealLiveLink_Timecode timecode;
-};
-
-struct Bone
-{
-    std::string name;
-    int parentIndex{ -1 };      // -1 is root
-};
-
-PYBIND11_MAKE_OPAQUE(std::vector<Bone>);
-PYBIND11_MAKE_OPAQUE(std::vector<Transform>);
-
-typedef std::vector<Bone> AnimationStatic;
-typedef std::vector<Transform> Animation;
-
-struct Camera
-{
-    Transform transform;
-    float fieldOfView{ 90.0f };
-    float aspectRatio{ 1.777778f };
-    float focalLength{ 50.0f };
-    float aperture{ 2.8f };
-    float focusDistance{ 100000.0f };
-    int isPerspective{1};
-};
-
-struct Light
-{
-    Transform transform;
-    float temperature{ 6500.0f };
-    float intensity{ 3.1415926535897932f };
-    std::array<uint8_t, 3> lightColor = { 255, 255, 255 };
-    float innerConeAngle{ 0 };
-    float outerConeAngle{ 44.0f };
-    float attenuationRadius{ 1000.0f };
-    float sourceRadius{ 0 };
-    float softSourceRadius{ 0 };
-    float sourceLength{ 0 };
-};
-
-typedef std::vector<UnrealLiveLink_KeyValue> KeyValueCache;
-
-static void CopyMetadata(const Metadata& metadata, UnrealLiveLink_Metadata& uellmeta, KeyValueCache &cache)
-{
-    uellmeta.keyValueCount = metadata.keyValues.size();
-    cache.resize(metadata.keyValues.size());
-    for (size_t i = 0; i < uellmeta.keyValueCount; i++)
-    {
-        ::strncpy(cache[i].name, metadata.keyValues[i].key.c_str(), UNREAL_LIVE_LINK_MAX_NAME_LENGTH);
-        cache[i].name[UNREAL_LIVE_LINK_MAX_NAME_LENGTH - 1] = '\0';
-        ::strncpy(cache[i].value, metadata.keyValues[i].value.c_str(), UNREAL_LIVE_LINK_MAX_NAME_LENGTH);
-        cache[i].value[UNREAL_LIVE_LINK_MAX_NAME_LENGTH - 1] = '\0';
-    }
-    uellmeta.keyValues = cache.data();
-
-    uellmeta.timecode = metadata.timecode;
-}
-
-typedef std::vector<std::array<char, UNREAL_LIVE_LINK_MAX_NAME_LENGTH>> NameCache;
-
-static void CopyProperties(const Properties &properties, UnrealLiveLink_Properties &uellprop, NameCache &cache)
-{
-    uellprop.nameCount = properties.size();
-    cache.resize(properties.size());
-    for (size_t i = 0; i < uellprop.nameCount; i++)
-    {
-        ::strncpy(cache[i].data(), properties[i].c_str(), UNREAL_LIVE_LINK_MAX_NAME_LENGTH);
-        cache[i].data()[UNREAL_LIVE_LINK_MAX_NAME_LENGTH - 1] = '\0';
-    }
-    uellprop.names = reinterpret_cast<UnrealLiveLink_Name*>(cache.data());
-}
-
-static void CopyPropertyValues(const PropertyValues& property_values, UnrealLiveLink_PropertyValues& uellpropval)
-{
-    uellpropval.values = const_cast<float*>(property_values.data());
-    uellpropval.valueCount = property_values.size();
-}
-
-static void CopyTransform(const Transform& transform, UnrealLiveLink_Transform& uellTransform)
-{
-    for (size_t i = 0; i < 4; i++)
-    {
-        uellTransform.rotation[i] = transform.rotation[i];
-    }
-    for (size_t i = 0; i < 3; i++)
-    {
-        uellTransform.translation[i] = transform.translation[i];
-        uellTransform.scale[i] = transform.scale[i];
-    }
-}
-
-static void SetBasicStructure(const std::string& subject_name, const Properties& properties)
-{
-    if (UnrealLiveLink_SetBasicStructure != NULL) 
-    {
-        UnrealLiveLink_Properties uellprop;
-        NameCache cache;
-        CopyProperties(properties, uellprop, cache);
-
-        UnrealLiveLink_SetBasicStructure(subject_name.c_str(), &uellprop);
-    }
-}
-
-static void UpdateBasicFrame(const std::string & subject_name, const double world_time,
-    const Metadata& metadata, const PropertyValues& property_values)
-{
-    if (UnrealLiveLink_UpdateBasicFrame != NULL)
-    {
-        UnrealLiveLink_Metadata uellmeta;
-        KeyValueCache kvcache;
-        CopyMetadata(metadata, uellmeta, kvcache);
-
-        UnrealLiveLink_PropertyValues uellpropval;
-        CopyPropertyValues(property_values, uellpropval);
-
-        UnrealLiveLink_UpdateBasicFrame(subject_name.c_str(), world_time, &uellmeta, &uellpropval);
-    }
-}
-
-static void SetTransformStructure(const std::string& subject_name, const Properties& properties)
-{
-    if (UnrealLiveLink_SetTransformStructure != NULL) 
-    {
-        UnrealLiveLink_Properties uellprop;
-        NameCache cache;
-        CopyProperties(properties, uellprop, cache);
-
-        UnrealLiveLink_SetTransformStructure(subject_name.c_str(), &uellprop);
-    }
-}
-
-static void UpdateTransformFrame(const std::string & subject_name, const double world_time,
-    const Metadata& metadata, const PropertyValues& property_values, const Transform &frame)
-{
-    if (UnrealLiveLink_UpdateTransformFrame != NULL)
-    {
-        UnrealLiveLink_Metadata uellmeta;
-        KeyValueCache kvcache;
-        CopyMetadata(metadata, uellmeta, kvcache);
-
-        UnrealLiveLink_PropertyValues uellpropval;
-        CopyPropertyValues(property_values, uellpropval);
-
-        UnrealLiveLink_Transform uelltransform;
-        CopyTransform(frame, uelltransform);
-
-        UnrealLiveLink_UpdateTransformFrame(subject_name.c_str(), world_time, &uellmeta, &uellpropval, &uelltransform);
-    }
-}
-
-static void SetCameraStructure(const std::string& subject_name, const Properties& properties, UnrealLiveLink_CameraStatic &camera)
-{
-    if (UnrealLiveLink_SetCameraStructure != NULL) 
-    {
-        UnrealLiveLink_Properties uellprop;
-        NameCache cache;
-        CopyProperties(properties, uellprop, cache);
-
-        UnrealLiveLink_SetCameraStructure(subject_name.c_str(), &uellprop, &camera);
-    }
-}
-
-static void UpdateCameraFrame(const std::string & subject_name, const double world_time,
-    const Metadata& metadata, const PropertyValues& property_values, Camera &camera)
-{
-    if (UnrealLiveLink_UpdateCameraFrame != NULL)
-    {
-        UnrealLiveLink_Metadata uellmeta;
-        KeyValueCache kvcache;
-        CopyMetadata(metadata, uellmeta, kvcache);
-
-        UnrealLiveLink_PropertyValues uellpropval;
-        CopyPropertyValues(property_values, uellpropval);
-
-        UnrealLiveLink_Camera uellcamera;
-        CopyTransform(camera.transform, uellcamera.transform);
-        uellcamera.fieldOfView = camera.fieldOfView;
-        uellcamera.aspectRatio = camera.aspectRatio;
-        uellcamera.focalLength = camera.focalLength;
-        uellcamera.aperture = camera.aperture;
-        uellcamera.focusDistance = camera.focusDistance;
-        uellcamera.isPerspective = camera.isPerspective;
-
-        UnrealLiveLink_UpdateCameraFrame(subject_name.c_str(), world_time, &uellmeta, &uellpropval, &uellcamera);
-    }
-}
-
-static void SetLightStructure(const std::string& subject_name, const Properties& properties, UnrealLiveLink_LightStatic &light)
-{
-    if (UnrealLiveLink_SetLightStructure != NULL) 
-    {
-        UnrealLiveLink_Properties uellprop;
-        NameCache cache;
-        CopyProperties(properties, uellprop, cache);
-
-        UnrealLiveLink_SetLightStructure(subject_name.c_str(), &uellprop, &light);
-    }
-}
-
-static void UpdateLightFrame(const std::string & subject_name, const double world_time,
-    const Metadata& metadata, const PropertyValues& property_values, Light &light)
-{
-    if (UnrealLiveLink_UpdateBasicFrame != NULL)
-    {
-        UnrealLiveLink_Metadata uellmeta;
-        KeyValueCache kvcache;
-        CopyMetadata(metadata, uellmeta, kvcache);
-
-        UnrealLiveLink_PropertyValues uellpropval;
-        CopyPropertyValues(property_values, uellpropval);
-
-        UnrealLiveLink_Light uelllight;
-        CopyTransform(light.transform, uelllight.transform);
-        uelllight.temperature = light.temperature;
-        uelllight.intensity = light.intensity;
-        for (size_t i = 0; i < 3; i++)
-        {
-            uelllight.lightColor[i] = light.lightColor[i];
-        }
-        std::array<uint8_t, 3> lightColor = { 255, 255, 255 };
-        uelllight.innerConeAngle = light.innerConeAngle;
-        uelllight.outerConeAngle = light.outerConeAngle;
-        uelllight.attenuationRadius = light.attenuationRadius;
-        uelllight.sourceRadius = light.sourceRadius;
-        uelllight.softSourceRadius = light.softSourceRadius;
-        uelllight.sourceLength = light.sourceLength;
-
-        UnrealLiveLink_UpdateLightFrame(subject_name.c_str(), world_time, &uellmeta, &uellpropval, &uelllight);
-    }
-}
-
-static void SetAnimationStructure(const std::string& subject_name, const Properties& properties, AnimationStatic &animation)
-{
-    if (UnrealLiveLink_SetAnimationStructure != NULL) 
-    {
-        UnrealLiveLink_Properties uellprop;
-        NameCache cache;
-        CopyProperties(properties, uellprop, cache);
-
-        std::vector<UnrealLiveLink_Bone> bone_cache(animation.size());
-        for (size_t i = 0; i < animation.size(); i++)
-        {
-            ::strncpy(bone_cache[i].name, animation[i].name.c_str(), UNREAL_LIVE_LINK_MAX_NAME_LENGTH);
-            bone_cache[i].name[UNREAL_LIVE_LINK_MAX_NAME_LENGTH - 1] = '\0';
-            bone_cache[i].parentIndex = animation[i].parentIndex;
-        }
-        UnrealLiveLink_AnimationStatic uellanim;
-        uellanim.bones = bone_cache.data();
-        uellanim.boneCount = animation.size();
-
-        UnrealLiveLink_SetAnimationStructure(subject_name.c_str(), &uellprop, &uellanim);
-    }
-}
-
-static void UpdateAnimationFrame(const std::string & subject_name, const double world_time,
-    const Metadata& metadata, const PropertyValues& property_values, Animation &animation)
-{
-    if (UnrealLiveLink_UpdateAnimationFrame != NULL)
-    {
-        UnrealLiveLink_Metadata uellmeta;
-        KeyValueCache kvcache;
-        CopyMetadata(metadata, uellmeta, kvcache);
-
-        UnrealLiveLink_PropertyValues uellpropval;
-        CopyPropertyValues(property_values, uellpropval);
-
-        UnrealLiveLink_Animation uellanim;
-        uellanim.transforms = reinterpret_cast<UnrealLiveLink_Transform *>(animation.data());
-        uellanim.transformCount = animation.size();
-
-        UnrealLiveLink_UpdateAnimationFrame(subject_name.c_str(), world_time, &uellmeta, &uellpropval, &uellanim);
-    }
-}
-
-PYBIND11_MODULE(pyUnrealLiveLink, m) {
-
-    pybind11::enum_<UnrealLiveLink_TimecodeFormat>(m, "TimecodeFormat")
-        .value("UNKNOWN", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_UNKNOWN)
-        .value("FC_23_98", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_23_98)
-        .value("FC_24", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_24)
-        .value("FC_25", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_25)
-        .value("FC_29_97_NDF", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_29_97_NDF)
-        .value("FC_29_97_DF", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_29_97_DF)
-        .value("FC_30", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_30)
-        .value("FC_47_95", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_47_95)
-        .value("FC_48", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_48)
-        .value("FC_50", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_50)
-        .value("FC_59_94_NDF", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_59_94_NDF)
-        .value("FC_59_94_DF", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_59_94_DF)
-        .value("FC_60", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_60)
-        .value("FC_72", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_72)
-        .value("FC_96", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_96)
-        .value("FC_100", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_100)
-        .value("FC_120", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_120);
-
-    pybind11::class_<UnrealLiveLink_Timecode>(m, "Timecode")
-        .def(pybind11::init<>([]() {
-            auto tc = UnrealLiveLink_Timecode();
-            tc.hours = tc.minutes = tc.seconds = tc.frames = 0;
-            tc.format = UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_UNKNOWN;
-            return tc;
-        }))
-        .def_readwrite("hours", &UnrealLiveLink_Timecode::hours)
-        .def_readwrite("minutes", &UnrealLiveLink_Timecode::minutes)
-        .def_readwrite("seconds", &UnrealLiveLink_Timecode::seconds)
-        .def_readwrite("frames", &UnrealLiveLink_Timecode::frames)
-        .def_readwrite("format", &UnrealLiveLink_Timecode::format);
-
-    pybind11::class_<UnrealLiveLink_CameraStatic>(m, "CameraStatic")
-        .def(pybind11::init<>([]() { 
-            auto cs = UnrealLiveLink_CameraStatic(); 
-            UnrealLiveLink_InitCameraStatic(&cs); 
-            return cs;
-        }))
-        .def_readwrite("is_field_of_view_supported", &UnrealLiveLink_CameraStatic::isFieldOfViewSupported)
-        .def_readwrite("is_aspect_ratio_supported", &UnrealLiveLink_CameraStatic::isAspectRatioSupported)
-        .def_readwrite("is_focal_length_supported", &UnrealLiveLink_CameraStatic::isFocalLengthSupported)
-        .def_readwrite("is_projection_mode_supported", &UnrealLiveLink_CameraStatic::isProjectionModeSupported)
-        .def_readwrite("film_back_width", &UnrealLiveLink_CameraStatic::filmBackWidth)
-        .def_readwrite("film_back_height", &UnrealLiveLink_CameraStatic::filmBackHeight)
-        .def_readwrite("is_aperture_supported", &UnrealLiveLink_CameraStatic::isApertureSupported)
-        .def_readwrite("is_focus_distance_supported", &UnrealLiveLink_CameraStatic::isFocusDistanceSupported);
-
-    pybind11::class_<Camera>(m, "Camera")
-        .def(pybind11::init<>())
-        .def_readwrite("transform", &Camera::transform)
-        .def_readwrite("field_of_view", &Camera::fieldOfView)
-        .def_readwrite("aspect_ratio", &Camera::aspectRatio)
-        .def_readwrite("focal_length", &Camera::focalLength)
-        .def_readwrite("aperture", &Camera::aperture)
-        .def_readwrite("focus_distance", &Camera::focusDistance)
-        .def_readwrite("is_perspective", &Camera::isPerspective);
-
-    pybind11::class_<UnrealLiveLink_LightStatic>(m, "LightStatic")
-        .def(pybind11::init<>([]() {
-            auto ls = UnrealLiveLink_LightStatic();
-            UnrealLiveLink_InitLightStatic(&ls);
-            return ls;
-        }))
-        .def_readwrite("is_temperature_supported", &UnrealLiveLink_LightStatic::isTemperatureSupported)
-        .def_readwrite("is_intensity_supported", &UnrealLiveLink_LightStatic::isIntensitySupported)
-        .def_readwrite("is_light_color_supported", &UnrealLiveLink_LightStatic::isLightColorSupported)
-        .def_readwrite("is_inner_cone_angle_supported", &UnrealLiveLink_LightStatic::isInnerConeAngleSupported)
-        .def_readwrite("is_outer_cone_angle_supported", &UnrealLiveLink_LightStatic::isOuterConeAngleSupported)
-        .def_readwrite("is_attenuation_radius_supported", &UnrealLiveLink_LightStatic::isAttenuationRadiusSupported)
-        .def_readwrite("is_source_length_supported", &UnrealLiveLink_LightStatic::isSourceLengthSupported)
-        .def_readwrite("is_source_radius_supported", &UnrealLiveLink_LightStatic::isSourceRadiusSupported)
-        .def_readwrite("is_soft_source_radius_supported", &UnrealLiveLink_LightStatic::isSoftSourceRadiusSupported);
-
-    pybind11::class_<Light>(m, "Light")
-        .def(pybind11::init<>())
-        .def_readwrite("transform", &Light::transform)
-        .def_readwrite("temperature", &Light::temperature)
-        .def_readwrite("intensity", &Light::intensity)
-        .def_readwrite("light_color", &Light::lightColor)
-        .def_readwrite("inner_cone_angle", &Light::innerConeAngle)
-        .def_readwrite("outer_cone_angle", &Light::outerConeAngle)
-        .def_readwrite("attenuation_radius", &Light::attenuationRadius)
-        .def_readwrite("source_radius", &Light::sourceRadius)
-        .def_readwrite("soft_source_radius", &Light::softSourceRadius)
-        .def_readwrite("source_length", &Light::sourceLength);
-
-    pybind11::class_<Transform>(m, "Transform")
-        .def(pybind11::init<>())
-        .def_readwrite("rotation", &Transform::rotation)
-        .def_readwrite("translation", &Transform::translation)
-        .def_readwrite("scale", &Transform::scale);
-
-    pybind11::class_<KeyValue>(m, "KeyValue")
-        .def(pybind11::init<>())
-        .def_readwrite("key", &KeyValue::key)
-        .def_readwrite("value", &KeyValue::value);
-
-    pybind11::class_<Metadata>(m, "Metadata")
-        .def(pybind11::init<>())
-        .def_readwrite("key_values", &Metadata::keyValues)
-        .def_readwrite("timecode", &Metadata::timecode);
-
-    pybind11::class_<Bone>(m, "Bone")
-        .def(pybind11::init<>())
-        .def_readwrite("name", &Bone::name)
-        .def_readwrite("parent_index", &Bone::parentIndex);
-
-    py::bind_vector<std::vector<std::string>>(m, "Properties");
-    py::bind_vector<std::vector<float>>(m, "PropertyValues");
-
-    py::bind_vector<std::vector<Bone>>(m, "AnimationStatic");
-    py::bind_vector<std::vector<Transform>>(m, "Animation");
-
-    m.def("load", []() -> int { 
-#ifdef WIN32
-        const char* sharedObj = "UnrealLiveLinkCInterface.dll";
-#else
-        const char* sharedObj = "libUnrealLiveLinkCInterface.so";
-#endif
-        return UnrealLiveLink_Load(sharedObj);
-    });
-    m.def("is_loaded", []() -> bool { return UnrealLiveLink_IsLoaded() == UNREAL_LIVE_LINK_OK; });
-    m.def("unload", []() -> void { UnrealLiveLink_Unload(); });
-
-    m.def("set_provider_name", [](const std::string& provider_name) -> void { 
-        if (UnrealLiveLink_SetProviderName != NULL) {
-            UnrealLiveLink_SetProviderName(provider_name.c_str());
-        }
-    });
-
-    m.def("get_version", []() -> int { return UnrealLiveLink_GetVersion != NULL ? UnrealLiveLink_GetVersion() : 0 ; });
-    m.def("has_connection", []() -> bool { return UnrealLiveLink_HasConnection != NULL ? UnrealLiveLink_HasConnection() == UNREAL_LIVE_LINK_OK : false; });
-
-    m.def("set_unicast_endpoint", [](const std::string& endpoint) -> void { 
-        if (UnrealLiveLink_SetUnicastEndpoint != NULL) {
-            UnrealLiveLink_SetUnicastEndpoint(endpoint.c_str());
-        }
-    });
-    m.def("add_static_endpoint", [](const std::string& endpoint) -> int { 
-        if (UnrealLiveLink_AddStaticEndpoint != NULL) {
-            return UnrealLiveLink_AddStaticEndpoint(endpoint.c_str());
-        }
-        return UNREAL_LIVE_LINK_NOT_LOADED;
-    });
-    m.def("remove_static_endpoint", [](const std::string& endpoint) -> int { 
-        if (UnrealLiveLink_RemoveStaticEndpoint != NULL) {
-            return UnrealLiveLink_RemoveStaticEndpoint(endpoint.c_str());
-        }
-        return UNREAL_LIVE_LINK_NOT_LOADED;
-    });
-
-    m.def("start_live_link", []() -> int { return UnrealLiveLink_StartLiveLink != NULL ? UnrealLiveLink_StartLiveLink() : UNREAL_LIVE_LINK_NOT_LOADED ; });
-    m.def("stop_live_link", []() -> int { return UnrealLiveLink_StopLiveLink != NULL ? UnrealLiveLink_StopLiveLink() : UNREAL_LIVE_LINK_NOT_LOADED ; });
-
-    m.def("set_basic_structure", &SetBasicStructure);
-    m.def("update_basic_frame", &UpdateBasicFrame);
-    m.def("set_transform_structure", &SetTransformStructure);
-    m.def("update_transform_frame", &UpdateTransformFrame);
-    m.def("set_animation_structure", &SetAnimationStructure);
-    m.def("update_animation_frame", &UpdateAnimationFrame);
-    m.def("set_camera_structure", &SetCameraStructure);
-    m.def("update_camera_frame", &UpdateCameraFrame);
-    m.def("set_light_structure", &SetLightStructure);
-    m.def("update_light_frame", &UpdateLightFrame);
-
-#ifdef VERSION_INFO
-    m.attr("__version__") = MACRO_STRINGIFY(VERSION_INFO);
-#else
-    m.attr("__version__") = "dev";
-#endif
-}
-
-
+/** 
+ * Copyright (c) 2025 Patrick Palmer
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <pybind11/stl_bind.h>
+#include <string>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+extern "C" {
+#include "UnrealLiveLinkCInterfaceAPI.h"
+#include "UnrealLiveLinkClip.h"
+}
+
+#define STRINGIFY(x) #x
+#define MACRO_STRINGIFY(x) STRINGIFY(x)
+
+namespace py = pybind11;
+
+PYBIND11_MAKE_OPAQUE(std::vector<std::string>);
+PYBIND11_MAKE_OPAQUE(std::vector<float>);
+
+
+struct Transform
+{
+    std::array<float, 4> rotation = { 0, 0, 0, 0 };
+    std::array<float, 3> translation = { 0, 0, 0 };
+    std::array<float, 3> scale = { 1, 1, 1 };
+};
+
+typedef std::vector<std::string> Properties;
+typedef std::vector<float> PropertyValues;
+
+struct KeyValue
+{
+    std::string key;
+    std::string value;
+};
+
+struct Metadata
+{
+    std::vector<KeyValue> keyValues;
+    UnrealLiveLink_Timecode timecode;
+};
+
+struct Bone
+{
+    std::string name;
+    int parentIndex{ -1 };      // -1 is root
+};
+
+PYBIND11_MAKE_OPAQUE(std::vector<Bone>);
+PYBIND11_MAKE_OPAQUE(std::vector<Transform>);
+
+typedef std::vector<Bone> AnimationStatic;
+typedef std::vector<Transform> Animation;
+
+// 4x4 matrix, 16 floats in UnrealLiveLink_Matrix order (translation is elements 12-14)
+typedef std::array<float, 16> Matrix;
+typedef std::vector<Matrix> AnimationMatrices;
+
+struct Camera
+{
+    Transform transform;
+    float fieldOfView{ 90.0f };
+    float aspectRatio{ 1.777778f };
+    float focalLength{ 50.0f };
+    float aperture{ 2.8f };
+    float focusDistance{ 100000.0f };
+    int isPerspective{1};
+};
+
+struct Light
+{
+    Transform transform;
+    float temperature{ 6500.0f };
+    float intensity{ 3.1415926535897932f };
+    std::array<uint8_t, 3> lightColor = { 255, 255, 255 };
+    float innerConeAngle{ 0 };
+    float outerConeAngle{ 44.0f };
+    float attenuationRadius{ 1000.0f };
+    float sourceRadius{ 0 };
+    float softSourceRadius{ 0 };
+    float sourceLength{ 0 };
+};
+
+typedef std::vector<UnrealLiveLink_KeyValue> KeyValueCache;
+
+static void CopyMetadata(const Metadata& metadata, UnrealLiveLink_Metadata& uellmeta, KeyValueCache &cache)
+{
+    uellmeta.keyValueCount = metadata.keyValues.size();
+    cache.resize(metadata.keyValues.size());
+    for (size_t i = 0; i < uellmeta.keyValueCount; i++)
+    {
+        ::strncpy(cache[i].name, metadata.keyValues[i].key.c_str(), UNREAL_LIVE_LINK_MAX_NAME_LENGTH);
+        cache[i].name[UNREAL_LIVE_LINK_MAX_NAME_LENGTH - 1] = '\0';
+        ::strncpy(cache[i].value, metadata.keyValues[i].value.c_str(), UNREAL_LIVE_LINK_MAX_NAME_LENGTH);
+        cache[i].value[UNREAL_LIVE_LINK_MAX_NAME_LENGTH - 1] = '\0';
+    }
+    uellmeta.keyValues = cache.data();
+
+    uellmeta.timecode = metadata.timecode;
+}
+
+typedef std::vector<std::array<char, UNREAL_LIVE_LINK_MAX_NAME_LENGTH>> NameCache;
+
+static void CopyProperties(const Properties &properties, UnrealLiveLink_Properties &uellprop, NameCache &cache)
+{
+    uellprop.nameCount = properties.size();
+    cache.resize(properties.size());
+    for (size_t i = 0; i < uellprop.nameCount; i++)
+    {
+        ::strncpy(cache[i].data(), properties[i].c_str(), UNREAL_LIVE_LINK_MAX_NAME_LENGTH);
+        cache[i].data()[UNREAL_LIVE_LINK_MAX_NAME_LENGTH - 1] = '\0';
+    }
+    uellprop.names = reinterpret_cast<UnrealLiveLink_Name*>(cache.data());
+}
+
+static void CopyPropertyValues(const PropertyValues& property_values, UnrealLiveLink_PropertyValues& uellpropval)
+{
+    uellpropval.values = const_cast<float*>(property_values.data());
+    uellpropval.valueCount = property_values.size();
+}
+
+typedef std::vector<UnrealLiveLink_Bone> BoneCache;
+
+static void CopyAnimationStatic(const AnimationStatic &animation, UnrealLiveLink_AnimationStatic &uellanim, BoneCache &cache)
+{
+    cache.resize(animation.size());
+    for (size_t i = 0; i < animation.size(); i++)
+    {
+        ::strncpy(cache[i].name, animation[i].name.c_str(), UNREAL_LIVE_LINK_MAX_NAME_LENGTH);
+        cache[i].name[UNREAL_LIVE_LINK_MAX_NAME_LENGTH - 1] = '\0';
+        cache[i].parentIndex = animation[i].parentIndex;
+    }
+    uellanim.bones = cache.data();
+    uellanim.boneCount = animation.size();
+}
+
+// strings for the packed API variants, copied once into a single buffer without truncation
+struct PackedStringCache
+{
+    std::string text;
+    std::vector<int> offsets;
+    std::vector<int> lengths;
+};
+
+static void AddPackedString(const std::string& str, PackedStringCache& cache)
+{
+    cache.offsets.push_back(static_cast<int>(cache.text.size()));
+    cache.lengths.push_back(static_cast<int>(str.size()));
+    cache.text += str;
+}
+
+static void SetPackedStrings(const PackedStringCache& cache, UnrealLiveLink_PackedStrings& uellstrings)
+{
+    uellstrings.text = cache.text.data();
+    uellstrings.offsets = cache.offsets.data();
+    uellstrings.lengths = cache.lengths.data();
+    uellstrings.count = cache.offsets.size();
+}
+
+static void PackProperties(const Properties& properties, UnrealLiveLink_PackedStrings& uellprop, PackedStringCache& cache)
+{
+    for (const std::string& name : properties)
+    {
+        AddPackedString(name, cache);
+    }
+    SetPackedStrings(cache, uellprop);
+}
+
+static void PackMetadata(const Metadata& metadata, UnrealLiveLink_PackedMetadata& uellmeta, PackedStringCache& key_cache, PackedStringCache& value_cache)
+{
+    for (const KeyValue& key_value : metadata.keyValues)
+    {
+        AddPackedString(key_value.key, key_cache);
+        AddPackedString(key_value.value, value_cache);
+    }
+    SetPackedStrings(key_cache, uellmeta.keys);
+    SetPackedStrings(value_cache, uellmeta.values);
+
+    uellmeta.timecode = metadata.timecode;
+}
+
+static void PackAnimationStatic(const AnimationStatic& animation, UnrealLiveLink_PackedAnimationStatic& uellanim,
+    PackedStringCache& cache, std::vector<int>& parents)
+{
+    parents.resize(animation.size());
+    for (size_t i = 0; i < animation.size(); i++)
+    {
+        AddPackedString(animation[i].name, cache);
+        parents[i] = animation[i].parentIndex;
+    }
+    SetPackedStrings(cache, uellanim.boneNames);
+    uellanim.parentIndices = parents.data();
+}
+
+static void CopyTransform(const Transform& transform, UnrealLiveLink_Transform& uellTransform)
+{
+    for (size_t i = 0; i < 4; i++)
+    {
+        uellTransform.rotation[i] = transform.rotation[i];
+    }
+    for (size_t i = 0; i < 3; i++)
+    {
+        uellTransform.translation[i] = transform.translation[i];
+        uellTransform.scale[i] = transform.scale[i];
+    }
+}
+
+static void CopyMatrix(const Matrix& matrix, UnrealLiveLink_Matrix& uellMatrix)
+{
+    ::memcpy(uellMatrix.m, matrix.data(), sizeof(uellMatrix.m));
+}
+
+static void CopyCamera(const Camera& camera, UnrealLiveLink_Camera& uellcamera)
+{
+    CopyTransform(camera.transform, uellcamera.transform);
+    uellcamera.fieldOfView = camera.fieldOfView;
+    uellcamera.aspectRatio = camera.aspectRatio;
+    uellcamera.focalLength = camera.focalLength;
+    uellcamera.aperture = camera.aperture;
+    uellcamera.focusDistance = camera.focusDistance;
+    uellcamera.isPerspective = camera.isPerspective;
+}
+
+static void CopyLight(const Light& light, UnrealLiveLink_Light& uelllight)
+{
+    CopyTransform(light.transform, uelllight.transform);
+    uelllight.temperature = light.temperature;
+    uelllight.intensity = light.intensity;
+    for (size_t i = 0; i < 3; i++)
+    {
+        uelllight.lightColor[i] = light.lightColor[i];
+    }
+    uelllight.innerConeAngle = light.innerConeAngle;
+    uelllight.outerConeAngle = light.outerConeAngle;
+    uelllight.attenuationRadius = light.attenuationRadius;
+    uelllight.sourceRadius = light.sourceRadius;
+    uelllight.softSourceRadius = light.softSourceRadius;
+    uelllight.sourceLength = light.sourceLength;
+}
+
+static int SetBasicStructure(const std::string& subject_name, const Properties& properties, int provider)
+{
+    if (UnrealLiveLink_ProviderSetBasicStructurePacked != NULL)
+    {
+        UnrealLiveLink_PackedStrings uellprop;
+        PackedStringCache cache;
+        PackProperties(properties, uellprop, cache);
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_ProviderSetBasicStructurePacked(provider, subject_name.c_str(), &uellprop);
+    }
+    return UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+static int UpdateBasicFrame(const std::string & subject_name, const double world_time,
+    const Metadata& metadata, const PropertyValues& property_values, int provider)
+{
+    if (UnrealLiveLink_ProviderUpdateBasicFramePacked != NULL)
+    {
+        UnrealLiveLink_PackedMetadata uellmeta;
+        PackedStringCache key_cache, value_cache;
+        PackMetadata(metadata, uellmeta, key_cache, value_cache);
+
+        UnrealLiveLink_PropertyValues uellpropval;
+        CopyPropertyValues(property_values, uellpropval);
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_ProviderUpdateBasicFramePacked(provider, subject_name.c_str(), world_time, &uellmeta, &uellpropval);
+    }
+    return UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+static int SetTransformStructure(const std::string& subject_name, const Properties& properties, int provider)
+{
+    if (UnrealLiveLink_ProviderSetTransformStructure != NULL)
+    {
+        UnrealLiveLink_Properties uellprop;
+        NameCache cache;
+        CopyProperties(properties, uellprop, cache);
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_ProviderSetTransformStructure(provider, subject_name.c_str(), &uellprop);
+    }
+    return UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+static int UpdateTransformFrame(const std::string & subject_name, const double world_time,
+    const Metadata& metadata, const PropertyValues& property_values, const Transform &frame, int provider)
+{
+    if (UnrealLiveLink_ProviderUpdateTransformFrame != NULL)
+    {
+        UnrealLiveLink_Metadata uellmeta;
+        KeyValueCache kvcache;
+        CopyMetadata(metadata, uellmeta, kvcache);
+
+        UnrealLiveLink_PropertyValues uellpropval;
+        CopyPropertyValues(property_values, uellpropval);
+
+        UnrealLiveLink_Transform uelltransform;
+        CopyTransform(frame, uelltransform);
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_ProviderUpdateTransformFrame(provider, subject_name.c_str(), world_time, &uellmeta, &uellpropval, &uelltransform);
+    }
+    return UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+static int SetCameraStructure(const std::string& subject_name, const Properties& properties, UnrealLiveLink_CameraStatic &camera, int provider)
+{
+    if (UnrealLiveLink_ProviderSetCameraStructure != NULL)
+    {
+        UnrealLiveLink_Properties uellprop;
+        NameCache cache;
+        CopyProperties(properties, uellprop, cache);
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_ProviderSetCameraStructure(provider, subject_name.c_str(), &uellprop, &camera);
+    }
+    return UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+static int UpdateCameraFrame(const std::string & subject_name, const double world_time,
+    const Metadata& metadata, const PropertyValues& property_values, Camera &camera, int provider)
+{
+    if (UnrealLiveLink_ProviderUpdateCameraFrame != NULL)
+    {
+        UnrealLiveLink_Metadata uellmeta;
+        KeyValueCache kvcache;
+        CopyMetadata(metadata, uellmeta, kvcache);
+
+        UnrealLiveLink_PropertyValues uellpropval;
+        CopyPropertyValues(property_values, uellpropval);
+
+        UnrealLiveLink_Camera uellcamera;
+        CopyCamera(camera, uellcamera);
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_ProviderUpdateCameraFrame(provider, subject_name.c_str(), world_time, &uellmeta, &uellpropval, &uellcamera);
+    }
+    return UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+static int SetLightStructure(const std::string& subject_name, const Properties& properties, UnrealLiveLink_LightStatic &light, int provider)
+{
+    if (UnrealLiveLink_ProviderSetLightStructure != NULL)
+    {
+        UnrealLiveLink_Properties uellprop;
+        NameCache cache;
+        CopyProperties(properties, uellprop, cache);
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_ProviderSetLightStructure(provider, subject_name.c_str(), &uellprop, &light);
+    }
+    return UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+static int UpdateLightFrame(const std::string & subject_name, const double world_time,
+    const Metadata& metadata, const PropertyValues& property_values, Light &light, int provider)
+{
+    if (UnrealLiveLink_ProviderUpdateLightFrame != NULL)
+    {
+        UnrealLiveLink_Metadata uellmeta;
+        KeyValueCache kvcache;
+        CopyMetadata(metadata, uellmeta, kvcache);
+
+        UnrealLiveLink_PropertyValues uellpropval;
+        CopyPropertyValues(property_values, uellpropval);
+
+        UnrealLiveLink_Light uelllight;
+        CopyLight(light, uelllight);
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_ProviderUpdateLightFrame(provider, subject_name.c_str(), world_time, &uellmeta, &uellpropval, &uelllight);
+    }
+    return UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+static int SetAnimationStructure(const std::string& subject_name, const Properties& properties, AnimationStatic &animation, int provider)
+{
+    if (UnrealLiveLink_ProviderSetAnimationStructurePacked != NULL)
+    {
+        UnrealLiveLink_PackedStrings uellprop;
+        PackedStringCache cache;
+        PackProperties(properties, uellprop, cache);
+
+        UnrealLiveLink_PackedAnimationStatic uellanim;
+        PackedStringCache bone_cache;
+        std::vector<int> parents;
+        PackAnimationStatic(animation, uellanim, bone_cache, parents);
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_ProviderSetAnimationStructurePacked(provider, subject_name.c_str(), &uellprop, &uellanim);
+    }
+    return UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+static int RegisterSkeletonTemplate(const Properties& properties, AnimationStatic &animation)
+{
+    if (UnrealLiveLink_RegisterSkeletonTemplate != NULL)
+    {
+        UnrealLiveLink_Properties uellprop;
+        NameCache cache;
+        CopyProperties(properties, uellprop, cache);
+
+        UnrealLiveLink_AnimationStatic uellanim;
+        BoneCache bone_cache;
+        CopyAnimationStatic(animation, uellanim, bone_cache);
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_RegisterSkeletonTemplate(&uellprop, &uellanim);
+    }
+    return UNREAL_LIVE_LINK_NO_HANDLE;
+}
+
+static int UpdateAnimationFrame(const std::string & subject_name, const double world_time,
+    const Metadata& metadata, const PropertyValues& property_values, Animation &animation, int provider)
+{
+    if (UnrealLiveLink_ProviderUpdateAnimationFramePacked != NULL)
+    {
+        UnrealLiveLink_PackedMetadata uellmeta;
+        PackedStringCache key_cache, value_cache;
+        PackMetadata(metadata, uellmeta, key_cache, value_cache);
+
+        UnrealLiveLink_PropertyValues uellpropval;
+        CopyPropertyValues(property_values, uellpropval);
+
+        UnrealLiveLink_Animation uellanim;
+        uellanim.transforms = reinterpret_cast<UnrealLiveLink_Transform *>(animation.data());
+        uellanim.transformCount = animation.size();
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_ProviderUpdateAnimationFramePacked(provider, subject_name.c_str(), world_time, &uellmeta, &uellpropval, &uellanim);
+    }
+    return UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+static int CreateSkeletonMap(const Properties& source_names, AnimationStatic &animation)
+{
+    if (UnrealLiveLink_CreateSkeletonMap != NULL)
+    {
+        UnrealLiveLink_Properties uellnames;
+        NameCache cache;
+        CopyProperties(source_names, uellnames, cache);
+
+        UnrealLiveLink_AnimationStatic uellanim;
+        BoneCache bone_cache;
+        CopyAnimationStatic(animation, uellanim, bone_cache);
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_CreateSkeletonMap(&uellnames, &uellanim);
+    }
+    return UNREAL_LIVE_LINK_NO_HANDLE;
+}
+
+static int UpdateAnimationFrameMapped(const std::string & subject_name, const double world_time,
+    const Metadata& metadata, const PropertyValues& property_values, int skeleton_map, Animation &animation, int provider)
+{
+    if (UnrealLiveLink_ProviderUpdateAnimationFrameMapped != NULL)
+    {
+        UnrealLiveLink_PackedMetadata uellmeta;
+        PackedStringCache key_cache, value_cache;
+        PackMetadata(metadata, uellmeta, key_cache, value_cache);
+
+        UnrealLiveLink_PropertyValues uellpropval;
+        CopyPropertyValues(property_values, uellpropval);
+
+        UnrealLiveLink_Animation uellanim;
+        uellanim.transforms = reinterpret_cast<UnrealLiveLink_Transform *>(animation.data());
+        uellanim.transformCount = animation.size();
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_ProviderUpdateAnimationFrameMapped(provider, subject_name.c_str(), world_time, &uellmeta, &uellpropval, skeleton_map, &uellanim);
+    }
+    return UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+static int UpdateBasicFrameSparse(const std::string & subject_name, const double world_time,
+    const Metadata& metadata, const std::vector<int>& property_indices, const PropertyValues& property_values, int provider)
+{
+    if (UnrealLiveLink_ProviderUpdateBasicFrameSparse != NULL)
+    {
+        if (property_indices.size() != property_values.size())
+        {
+            return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+        }
+
+        UnrealLiveLink_PackedMetadata uellmeta;
+        PackedStringCache key_cache, value_cache;
+        PackMetadata(metadata, uellmeta, key_cache, value_cache);
+
+        UnrealLiveLink_SparsePropertyValues uellpropval{ property_indices.data(), property_values.data(), static_cast<int>(property_values.size()) };
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_ProviderUpdateBasicFrameSparse(provider, subject_name.c_str(), world_time, &uellmeta, &uellpropval);
+    }
+    return UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+static int UpdateAnimationFrameSparse(const std::string & subject_name, const double world_time,
+    const Metadata& metadata, const std::vector<int>& property_indices, const PropertyValues& property_values,
+    const std::vector<int>& bone_indices, const Animation &animation, int provider)
+{
+    if (UnrealLiveLink_ProviderUpdateAnimationFrameSparse != NULL)
+    {
+        if (property_indices.size() != property_values.size() || bone_indices.size() != animation.size())
+        {
+            return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+        }
+
+        UnrealLiveLink_PackedMetadata uellmeta;
+        PackedStringCache key_cache, value_cache;
+        PackMetadata(metadata, uellmeta, key_cache, value_cache);
+
+        UnrealLiveLink_SparsePropertyValues uellpropval{ property_indices.data(), property_values.data(), static_cast<int>(property_values.size()) };
+        UnrealLiveLink_SparseTransforms uellanim{ bone_indices.data(), reinterpret_cast<const UnrealLiveLink_Transform *>(animation.data()), static_cast<int>(animation.size()) };
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_ProviderUpdateAnimationFrameSparse(provider, subject_name.c_str(), world_time, &uellmeta, &uellpropval, &uellanim);
+    }
+    return UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+// compress frames of one skeleton, None if they are empty, of different bone counts or out of memory
+static py::object EncodeClip(const std::vector<Animation>& frames, const double frame_rate, const UnrealLiveLink_ClipSettings *settings)
+{
+    if (frames.empty())
+    {
+        return py::none();
+    }
+
+    const size_t bone_count = frames[0].size();
+    std::vector<UnrealLiveLink_Transform> transforms;
+    transforms.reserve(bone_count * frames.size());
+    for (const Animation& frame : frames)
+    {
+        if (frame.size() != bone_count)
+        {
+            return py::none();
+        }
+        const UnrealLiveLink_Transform *frame_transforms = reinterpret_cast<const UnrealLiveLink_Transform *>(frame.data());
+        transforms.insert(transforms.end(), frame_transforms, frame_transforms + bone_count);
+    }
+
+    unsigned char *data = nullptr;
+    size_t size = 0;
+    int result;
+    {
+        py::gil_scoped_release release;
+        result = UnrealLiveLink_EncodeClip(transforms.data(), static_cast<int>(bone_count), static_cast<int>(frames.size()), frame_rate, settings, &data, &size);
+    }
+    if (result != UNREAL_LIVE_LINK_OK)
+    {
+        return py::none();
+    }
+
+    py::bytes clip(reinterpret_cast<const char *>(data), size);
+    UnrealLiveLink_FreeClip(data);
+    return clip;
+}
+
+// an open compressed clip, the decoder reads from its own copy of the data
+class Clip
+{
+public:
+    explicit Clip(const py::bytes& clip_data)
+        : data(clip_data)
+    {
+        if (UnrealLiveLink_OpenClip(reinterpret_cast<const unsigned char *>(data.data()), data.size(), &decoder) != UNREAL_LIVE_LINK_OK)
+        {
+            throw std::invalid_argument("not an Unreal Live Link clip");
+        }
+        UnrealLiveLink_GetClipInfo(decoder, &info);
+    }
+
+    ~Clip()
+    {
+        UnrealLiveLink_CloseClip(decoder);
+    }
+
+    Clip(const Clip&) = delete;
+    Clip& operator=(const Clip&) = delete;
+
+    // decode a frame into animation, resized to the clip's bone count
+    int DecodeFrame(int frame, Animation& animation)
+    {
+        animation.resize(info.boneCount);
+
+        UnrealLiveLink_Animation uellanim;
+        uellanim.transforms = reinterpret_cast<UnrealLiveLink_Transform *>(animation.data());
+        uellanim.transformCount = static_cast<int>(animation.size());
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_DecodeClipFrame(decoder, frame, &uellanim);
+    }
+
+    const UnrealLiveLink_ClipInfo& Info() const { return info; }
+
+private:
+    std::string data;
+    UnrealLiveLink_ClipDecoder *decoder{ nullptr };
+    UnrealLiveLink_ClipInfo info{};
+};
+
+static int UpdateTransformFrameMatrix(const std::string & subject_name, const double world_time,
+    const Metadata& metadata, const PropertyValues& property_values, const Matrix &frame, int provider)
+{
+    if (UnrealLiveLink_ProviderUpdateTransformFrameMatrix != NULL)
+    {
+        UnrealLiveLink_Metadata uellmeta;
+        KeyValueCache kvcache;
+        CopyMetadata(metadata, uellmeta, kvcache);
+
+        UnrealLiveLink_PropertyValues uellpropval;
+        CopyPropertyValues(property_values, uellpropval);
+
+        UnrealLiveLink_Matrix uellmatrix;
+        CopyMatrix(frame, uellmatrix);
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_ProviderUpdateTransformFrameMatrix(provider, subject_name.c_str(), world_time, &uellmeta, &uellpropval, &uellmatrix);
+    }
+    return UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+static int UpdateAnimationFrameMatrices(const std::string & subject_name, const double world_time,
+    const Metadata& metadata, const PropertyValues& property_values, const AnimationMatrices &matrices, int provider)
+{
+    if (UnrealLiveLink_ProviderUpdateAnimationFrameMatrices != NULL)
+    {
+        UnrealLiveLink_Metadata uellmeta;
+        KeyValueCache kvcache;
+        CopyMetadata(metadata, uellmeta, kvcache);
+
+        UnrealLiveLink_PropertyValues uellpropval;
+        CopyPropertyValues(property_values, uellpropval);
+
+        UnrealLiveLink_AnimationMatrices uellanim;
+        uellanim.matrices = reinterpret_cast<UnrealLiveLink_Matrix *>(const_cast<Matrix *>(matrices.data()));
+        uellanim.matrixCount = matrices.size();
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_ProviderUpdateAnimationFrameMatrices(provider, subject_name.c_str(), world_time, &uellmeta, &uellpropval, &uellanim);
+    }
+    return UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+static int UpdateCameraFrameMatrix(const std::string & subject_name, const double world_time,
+    const Metadata& metadata, const PropertyValues& property_values, Camera &camera, const Matrix &transform, int provider)
+{
+    if (UnrealLiveLink_ProviderUpdateCameraFrameMatrix != NULL)
+    {
+        UnrealLiveLink_Metadata uellmeta;
+        KeyValueCache kvcache;
+        CopyMetadata(metadata, uellmeta, kvcache);
+
+        UnrealLiveLink_PropertyValues uellpropval;
+        CopyPropertyValues(property_values, uellpropval);
+
+        UnrealLiveLink_Camera uellcamera;
+        CopyCamera(camera, uellcamera);
+
+        UnrealLiveLink_Matrix uellmatrix;
+        CopyMatrix(transform, uellmatrix);
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_ProviderUpdateCameraFrameMatrix(provider, subject_name.c_str(), world_time, &uellmeta, &uellpropval, &uellcamera, &uellmatrix);
+    }
+    return UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+static int UpdateLightFrameMatrix(const std::string & subject_name, const double world_time,
+    const Metadata& metadata, const PropertyValues& property_values, Light &light, const Matrix &transform, int provider)
+{
+    if (UnrealLiveLink_ProviderUpdateLightFrameMatrix != NULL)
+    {
+        UnrealLiveLink_Metadata uellmeta;
+        KeyValueCache kvcache;
+        CopyMetadata(metadata, uellmeta, kvcache);
+
+        UnrealLiveLink_PropertyValues uellpropval;
+        CopyPropertyValues(property_values, uellpropval);
+
+        UnrealLiveLink_Light uelllight;
+        CopyLight(light, uelllight);
+
+        UnrealLiveLink_Matrix uellmatrix;
+        CopyMatrix(transform, uellmatrix);
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_ProviderUpdateLightFrameMatrix(provider, subject_name.c_str(), world_time, &uellmeta, &uellpropval, &uelllight, &uellmatrix);
+    }
+    return UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+static int UpdateAnimationFrames(const py::list& frames, int provider)
+{
+    if (UnrealLiveLink_ProviderUpdateAnimationFrames != NULL)
+    {
+        // frames is a list of (subject_name, world_time, metadata, property_values, animation)
+        size_t count = frames.size();
+        std::vector<std::string> subject_names(count);
+        std::vector<KeyValueCache> kvcaches(count);
+        std::vector<UnrealLiveLink_Metadata> uellmetas(count);
+        std::vector<UnrealLiveLink_PropertyValues> uellpropvals(count);
+        std::vector<UnrealLiveLink_Animation> uellanims(count);
+        std::vector<UnrealLiveLink_AnimationSubjectFrame> uellframes(count);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            py::tuple frame = frames[i].cast<py::tuple>();
+            subject_names[i] = frame[0].cast<std::string>();
+            CopyMetadata(frame[2].cast<const Metadata&>(), uellmetas[i], kvcaches[i]);
+            CopyPropertyValues(frame[3].cast<const PropertyValues&>(), uellpropvals[i]);
+
+            Animation &animation = frame[4].cast<Animation&>();
+            uellanims[i].transforms = reinterpret_cast<UnrealLiveLink_Transform *>(animation.data());
+            uellanims[i].transformCount = animation.size();
+
+            uellframes[i].subjectName = subject_names[i].c_str();
+            uellframes[i].worldTime = frame[1].cast<double>();
+            uellframes[i].metadata = &uellmetas[i];
+            uellframes[i].propValues = &uellpropvals[i];
+            uellframes[i].frame = &uellanims[i];
+        }
+
+        py::gil_scoped_release release;
+        return UnrealLiveLink_ProviderUpdateAnimationFrames(provider, uellframes.data(), static_cast<int>(count));
+    }
+    return UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+// asyncio support: blocking work runs on native threads, results are handed back to the submitting event loop
+
+static void ResolveFuture(py::object future, py::object result)
+{
+    if (!future.attr("done")().cast<bool>()) {
+        future.attr("set_result")(result);
+    }
+}
+
+static void RejectFuture(py::object future, py::object error)
+{
+    if (!future.attr("done")().cast<bool>()) {
+        future.attr("set_exception")(error);
+    }
+}
+
+// hand a call to an event loop from any thread holding the GIL, dropped if the loop is already closed
+static void CallSoonThreadsafe(const py::object& loop, void (*function)(py::object, py::object), const py::object& future, const py::object& value)
+{
+    try {
+        loop.attr("call_soon_threadsafe")(py::cpp_function(function), future, value);
+    }
+    catch (py::error_already_set&) {
+    }
+}
+
+// runs jobs in order on a native thread, each result resolves an asyncio future on the loop that submitted it
+class AsyncQueue
+{
+public:
+    // jobs run with the GIL held, blocking work inside a job releases it
+    typedef std::function<py::object()> Job;
+
+    // queue a job from a coroutine, returns the future its result resolves (GIL held)
+    py::object Submit(Job job)
+    {
+        py::object loop = py::module_::import("asyncio").attr("get_running_loop")();
+        py::object future = loop.attr("create_future")();
+        Push(Entry{ std::move(job), loop, future });
+        return future;
+    }
+
+    // queue a job without a result, safe to call without the GIL from any thread
+    void Post(Job job)
+    {
+        Push(Entry{ std::move(job), py::object(), py::object() });
+    }
+
+    // run the queued jobs and stop the thread, a later job starts it again unless closed (GIL held)
+    void Stop(bool close = false)
+    {
+        // the thread is taken under the lock as Push may replace it from another thread
+        std::thread stopped;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+            closed = closed || close;
+            stopped = std::move(thread);
+        }
+        condition.notify_one();
+
+        if (stopped.joinable()) {
+            py::gil_scoped_release release;
+            stopped.join();
+        }
+    }
+
+private:
+    struct Entry
+    {
+        Job job;
+        py::object loop;
+        py::object future;
+    };
+
+    void Push(Entry&& entry)
+    {
+        // a thread that has left Run, joined outside of the lock
+        std::thread finished;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (closed) {
+                return;
+            }
+            if (!running) {
+                finished = std::move(thread);
+                stopping = false;
+                running = true;
+                thread = std::thread([this]() { Run(); });
+            }
+            entries.push_back(std::move(entry));
+        }
+        condition.notify_one();
+
+        if (finished.joinable()) {
+            finished.join();
+        }
+    }
+
+    void Run()
+    {
+        for (;;) {
+            Entry entry;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [this]() { return stopping || !entries.empty(); });
+                if (entries.empty()) {
+                    // cleared with the queue seen empty so a later Push starts a new thread instead of queueing behind this one
+                    running = false;
+                    return;
+                }
+                entry = std::move(entries.front());
+                entries.pop_front();
+            }
+
+            // python objects are only touched, and released, with the GIL held
+            py::gil_scoped_acquire acquire;
+            try {
+                py::object result = entry.job();
+                if (entry.future) {
+                    CallSoonThreadsafe(entry.loop, &ResolveFuture, entry.future, result);
+                }
+            }
+            catch (py::error_already_set& error) {
+                if (entry.future) {
+                    CallSoonThreadsafe(entry.loop, &RejectFuture, entry.future, error.value());
+                }
+            }
+            entry = Entry();
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<Entry> entries;
+    bool stopping{ false };
+    bool closed{ false };
+    // Run is looping, it only returns with the queue empty
+    bool running{ false };
+    std::thread thread;
+};
+
+// frame submission and connection events share one queue so they reach Unreal in submission order
+static AsyncQueue& GetAsyncQueue()
+{
+    // never destroyed, stopped by the module's exit hook while the interpreter is still alive
+    static AsyncQueue* queue = new AsyncQueue();
+    return *queue;
+}
+
+// fixed rate frame schedule on the native monotonic clock, frame n is due at start + n / rate
+class FrameClock
+{
+public:
+    explicit FrameClock(double rate)
+        : frame_time(1.0 / rate), start(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~FrameClock()
+    {
+        queue.Stop();
+    }
+
+    // future resolved with the frame number when the next frame is due
+    py::object Tick()
+    {
+        int64_t frame;
+        const std::chrono::steady_clock::time_point due = NextDue(frame);
+        return queue.Submit([due, frame]() -> py::object {
+            {
+                py::gil_scoped_release release;
+                std::this_thread::sleep_until(due);
+            }
+            return py::int_(frame);
+        });
+    }
+
+    // block until the next frame is due, returns its frame number
+    int64_t Wait()
+    {
+        int64_t frame;
+        const std::chrono::steady_clock::time_point due = NextDue(frame);
+        {
+            py::gil_scoped_release release;
+            std::this_thread::sleep_until(due);
+        }
+        return frame;
+    }
+
+    // seconds since the clock was created
+    double Time() const
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    double FrameTime() const
+    {
+        return frame_time;
+    }
+
+private:
+    // the frame after the last one handed out, frames already past are skipped (the frame number shows the gap)
+    std::chrono::steady_clock::time_point NextDue(int64_t& frame)
+    {
+        const int64_t current = static_cast<int64_t>(Time() / frame_time);
+        frame = std::max(next_frame, current);
+        next_frame = frame + 1;
+        return start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(frame * frame_time));
+    }
+
+    const double frame_time;
+    const std::chrono::steady_clock::time_point start;
+    int64_t next_frame{ 0 };
+    AsyncQueue queue;
+};
+
+// futures waiting for a provider's connection state to change
+struct ConnectionWaiter
+{
+    py::object loop;
+    py::object future;
+    bool connected;
+};
+
+// Python side of a provider's connection updates, only touched with the GIL held
+struct ConnectionListeners
+{
+    std::vector<ConnectionWaiter> waiters;
+
+    // called with the new state when it differs from the last state they were given
+    std::vector<py::object> callbacks;
+    bool connected{ false };
+};
+
+static std::map<int, ConnectionListeners> ProviderConnectionListeners;
+static std::set<int> ConnectionCallbackProviders;
+
+// connection updates seen, lets blocking waits sleep without the GIL
+static std::mutex ConnectionUpdateMutex;
+static std::condition_variable ConnectionUpdateCondition;
+static uint64_t ConnectionUpdateCount = 0;
+
+static bool ProviderConnected(int provider)
+{
+    py::gil_scoped_release release;
+    return UnrealLiveLink_ProviderHasConnection != NULL && UnrealLiveLink_ProviderHasConnection(provider) == UNREAL_LIVE_LINK_OK;
+}
+
+// the callback does not say which provider changed, so every provider with listeners is checked
+// Python code can run, and switch threads, between the calls so nothing is iterated across them
+static void DispatchConnectionUpdate()
+{
+    std::vector<int> providers;
+    for (const auto& provider_listeners : ProviderConnectionListeners) {
+        providers.push_back(provider_listeners.first);
+    }
+
+    for (int provider : providers) {
+        const bool connected = ProviderConnected(provider);
+
+        auto found = ProviderConnectionListeners.find(provider);
+        if (found == ProviderConnectionListeners.end()) {
+            continue;
+        }
+        ConnectionListeners& listeners = found->second;
+
+        std::vector<ConnectionWaiter> ready;
+        for (size_t i = 0; i < listeners.waiters.size();) {
+            if (listeners.waiters[i].connected != connected) {
+                ready.push_back(std::move(listeners.waiters[i]));
+                listeners.waiters.erase(listeners.waiters.begin() + i);
+            }
+            else {
+                i++;
+            }
+        }
+
+        std::vector<py::object> callbacks;
+        if (listeners.connected != connected) {
+            listeners.connected = connected;
+            callbacks = listeners.callbacks;
+        }
+
+        for (ConnectionWaiter& waiter : ready) {
+            CallSoonThreadsafe(waiter.loop, &ResolveFuture, waiter.future, py::bool_(connected));
+        }
+        for (py::object& callback : callbacks) {
+            try {
+                callback(connected);
+            }
+            catch (py::error_already_set& error) {
+                error.discard_as_unraisable("pyUnrealLiveLink connection callback");
+            }
+        }
+    }
+}
+
+// cancel waiting futures and drop callbacks, the library's callback registrations go with the shared object
+static void ResetConnectionListeners()
+{
+    for (auto& provider_listeners : ProviderConnectionListeners) {
+        for (ConnectionWaiter& waiter : provider_listeners.second.waiters) {
+            try {
+                waiter.loop.attr("call_soon_threadsafe")(waiter.future.attr("cancel"));
+            }
+            catch (py::error_already_set&) {
+            }
+        }
+    }
+    ProviderConnectionListeners.clear();
+    ConnectionCallbackProviders.clear();
+}
+
+// called from the message bus thread without the GIL, never blocks on Python
+// so it can't deadlock with a producer that is inside an update call
+static void OnConnectionUpdate()
+{
+    {
+        std::lock_guard<std::mutex> lock(ConnectionUpdateMutex);
+        ConnectionUpdateCount++;
+    }
+    ConnectionUpdateCondition.notify_all();
+
+    GetAsyncQueue().Post([]() -> py::object {
+        DispatchConnectionUpdate();
+        return py::none();
+    });
+}
+
+// register the library callback for a provider once, returns its listeners
+static ConnectionListeners& ListenConnection(int provider)
+{
+    if (UnrealLiveLink_RegisterProviderConnectionUpdateCallback == NULL || UnrealLiveLink_ProviderHasConnection == NULL) {
+        throw std::runtime_error("Unreal Live Link is not loaded");
+    }
+
+    if (ConnectionCallbackProviders.insert(provider).second) {
+        if (UnrealLiveLink_RegisterProviderConnectionUpdateCallback(provider, &OnConnectionUpdate) != UNREAL_LIVE_LINK_OK) {
+            ConnectionCallbackProviders.erase(provider);
+            throw std::invalid_argument("invalid provider");
+        }
+        ProviderConnectionListeners[provider].connected = ProviderConnected(provider);
+    }
+
+    return ProviderConnectionListeners[provider];
+}
+
+// future resolved with the new connection state of the provider when it changes
+static py::object ConnectionChanged(int provider)
+{
+    ConnectionListeners& listeners = ListenConnection(provider);
+
+    py::object loop = py::module_::import("asyncio").attr("get_running_loop")();
+    py::object future = loop.attr("create_future")();
+    listeners.waiters.push_back(ConnectionWaiter{ loop, future, ProviderConnected(provider) });
+    return future;
+}
+
+// callback(connected) is called on the module's worker thread with the GIL held,
+// pass a queue's put to receive the updates on a thread of your own
+static void RegisterConnectionCallback(py::object callback, int provider)
+{
+    ListenConnection(provider).callbacks.push_back(callback);
+}
+
+static bool UnregisterConnectionCallback(py::object callback, int provider)
+{
+    auto found = ProviderConnectionListeners.find(provider);
+    if (found != ProviderConnectionListeners.end()) {
+        std::vector<py::object>& callbacks = found->second.callbacks;
+        for (size_t i = 0; i < callbacks.size(); i++) {
+            if (callbacks[i].equal(callback)) {
+                callbacks.erase(callbacks.begin() + i);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// block until the provider is connected or the timeout in seconds passes, without the GIL and without polling
+static bool WaitForConnection(std::optional<double> timeout, int provider)
+{
+    ListenConnection(provider);
+
+    const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() +
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(timeout.value_or(0.0)));
+    for (;;) {
+        uint64_t seen;
+        {
+            std::lock_guard<std::mutex> lock(ConnectionUpdateMutex);
+            seen = ConnectionUpdateCount;
+        }
+
+        if (ProviderConnected(provider)) {
+            return true;
+        }
+
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (timeout && now >= deadline) {
+            return false;
+        }
+
+        {
+            // wake up now and then so Ctrl+C is not held off
+            std::chrono::steady_clock::time_point wake = now + std::chrono::milliseconds(100);
+            if (timeout) {
+                wake = std::min(wake, deadline);
+            }
+
+            py::gil_scoped_release release;
+            std::unique_lock<std::mutex> lock(ConnectionUpdateMutex);
+            ConnectionUpdateCondition.wait_until(lock, wake, [seen]() { return ConnectionUpdateCount != seen; });
+        }
+
+        if (PyErr_CheckSignals() != 0) {
+            throw py::error_already_set();
+        }
+    }
+}
+
+// stop the native threads before the shared object goes away, at exit the queue is closed for good
+static void StopAsync(bool close)
+{
+    GetAsyncQueue().Stop(close);
+    ResetConnectionListeners();
+}
+
+PYBIND11_MODULE(pyUnrealLiveLink, m) {
+
+    pybind11::enum_<UnrealLiveLink_TimecodeFormat>(m, "TimecodeFormat")
+        .value("UNKNOWN", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_UNKNOWN)
+        .value("FC_23_98", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_23_98)
+        .value("FC_24", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_24)
+        .value("FC_25", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_25)
+        .value("FC_29_97_NDF", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_29_97_NDF)
+        .value("FC_29_97_DF", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_29_97_DF)
+        .value("FC_30", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_30)
+        .value("FC_47_95", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_47_95)
+        .value("FC_48", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_48)
+        .value("FC_50", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_50)
+        .value("FC_59_94_NDF", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_59_94_NDF)
+        .value("FC_59_94_DF", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_59_94_DF)
+        .value("FC_60", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_60)
+        .value("FC_72", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_72)
+        .value("FC_96", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_96)
+        .value("FC_100", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_100)
+        .value("FC_120", UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_120);
+
+    pybind11::enum_<UnrealLiveLink_TransformSpace>(m, "TransformSpace")
+        .value("LOCAL", UnrealLiveLink_TransformSpace::UNREAL_LIVE_LINK_LOCAL_SPACE)
+        .value("WORLD", UnrealLiveLink_TransformSpace::UNREAL_LIVE_LINK_WORLD_SPACE);
+
+    pybind11::enum_<UnrealLiveLink_RotationOrder>(m, "RotationOrder")
+        .value("QUATERNION", UnrealLiveLink_RotationOrder::UNREAL_LIVE_LINK_ROTATION_QUATERNION)
+        .value("EULER_XYZ", UnrealLiveLink_RotationOrder::UNREAL_LIVE_LINK_ROTATION_EULER_XYZ)
+        .value("EULER_XZY", UnrealLiveLink_RotationOrder::UNREAL_LIVE_LINK_ROTATION_EULER_XZY)
+        .value("EULER_YXZ", UnrealLiveLink_RotationOrder::UNREAL_LIVE_LINK_ROTATION_EULER_YXZ)
+        .value("EULER_YZX", UnrealLiveLink_RotationOrder::UNREAL_LIVE_LINK_ROTATION_EULER_YZX)
+        .value("EULER_ZXY", UnrealLiveLink_RotationOrder::UNREAL_LIVE_LINK_ROTATION_EULER_ZXY)
+        .value("EULER_ZYX", UnrealLiveLink_RotationOrder::UNREAL_LIVE_LINK_ROTATION_EULER_ZYX);
+
+    pybind11::class_<UnrealLiveLink_Timecode>(m, "Timecode")
+        .def(pybind11::init<>([]() {
+            auto tc = UnrealLiveLink_Timecode();
+            tc.hours = tc.minutes = tc.seconds = tc.frames = 0;
+            tc.format = UnrealLiveLink_TimecodeFormat::UNREAL_LIVE_LINK_TIMECODE_UNKNOWN;
+            return tc;
+        }))
+        .def_readwrite("hours", &UnrealLiveLink_Timecode::hours)
+        .def_readwrite("minutes", &UnrealLiveLink_Timecode::minutes)
+        .def_readwrite("seconds", &UnrealLiveLink_Timecode::seconds)
+        .def_readwrite("frames", &UnrealLiveLink_Timecode::frames)
+        .def_readwrite("format", &UnrealLiveLink_Timecode::format);
+
+    pybind11::class_<UnrealLiveLink_CameraStatic>(m, "CameraStatic")
+        .def(pybind11::init<>([]() { 
+            auto cs = UnrealLiveLink_CameraStatic(); 
+            UnrealLiveLink_InitCameraStatic(&cs); 
+            return cs;
+        }))
+        .def_readwrite("is_field_of_view_supported", &UnrealLiveLink_CameraStatic::isFieldOfViewSupported)
+        .def_readwrite("is_aspect_ratio_supported", &UnrealLiveLink_CameraStatic::isAspectRatioSupported)
+        .def_readwrite("is_focal_length_supported", &UnrealLiveLink_CameraStatic::isFocalLengthSupported)
+        .def_readwrite("is_projection_mode_supported", &UnrealLiveLink_CameraStatic::isProjectionModeSupported)
+        .def_readwrite("film_back_width", &UnrealLiveLink_CameraStatic::filmBackWidth)
+        .def_readwrite("film_back_height", &UnrealLiveLink_CameraStatic::filmBackHeight)
+        .def_readwrite("is_aperture_supported", &UnrealLiveLink_CameraStatic::isApertureSupported)
+        .def_readwrite("is_focus_distance_supported", &UnrealLiveLink_CameraStatic::isFocusDistanceSupported);
+
+    pybind11::class_<Camera>(m, "Camera")
+        .def(pybind11::init<>())
+        .def_readwrite("transform", &Camera::transform)
+        .def_readwrite("field_of_view", &Camera::fieldOfView)
+        .def_readwrite("aspect_ratio", &Camera::aspectRatio)
+        .def_readwrite("focal_length", &Camera::focalLength)
+        .def_readwrite("aperture", &Camera::aperture)
+        .def_readwrite("focus_distance", &Camera::focusDistance)
+        .def_readwrite("is_perspective", &Camera::isPerspective);
+
+    pybind11::class_<UnrealLiveLink_LightStatic>(m, "LightStatic")
+        .def(pybind11::init<>([]() {
+            auto ls = UnrealLiveLink_LightStatic();
+            UnrealLiveLink_InitLightStatic(&ls);
+            return ls;
+        }))
+        .def_readwrite("is_temperature_supported", &UnrealLiveLink_LightStatic::isTemperatureSupported)
+        .def_readwrite("is_intensity_supported", &UnrealLiveLink_LightStatic::isIntensitySupported)
+        .def_readwrite("is_light_color_supported", &UnrealLiveLink_LightStatic::isLightColorSupported)
+        .def_readwrite("is_inner_cone_angle_supported", &UnrealLiveLink_LightStatic::isInnerConeAngleSupported)
+        .def_readwrite("is_outer_cone_angle_supported", &UnrealLiveLink_LightStatic::isOuterConeAngleSupported)
+        .def_readwrite("is_attenuation_radius_supported", &UnrealLiveLink_LightStatic::isAttenuationRadiusSupported)
+        .def_readwrite("is_source_length_supported", &UnrealLiveLink_LightStatic::isSourceLengthSupported)
+        .def_readwrite("is_source_radius_supported", &UnrealLiveLink_LightStatic::isSourceRadiusSupported)
+        .def_readwrite("is_soft_source_radius_supported", &UnrealLiveLink_LightStatic::isSoftSourceRadiusSupported);
+
+    pybind11::class_<Light>(m, "Light")
+        .def(pybind11::init<>())
+        .def_readwrite("transform", &Light::transform)
+        .def_readwrite("temperature", &Light::temperature)
+        .def_readwrite("intensity", &Light::intensity)
+        .def_readwrite("light_color", &Light::lightColor)
+        .def_readwrite("inner_cone_angle", &Light::innerConeAngle)
+        .def_readwrite("outer_cone_angle", &Light::outerConeAngle)
+        .def_readwrite("attenuation_radius", &Light::attenuationRadius)
+        .def_readwrite("source_radius", &Light::sourceRadius)
+        .def_readwrite("soft_source_radius", &Light::softSourceRadius)
+        .def_readwrite("source_length", &Light::sourceLength);
+
+    pybind11::class_<UnrealLiveLink_StaticDataStats>(m, "StaticDataStats")
+        .def(pybind11::init<>([]() {
+            auto stats = UnrealLiveLink_StaticDataStats();
+            stats.appliedCount = stats.skippedCount = 0;
+            return stats;
+        }))
+        .def_readonly("applied_count", &UnrealLiveLink_StaticDataStats::appliedCount)
+        .def_readonly("skipped_count", &UnrealLiveLink_StaticDataStats::skippedCount);
+
+    pybind11::enum_<UnrealLiveLink_ValidationMode>(m, "ValidationMode")
+        .value("OFF", UnrealLiveLink_ValidationMode::UNREAL_LIVE_LINK_VALIDATION_OFF)
+        .value("REPAIR", UnrealLiveLink_ValidationMode::UNREAL_LIVE_LINK_VALIDATION_REPAIR)
+        .value("REJECT", UnrealLiveLink_ValidationMode::UNREAL_LIVE_LINK_VALIDATION_REJECT);
+
+    pybind11::class_<UnrealLiveLink_ValidationStats>(m, "ValidationStats")
+        .def(pybind11::init<>([]() {
+            auto stats = UnrealLiveLink_ValidationStats();
+            stats.checkedCount = stats.normalizedCount = stats.repairedCount = stats.rejectedCount = 0;
+            return stats;
+        }))
+        .def_readonly("checked_count", &UnrealLiveLink_ValidationStats::checkedCount)
+        .def_readonly("normalized_count", &UnrealLiveLink_ValidationStats::normalizedCount)
+        .def_readonly("repaired_count", &UnrealLiveLink_ValidationStats::repairedCount)
+        .def_readonly("rejected_count", &UnrealLiveLink_ValidationStats::rejectedCount);
+
+    pybind11::enum_<UnrealLiveLink_FilterChannel>(m, "FilterChannel")
+        .value("TRANSLATION", UnrealLiveLink_FilterChannel::UNREAL_LIVE_LINK_FILTER_TRANSLATION)
+        .value("ROTATION", UnrealLiveLink_FilterChannel::UNREAL_LIVE_LINK_FILTER_ROTATION)
+        .value("SCALE", UnrealLiveLink_FilterChannel::UNREAL_LIVE_LINK_FILTER_SCALE)
+        .value("PROPERTIES", UnrealLiveLink_FilterChannel::UNREAL_LIVE_LINK_FILTER_PROPERTIES);
+
+    pybind11::class_<UnrealLiveLink_FilterSettings>(m, "FilterSettings")
+        .def(pybind11::init<>([]() {
+            auto settings = UnrealLiveLink_FilterSettings();
+            settings.minCutoff = 1.0f;
+            settings.beta = 0.0f;
+            settings.derivativeCutoff = 1.0f;
+            return settings;
+        }))
+        .def_readwrite("min_cutoff", &UnrealLiveLink_FilterSettings::minCutoff)
+        .def_readwrite("beta", &UnrealLiveLink_FilterSettings::beta)
+        .def_readwrite("derivative_cutoff", &UnrealLiveLink_FilterSettings::derivativeCutoff);
+
+    pybind11::class_<UnrealLiveLink_ExtrapolationSettings>(m, "ExtrapolationSettings")
+        .def(pybind11::init<>([]() {
+            auto settings = UnrealLiveLink_ExtrapolationSettings();
+            settings.horizon = 0.0f;
+            settings.maxTranslation = settings.maxRotation = settings.maxPropertyChange = 0.0f;
+            return settings;
+        }))
+        .def_readwrite("horizon", &UnrealLiveLink_ExtrapolationSettings::horizon)
+        .def_readwrite("max_translation", &UnrealLiveLink_ExtrapolationSettings::maxTranslation)
+        .def_readwrite("max_rotation", &UnrealLiveLink_ExtrapolationSettings::maxRotation)
+        .def_readwrite("max_property_change", &UnrealLiveLink_ExtrapolationSettings::maxPropertyChange);
+
+    pybind11::class_<UnrealLiveLink_ClockSettings>(m, "ClockSettings")
+        .def(pybind11::init<>([]() {
+            auto settings = UnrealLiveLink_ClockSettings();
+            settings.timeScale = 1.0;
+            settings.window = 0.0;
+            settings.rewriteWorldTime = 0;
+            return settings;
+        }))
+        .def_readwrite("time_scale", &UnrealLiveLink_ClockSettings::timeScale)
+        .def_readwrite("window", &UnrealLiveLink_ClockSettings::window)
+        .def_property("rewrite_world_time",
+            [](const UnrealLiveLink_ClockSettings& settings) { return settings.rewriteWorldTime != 0; },
+            [](UnrealLiveLink_ClockSettings& settings, bool rewrite) { settings.rewriteWorldTime = rewrite ? 1 : 0; });
+
+    pybind11::class_<UnrealLiveLink_ClockStats>(m, "ClockStats")
+        .def(pybind11::init<>([]() {
+            auto stats = UnrealLiveLink_ClockStats();
+            stats.offset = stats.drift = stats.jitter = 0.0;
+            stats.sampleCount = 0;
+            return stats;
+        }))
+        .def_readonly("offset", &UnrealLiveLink_ClockStats::offset)
+        .def_readonly("drift", &UnrealLiveLink_ClockStats::drift)
+        .def_readonly("jitter", &UnrealLiveLink_ClockStats::jitter)
+        .def_readonly("sample_count", &UnrealLiveLink_ClockStats::sampleCount);
+
+    pybind11::class_<UnrealLiveLink_ExtrapolationStats>(m, "ExtrapolationStats")
+        .def(pybind11::init<>([]() {
+            auto stats = UnrealLiveLink_ExtrapolationStats();
+            stats.sampleCount = 0;
+            stats.meanTranslationError = stats.maxTranslationError = stats.meanRotationError = stats.maxRotationError = 0.0;
+            return stats;
+        }))
+        .def_readonly("sample_count", &UnrealLiveLink_ExtrapolationStats::sampleCount)
+        .def_readonly("mean_translation_error", &UnrealLiveLink_ExtrapolationStats::meanTranslationError)
+        .def_readonly("max_translation_error", &UnrealLiveLink_ExtrapolationStats::maxTranslationError)
+        .def_readonly("mean_rotation_error", &UnrealLiveLink_ExtrapolationStats::meanRotationError)
+        .def_readonly("max_rotation_error", &UnrealLiveLink_ExtrapolationStats::maxRotationError);
+
+    pybind11::class_<UnrealLiveLink_SkeletonSetupStats>(m, "SkeletonSetupStats")
+        .def(pybind11::init<>([]() {
+            auto stats = UnrealLiveLink_SkeletonSetupStats();
+            stats.boneCount = stats.propertyCount = 0;
+            stats.internSeconds = stats.totalSeconds = 0.0;
+            return stats;
+        }))
+        .def_readonly("bone_count", &UnrealLiveLink_SkeletonSetupStats::boneCount)
+        .def_readonly("property_count", &UnrealLiveLink_SkeletonSetupStats::propertyCount)
+        .def_readonly("intern_seconds", &UnrealLiveLink_SkeletonSetupStats::internSeconds)
+        .def_readonly("total_seconds", &UnrealLiveLink_SkeletonSetupStats::totalSeconds);
+
+    pybind11::class_<UnrealLiveLink_TickerStats>(m, "TickerStats")
+        .def(pybind11::init<>([]() {
+            auto stats = UnrealLiveLink_TickerStats();
+            stats.tickCount = 0;
+            stats.meanInterval = stats.maxInterval = 0.0;
+            return stats;
+        }))
+        .def_readonly("tick_count", &UnrealLiveLink_TickerStats::tickCount)
+        .def_readonly("mean_interval", &UnrealLiveLink_TickerStats::meanInterval)
+        .def_readonly("max_interval", &UnrealLiveLink_TickerStats::maxInterval);
+
+    pybind11::class_<UnrealLiveLink_ConnectionStats>(m, "ConnectionStats")
+        .def(pybind11::init<>([]() {
+            auto stats = UnrealLiveLink_ConnectionStats();
+            stats.connectSeconds = -1.0;
+            stats.changeCount = 0;
+            return stats;
+        }))
+        .def_readonly("connect_seconds", &UnrealLiveLink_ConnectionStats::connectSeconds)
+        .def_readonly("change_count", &UnrealLiveLink_ConnectionStats::changeCount);
+
+    pybind11::class_<UnrealLiveLink_TransportSettings>(m, "TransportSettings")
+        .def(pybind11::init<>([]() {
+            auto settings = UnrealLiveLink_TransportSettings();
+            settings.unicastEndpoint[0] = settings.multicastEndpoint[0] = '\0';
+            settings.multicastTimeToLive = settings.workQueueSize = 0;
+            settings.maxSendRate = 0.0f;
+            return settings;
+        }))
+        .def_property("unicast_endpoint",
+            [](const UnrealLiveLink_TransportSettings& settings) { return std::string(settings.unicastEndpoint); },
+            [](UnrealLiveLink_TransportSettings& settings, const std::string& endpoint) { UnrealLiveLink_CopyName(endpoint.c_str(), settings.unicastEndpoint); })
+        .def_property("multicast_endpoint",
+            [](const UnrealLiveLink_TransportSettings& settings) { return std::string(settings.multicastEndpoint); },
+            [](UnrealLiveLink_TransportSettings& settings, const std::string& endpoint) { UnrealLiveLink_CopyName(endpoint.c_str(), settings.multicastEndpoint); })
+        .def_readwrite("multicast_time_to_live", &UnrealLiveLink_TransportSettings::multicastTimeToLive)
+        .def_readwrite("work_queue_size", &UnrealLiveLink_TransportSettings::workQueueSize)
+        .def_readwrite("max_send_rate", &UnrealLiveLink_TransportSettings::maxSendRate);
+
+    pybind11::class_<UnrealLiveLink_ClipSettings>(m, "ClipSettings")
+        .def(pybind11::init<>([]() {
+            auto settings = UnrealLiveLink_ClipSettings();
+            settings.blockFrames = 0;
+            settings.rotationTolerance = settings.translationTolerance = settings.scaleTolerance = 0.0f;
+            settings.translationPrecision = settings.scalePrecision = 0.0f;
+            return settings;
+        }))
+        .def_readwrite("block_frames", &UnrealLiveLink_ClipSettings::blockFrames)
+        .def_readwrite("rotation_tolerance", &UnrealLiveLink_ClipSettings::rotationTolerance)
+        .def_readwrite("translation_tolerance", &UnrealLiveLink_ClipSettings::translationTolerance)
+        .def_readwrite("scale_tolerance", &UnrealLiveLink_ClipSettings::scaleTolerance)
+        .def_readwrite("translation_precision", &UnrealLiveLink_ClipSettings::translationPrecision)
+        .def_readwrite("scale_precision", &UnrealLiveLink_ClipSettings::scalePrecision);
+
+    pybind11::class_<Transform>(m, "Transform")
+        .def(pybind11::init<>())
+        .def_readwrite("rotation", &Transform::rotation)
+        .def_readwrite("translation", &Transform::translation)
+        .def_readwrite("scale", &Transform::scale);
+
+    pybind11::class_<KeyValue>(m, "KeyValue")
+        .def(pybind11::init<>())
+        .def_readwrite("key", &KeyValue::key)
+        .def_readwrite("value", &KeyValue::value);
+
+    pybind11::class_<Metadata>(m, "Metadata")
+        .def(pybind11::init<>())
+        .def_readwrite("key_values", &Metadata::keyValues)
+        .def_readwrite("timecode", &Metadata::timecode);
+
+    pybind11::class_<Bone>(m, "Bone")
+        .def(pybind11::init<>())
+        .def_readwrite("name", &Bone::name)
+        .def_readwrite("parent_index", &Bone::parentIndex);
+
+    py::bind_vector<std::vector<std::string>>(m, "Properties");
+    // buffer protocol so large property arrays can be filled in place, e.g. numpy.asarray(values)[:] = frame
+    py::bind_vector<std::vector<float>>(m, "PropertyValues", py::buffer_protocol())
+        .def("resize", [](std::vector<float>& values, size_t count) { values.resize(count); });
+
+    py::bind_vector<std::vector<Bone>>(m, "AnimationStatic");
+    py::bind_vector<std::vector<Transform>>(m, "Animation");
+
+    m.def("load", []() -> int { 
+#ifdef WIN32
+        const char* sharedObj = "UnrealLiveLinkCInterface.dll";
+#else
+        const char* sharedObj = "libUnrealLiveLinkCInterface.so";
+#endif
+        return UnrealLiveLink_Load(sharedObj);
+    });
+    m.def("is_loaded", []() -> bool { return UnrealLiveLink_IsLoaded() == UNREAL_LIVE_LINK_OK; });
+    m.def("unload", []() -> void {
+        StopAsync(false);
+        UnrealLiveLink_Unload();
+    });
+
+    m.def("set_provider_name", [](const std::string& provider_name) -> void { 
+        if (UnrealLiveLink_SetProviderName != NULL) {
+            UnrealLiveLink_SetProviderName(provider_name.c_str());
+        }
+    });
+
+    m.def("get_version", []() -> int { return UnrealLiveLink_GetVersion != NULL ? UnrealLiveLink_GetVersion() : 0 ; });
+    m.def("get_capabilities", []() -> unsigned int { return UnrealLiveLink_GetCapabilities(); });
+    m.attr("CAPABILITY_PROVIDERS") = UNREAL_LIVE_LINK_CAPABILITY_PROVIDERS;
+    m.attr("CAPABILITY_BATCH") = UNREAL_LIVE_LINK_CAPABILITY_BATCH;
+    m.attr("CAPABILITY_SKELETON_TEMPLATES") = UNREAL_LIVE_LINK_CAPABILITY_SKELETON_TEMPLATES;
+    m.attr("CAPABILITY_MATRICES") = UNREAL_LIVE_LINK_CAPABILITY_MATRICES;
+    m.attr("CAPABILITY_PACKED") = UNREAL_LIVE_LINK_CAPABILITY_PACKED;
+    m.attr("CAPABILITY_FRAME_PROCESSING") = UNREAL_LIVE_LINK_CAPABILITY_FRAME_PROCESSING;
+    m.attr("CAPABILITY_PARALLEL_SETUP") = UNREAL_LIVE_LINK_CAPABILITY_PARALLEL_SETUP;
+    m.attr("CAPABILITY_TRANSPORT_SETTINGS") = UNREAL_LIVE_LINK_CAPABILITY_TRANSPORT_SETTINGS;
+    m.attr("CAPABILITY_TICKER") = UNREAL_LIVE_LINK_CAPABILITY_TICKER;
+    m.attr("CAPABILITY_CLOCK") = UNREAL_LIVE_LINK_CAPABILITY_CLOCK;
+    m.attr("CAPABILITY_SKELETON_MAPS") = UNREAL_LIVE_LINK_CAPABILITY_SKELETON_MAPS;
+    m.attr("CAPABILITY_SPARSE") = UNREAL_LIVE_LINK_CAPABILITY_SPARSE;
+    m.def("has_connection", []() -> bool { return UnrealLiveLink_HasConnection != NULL ? UnrealLiveLink_HasConnection() == UNREAL_LIVE_LINK_OK : false; });
+
+    m.def("set_unicast_endpoint", [](const std::string& endpoint) -> void { 
+        if (UnrealLiveLink_SetUnicastEndpoint != NULL) {
+            UnrealLiveLink_SetUnicastEndpoint(endpoint.c_str());
+        }
+    });
+    m.def("add_static_endpoint", [](const std::string& endpoint) -> int { 
+        if (UnrealLiveLink_AddStaticEndpoint != NULL) {
+            return UnrealLiveLink_AddStaticEndpoint(endpoint.c_str());
+        }
+        return UNREAL_LIVE_LINK_NOT_LOADED;
+    });
+    m.def("remove_static_endpoint", [](const std::string& endpoint) -> int { 
+        if (UnrealLiveLink_RemoveStaticEndpoint != NULL) {
+            return UnrealLiveLink_RemoveStaticEndpoint(endpoint.c_str());
+        }
+        return UNREAL_LIVE_LINK_NOT_LOADED;
+    });
+
+    m.def("set_transport_settings", [](const UnrealLiveLink_TransportSettings& settings) -> int {
+        if (UnrealLiveLink_SetTransportSettings != NULL) {
+            py::gil_scoped_release release;
+            return UnrealLiveLink_SetTransportSettings(&settings);
+        }
+        return UNREAL_LIVE_LINK_NOT_LOADED;
+    });
+    m.def("get_transport_settings", []() -> py::object {
+        auto settings = UnrealLiveLink_TransportSettings();
+        if (UnrealLiveLink_GetTransportSettings == NULL || UnrealLiveLink_GetTransportSettings(&settings) != UNREAL_LIVE_LINK_OK) {
+            return py::none();
+        }
+        return py::cast(settings);
+    });
+
+    m.def("set_ticker_rate", [](double rate) -> int { return UnrealLiveLink_SetTickerRate != NULL ? UnrealLiveLink_SetTickerRate(rate) : UNREAL_LIVE_LINK_NOT_LOADED ; });
+    m.def("pump", []() -> int {
+        if (UnrealLiveLink_Pump != NULL) {
+            py::gil_scoped_release release;
+            return UnrealLiveLink_Pump();
+        }
+        return UNREAL_LIVE_LINK_NOT_LOADED;
+    });
+    m.def("get_ticker_stats", []() -> UnrealLiveLink_TickerStats {
+        auto stats = UnrealLiveLink_TickerStats();
+        stats.tickCount = 0;
+        stats.meanInterval = stats.maxInterval = 0.0;
+        if (UnrealLiveLink_GetTickerStats != NULL) {
+            UnrealLiveLink_GetTickerStats(&stats);
+        }
+        return stats;
+    });
+    m.def("get_connection_stats", [](int provider) -> UnrealLiveLink_ConnectionStats {
+        auto stats = UnrealLiveLink_ConnectionStats();
+        stats.connectSeconds = -1.0;
+        stats.changeCount = 0;
+        if (UnrealLiveLink_ProviderGetConnectionStats != NULL) {
+            UnrealLiveLink_ProviderGetConnectionStats(provider, &stats);
+        }
+        return stats;
+    }, py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+
+    m.def("start_live_link", []() -> int { return UnrealLiveLink_StartLiveLink != NULL ? UnrealLiveLink_StartLiveLink() : UNREAL_LIVE_LINK_NOT_LOADED ; });
+    m.def("stop_live_link", []() -> int { return UnrealLiveLink_StopLiveLink != NULL ? UnrealLiveLink_StopLiveLink() : UNREAL_LIVE_LINK_NOT_LOADED ; });
+
+    m.def("create_provider", [](const std::string& provider_name) -> int {
+        if (UnrealLiveLink_CreateProvider != NULL) {
+            return UnrealLiveLink_CreateProvider(provider_name.c_str());
+        }
+        return UNREAL_LIVE_LINK_NO_PROVIDER;
+    });
+    m.def("destroy_provider", [](int provider) -> int { return UnrealLiveLink_DestroyProvider != NULL ? UnrealLiveLink_DestroyProvider(provider) : UNREAL_LIVE_LINK_NOT_LOADED ; });
+    m.def("start_provider", [](int provider) -> int { return UnrealLiveLink_StartProvider != NULL ? UnrealLiveLink_StartProvider(provider) : UNREAL_LIVE_LINK_NOT_LOADED ; });
+    m.def("stop_provider", [](int provider) -> int { return UnrealLiveLink_StopProvider != NULL ? UnrealLiveLink_StopProvider(provider) : UNREAL_LIVE_LINK_NOT_LOADED ; });
+    m.def("provider_has_connection", [](int provider) -> bool { return UnrealLiveLink_ProviderHasConnection != NULL ? UnrealLiveLink_ProviderHasConnection(provider) == UNREAL_LIVE_LINK_OK : false; });
+    m.attr("DEFAULT_PROVIDER") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER;
+
+    m.def("get_static_data_stats", [](int provider) -> UnrealLiveLink_StaticDataStats {
+        auto stats = UnrealLiveLink_StaticDataStats();
+        stats.appliedCount = stats.skippedCount = 0;
+        if (UnrealLiveLink_ProviderGetStaticDataStats != NULL) {
+            UnrealLiveLink_ProviderGetStaticDataStats(provider, &stats);
+        }
+        return stats;
+    }, py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("set_validation", [](const std::string& subject_name, UnrealLiveLink_ValidationMode mode, float max_abs_value, int provider) -> int {
+        if (UnrealLiveLink_ProviderSetValidation != NULL) {
+            return UnrealLiveLink_ProviderSetValidation(provider, subject_name.c_str(), mode, max_abs_value);
+        }
+        return UNREAL_LIVE_LINK_NOT_LOADED;
+    }, py::arg("subject_name"), py::arg("mode"), py::arg("max_abs_value") = 0.0f, py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("get_validation_stats", [](int provider) -> UnrealLiveLink_ValidationStats {
+        auto stats = UnrealLiveLink_ValidationStats();
+        stats.checkedCount = stats.normalizedCount = stats.repairedCount = stats.rejectedCount = 0;
+        if (UnrealLiveLink_ProviderGetValidationStats != NULL) {
+            UnrealLiveLink_ProviderGetValidationStats(provider, &stats);
+        }
+        return stats;
+    }, py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("set_filter", [](const std::string& subject_name, UnrealLiveLink_FilterChannel channel, const UnrealLiveLink_FilterSettings *settings, int provider) -> int {
+        if (UnrealLiveLink_ProviderSetFilter != NULL) {
+            return UnrealLiveLink_ProviderSetFilter(provider, subject_name.c_str(), channel, settings);
+        }
+        return UNREAL_LIVE_LINK_NOT_LOADED;
+    }, py::arg("subject_name"), py::arg("channel"), py::arg("settings").none(true), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("set_resampling", [](const std::string& subject_name, double output_rate, double delay, int provider) -> int {
+        if (UnrealLiveLink_ProviderSetResampling != NULL) {
+            return UnrealLiveLink_ProviderSetResampling(provider, subject_name.c_str(), output_rate, delay);
+        }
+        return UNREAL_LIVE_LINK_NOT_LOADED;
+    }, py::arg("subject_name"), py::arg("output_rate"), py::arg("delay") = 0.0, py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("set_extrapolation", [](const std::string& subject_name, const UnrealLiveLink_ExtrapolationSettings *settings, int provider) -> int {
+        if (UnrealLiveLink_ProviderSetExtrapolation != NULL) {
+            return UnrealLiveLink_ProviderSetExtrapolation(provider, subject_name.c_str(), settings);
+        }
+        return UNREAL_LIVE_LINK_NOT_LOADED;
+    }, py::arg("subject_name"), py::arg("settings").none(true), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("set_clock", [](const UnrealLiveLink_ClockSettings *settings, int provider) -> int {
+        if (UnrealLiveLink_ProviderSetClock != NULL) {
+            return UnrealLiveLink_ProviderSetClock(provider, settings);
+        }
+        return UNREAL_LIVE_LINK_NOT_LOADED;
+    }, py::arg("settings").none(true), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("get_clock_stats", [](int provider) -> UnrealLiveLink_ClockStats {
+        auto stats = UnrealLiveLink_ClockStats();
+        stats.offset = stats.drift = stats.jitter = 0.0;
+        stats.sampleCount = 0;
+        if (UnrealLiveLink_ProviderGetClockStats != NULL) {
+            UnrealLiveLink_ProviderGetClockStats(provider, &stats);
+        }
+        return stats;
+    }, py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("get_extrapolation_stats", [](int provider) -> UnrealLiveLink_ExtrapolationStats {
+        auto stats = UnrealLiveLink_ExtrapolationStats();
+        stats.sampleCount = 0;
+        stats.meanTranslationError = stats.maxTranslationError = stats.meanRotationError = stats.maxRotationError = 0.0;
+        if (UnrealLiveLink_ProviderGetExtrapolationStats != NULL) {
+            UnrealLiveLink_ProviderGetExtrapolationStats(provider, &stats);
+        }
+        return stats;
+    }, py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("get_skeleton_setup_stats", [](int provider) -> UnrealLiveLink_SkeletonSetupStats {
+        auto stats = UnrealLiveLink_SkeletonSetupStats();
+        stats.boneCount = stats.propertyCount = 0;
+        stats.internSeconds = stats.totalSeconds = 0.0;
+        if (UnrealLiveLink_ProviderGetSkeletonSetupStats != NULL) {
+            UnrealLiveLink_ProviderGetSkeletonSetupStats(provider, &stats);
+        }
+        return stats;
+    }, py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+
+    m.def("set_basic_structure", &SetBasicStructure, py::arg("subject_name"), py::arg("properties"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("update_basic_frame", &UpdateBasicFrame, py::arg("subject_name"), py::arg("world_time"), py::arg("metadata"), py::arg("property_values"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("update_basic_frame_sparse", &UpdateBasicFrameSparse, py::arg("subject_name"), py::arg("world_time"), py::arg("metadata"), py::arg("property_indices"), py::arg("property_values"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("set_transform_structure", &SetTransformStructure, py::arg("subject_name"), py::arg("properties"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("update_transform_frame", &UpdateTransformFrame, py::arg("subject_name"), py::arg("world_time"), py::arg("metadata"), py::arg("property_values"), py::arg("frame"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("update_transform_frame_matrix", &UpdateTransformFrameMatrix, py::arg("subject_name"), py::arg("world_time"), py::arg("metadata"), py::arg("property_values"), py::arg("matrix"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("set_animation_structure", &SetAnimationStructure, py::arg("subject_name"), py::arg("properties"), py::arg("animation"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("update_animation_frame", &UpdateAnimationFrame, py::arg("subject_name"), py::arg("world_time"), py::arg("metadata"), py::arg("property_values"), py::arg("animation"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("update_animation_frame_sparse", &UpdateAnimationFrameSparse, py::arg("subject_name"), py::arg("world_time"), py::arg("metadata"), py::arg("property_indices"), py::arg("property_values"), py::arg("bone_indices"), py::arg("animation"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("update_animation_frame_matrices", &UpdateAnimationFrameMatrices, py::arg("subject_name"), py::arg("world_time"), py::arg("metadata"), py::arg("property_values"), py::arg("matrices"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("update_animation_frames", &UpdateAnimationFrames, py::arg("frames"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("register_skeleton_template", &RegisterSkeletonTemplate, py::arg("properties"), py::arg("animation"));
+    m.def("unregister_skeleton_template", [](int skeleton_template) -> int {
+        return UnrealLiveLink_UnregisterSkeletonTemplate != NULL ? UnrealLiveLink_UnregisterSkeletonTemplate(skeleton_template) : UNREAL_LIVE_LINK_NOT_LOADED;
+    });
+    m.def("create_skeleton_map", &CreateSkeletonMap, py::arg("source_names"), py::arg("animation"));
+    m.def("destroy_skeleton_map", [](int skeleton_map) -> int {
+        return UnrealLiveLink_DestroySkeletonMap != NULL ? UnrealLiveLink_DestroySkeletonMap(skeleton_map) : UNREAL_LIVE_LINK_NOT_LOADED;
+    });
+    m.def("update_animation_frame_mapped", &UpdateAnimationFrameMapped, py::arg("subject_name"), py::arg("world_time"), py::arg("metadata"), py::arg("property_values"), py::arg("skeleton_map"), py::arg("animation"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("set_animation_structure_from_template", [](const std::string& subject_name, int skeleton_template, int provider) -> int {
+        if (UnrealLiveLink_ProviderSetAnimationStructureFromTemplate != NULL) {
+            py::gil_scoped_release release;
+            return UnrealLiveLink_ProviderSetAnimationStructureFromTemplate(provider, subject_name.c_str(), skeleton_template);
+        }
+        return UNREAL_LIVE_LINK_NOT_LOADED;
+    }, py::arg("subject_name"), py::arg("skeleton_template"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("set_animation_transform_space", [](const std::string& subject_name, UnrealLiveLink_TransformSpace space, int provider) -> int {
+        if (UnrealLiveLink_ProviderSetAnimationTransformSpace != NULL) {
+            return UnrealLiveLink_ProviderSetAnimationTransformSpace(provider, subject_name.c_str(), space);
+        }
+        return UNREAL_LIVE_LINK_NOT_LOADED;
+    }, py::arg("subject_name"), py::arg("space"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("set_rotation_order", [](const std::string& subject_name, UnrealLiveLink_RotationOrder order, bool radians, int provider) -> int {
+        if (UnrealLiveLink_ProviderSetRotationOrder != NULL) {
+            return UnrealLiveLink_ProviderSetRotationOrder(provider, subject_name.c_str(), order, radians ? 1 : 0);
+        }
+        return UNREAL_LIVE_LINK_NOT_LOADED;
+    }, py::arg("subject_name"), py::arg("order"), py::arg("radians") = false, py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("set_camera_structure", &SetCameraStructure, py::arg("subject_name"), py::arg("properties"), py::arg("camera"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("update_camera_frame", &UpdateCameraFrame, py::arg("subject_name"), py::arg("world_time"), py::arg("metadata"), py::arg("property_values"), py::arg("camera"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("update_camera_frame_matrix", &UpdateCameraFrameMatrix, py::arg("subject_name"), py::arg("world_time"), py::arg("metadata"), py::arg("property_values"), py::arg("camera"), py::arg("matrix"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("set_light_structure", &SetLightStructure, py::arg("subject_name"), py::arg("properties"), py::arg("light"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("update_light_frame", &UpdateLightFrame, py::arg("subject_name"), py::arg("world_time"), py::arg("metadata"), py::arg("property_values"), py::arg("light"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("update_light_frame_matrix", &UpdateLightFrameMatrix, py::arg("subject_name"), py::arg("world_time"), py::arg("metadata"), py::arg("property_values"), py::arg("light"), py::arg("matrix"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+
+    m.def("encode_clip", &EncodeClip, py::arg("frames"), py::arg("frame_rate"), py::arg("settings") = nullptr);
+    pybind11::class_<Clip>(m, "Clip")
+        .def(pybind11::init<const py::bytes&>(), py::arg("data"))
+        .def("decode_frame", &Clip::DecodeFrame, py::arg("frame"), py::arg("animation"))
+        .def_property_readonly("bone_count", [](const Clip& clip) { return clip.Info().boneCount; })
+        .def_property_readonly("frame_count", [](const Clip& clip) { return clip.Info().frameCount; })
+        .def_property_readonly("frame_rate", [](const Clip& clip) { return clip.Info().frameRate; })
+        .def_property_readonly("block_frames", [](const Clip& clip) { return clip.Info().blockFrames; });
+
+    // asyncio interface, submits copy the frame and run the update on the native queue thread
+    pybind11::class_<FrameClock>(m, "FrameClock")
+        .def(pybind11::init<double>(), py::arg("rate"))
+        .def("tick", &FrameClock::Tick)
+        .def("wait", &FrameClock::Wait)
+        .def_property_readonly("time", &FrameClock::Time)
+        .def_property_readonly("frame_time", &FrameClock::FrameTime);
+
+    m.def("submit_basic_frame", [](const std::string& subject_name, const double world_time,
+        const Metadata& metadata, const PropertyValues& property_values, int provider) -> py::object {
+        return GetAsyncQueue().Submit([=]() -> py::object {
+            return py::int_(UpdateBasicFrame(subject_name, world_time, metadata, property_values, provider));
+        });
+    }, py::arg("subject_name"), py::arg("world_time"), py::arg("metadata"), py::arg("property_values"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("submit_transform_frame", [](const std::string& subject_name, const double world_time,
+        const Metadata& metadata, const PropertyValues& property_values, const Transform& frame, int provider) -> py::object {
+        return GetAsyncQueue().Submit([=]() -> py::object {
+            return py::int_(UpdateTransformFrame(subject_name, world_time, metadata, property_values, frame, provider));
+        });
+    }, py::arg("subject_name"), py::arg("world_time"), py::arg("metadata"), py::arg("property_values"), py::arg("frame"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("submit_animation_frame", [](const std::string& subject_name, const double world_time,
+        const Metadata& metadata, const PropertyValues& property_values, const Animation& animation, int provider) -> py::object {
+        return GetAsyncQueue().Submit([=]() -> py::object {
+            Animation frame = animation;
+            return py::int_(UpdateAnimationFrame(subject_name, world_time, metadata, property_values, frame, provider));
+        });
+    }, py::arg("subject_name"), py::arg("world_time"), py::arg("metadata"), py::arg("property_values"), py::arg("animation"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("submit_camera_frame", [](const std::string& subject_name, const double world_time,
+        const Metadata& metadata, const PropertyValues& property_values, const Camera& camera, int provider) -> py::object {
+        return GetAsyncQueue().Submit([=]() -> py::object {
+            Camera frame = camera;
+            return py::int_(UpdateCameraFrame(subject_name, world_time, metadata, property_values, frame, provider));
+        });
+    }, py::arg("subject_name"), py::arg("world_time"), py::arg("metadata"), py::arg("property_values"), py::arg("camera"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("submit_light_frame", [](const std::string& subject_name, const double world_time,
+        const Metadata& metadata, const PropertyValues& property_values, const Light& light, int provider) -> py::object {
+        return GetAsyncQueue().Submit([=]() -> py::object {
+            Light frame = light;
+            return py::int_(UpdateLightFrame(subject_name, world_time, metadata, property_values, frame, provider));
+        });
+    }, py::arg("subject_name"), py::arg("world_time"), py::arg("metadata"), py::arg("property_values"), py::arg("light"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("connection_changed", &ConnectionChanged, py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+
+    m.def("register_connection_callback", &RegisterConnectionCallback, py::arg("callback"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("unregister_connection_callback", &UnregisterConnectionCallback, py::arg("callback"), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+    m.def("wait_for_connection", &WaitForConnection, py::arg("timeout") = py::none(), py::arg("provider") = UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+
+    py::module_::import("atexit").attr("register")(py::cpp_function([]() { StopAsync(true); }));
+
+#ifdef VERSION_INFO
+    m.attr("__version__") = MACRO_STRINGIFY(VERSION_INFO);
+#else
+    m.attr("__version__") = "dev";
+#endif
+}
+
+
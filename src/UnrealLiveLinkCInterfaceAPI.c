@@ -1,338 +1,663 @@
-/** 
- * Copyright (c) 2020 Patrick Palmer, The Jim Henson Company.
- * 
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files (the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions:
- * 
- * The above copyright notice and this permission notice shall be included in
- * all copies or substantial portions of the Software.
- * 
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
- * SOFTWARE.
- */
-
-/**
- * References:
- *     * https://docs.unrealengine.com/en-US/Engine/Animation/LiveLinkPlugin/index.html
- *     * https://github.com/ue4plugins/MobuLiveLink
- *     * http://www.cplusplus.com/articles/48TbqMoL
- */ 
-
-#include <stdio.h>
-#include <stddef.h>
-#include <string.h>
-
-#ifdef WIN32
-#define WIN32_LEAN_AND_MEAN
-#include "Windows.h"
-#else
-#include <dlfcn.h>
-#endif
-
-#include "UnrealLiveLinkCInterfaceAPI.h"
-
-
-
-/* function pointers */
-void (*UnrealLiveLink_Initialize)(void) = NULL;
-void (*UnrealLiveLink_Shutdown)(void) = NULL;
-
-int (*UnrealLiveLink_GetVersion)(void) = NULL;
-
-void (*UnrealLiveLink_SetProviderName)(const char *) = NULL;
-
-int (*UnrealLiveLink_StartLiveLink)(void) = NULL;
-int (*UnrealLiveLink_StopLiveLink)(void) = NULL;
-
-void (*UnrealLiveLink_SetUnicastEndpoint)(const char* endpoint) = NULL;
-int (*UnrealLiveLink_AddStaticEndpoint)(const char* endpoint) = NULL;
-int (*UnrealLiveLink_RemoveStaticEndpoint)(const char* endpoint) = NULL;
-
-void (*UnrealLiveLink_RegisterConnectionUpdateCallback)(void (*callback)()) = NULL;
-int (*UnrealLiveLink_HasConnection)(void) = NULL;
-
-void (*UnrealLiveLink_SetBasicStructure)(const char *subjectName, const struct UnrealLiveLink_Properties *properties) = NULL;
-void (*UnrealLiveLink_UpdateBasicFrame)(const char *subjectName, const double worldTime, const struct UnrealLiveLink_Metadata *metadata,
-	const struct UnrealLiveLink_PropertyValues *propValues) = NULL;
-
-void (*UnrealLiveLink_SetAnimationStructure)(
-	const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_AnimationStatic *structure) = NULL;
-void (*UnrealLiveLink_UpdateAnimationFrame)(const char *subjectName, const double worldTime,
-	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
-	const struct UnrealLiveLink_Animation *frame) = NULL;
-
-void (*UnrealLiveLink_SetTransformStructure)(const char *subjectName, const struct UnrealLiveLink_Properties *properties) = NULL;
-void (*UnrealLiveLink_UpdateTransformFrame)(const char *subjectName, const double worldTime,
-	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
-	const struct UnrealLiveLink_Transform *frame) = NULL;
-
-void (*UnrealLiveLink_SetCameraStructure)(
-	const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_CameraStatic *structure) = NULL;
-void (*UnrealLiveLink_UpdateCameraFrame)(const char *subjectName, const double worldTime, const struct UnrealLiveLink_Metadata *metadata,
-	const struct UnrealLiveLink_PropertyValues *propValues, const struct UnrealLiveLink_Camera *frame) = NULL;
-
-void (*UnrealLiveLink_SetLightStructure)(
-	const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_LightStatic *structure) = NULL;
-void (*UnrealLiveLink_UpdateLightFrame)(const char *subjectName, const double worldTime, const struct UnrealLiveLink_Metadata *metadata,
-	const struct UnrealLiveLink_PropertyValues *propValues, const struct UnrealLiveLink_Light *frame) = NULL;
-
-#ifdef WIN32
-static HMODULE UnrealLiveLink_SharedObject = NULL;
-
-#define GET_FUNC_ADDR GetProcAddress
-#else
-static void * UnrealLiveLink_SharedObject = NULL;
-
-#define GET_FUNC_ADDR dlsym
-#endif
-
-int UnrealLiveLink_Load(const char *cInterfaceSharedObjectFilename)
-{
-	UnrealLiveLink_SharedObject = NULL;
-
-#ifdef WIN32
-	HMODULE mod = LoadLibrary(cInterfaceSharedObjectFilename);
-	if (!mod)
-	{
-		DWORD error = GetLastError();
-		printf("UnrealLiveLink_Load: unable to load library (error %ld)\n", error);
-		return UNREAL_LIVE_LINK_MISSING_LIB;
-	}
-#else
-	void * mod = dlopen(cInterfaceSharedObjectFilename, RTLD_LAZY);
-	if (!mod)
-	{
-		printf("UnrealLiveLink_Load: unable to load library. Error %s\n", dlerror());
-		return UNREAL_LIVE_LINK_MISSING_LIB;
-	}
-#endif
-
-	UnrealLiveLink_Initialize = (void (*)(void)) GET_FUNC_ADDR(mod, "UnrealLiveLink_Initialize");
-	if (UnrealLiveLink_Initialize)
-	{
-		UnrealLiveLink_Initialize();
-	}
-	else
-	{
-#ifdef __linux__
-		printf("UnrealLiveLink_Load: unable to load function. Error %s\n", dlerror());
-#endif
-		return UNREAL_LIVE_LINK_INCOMPLETE;
-	}
-
-	UnrealLiveLink_Shutdown = (void (*)(void)) GET_FUNC_ADDR(mod, "UnrealLiveLink_Shutdown");
-	if (!UnrealLiveLink_Shutdown)
-	{
-#ifdef __linux__
-		printf("UnrealLiveLink_Load: unable to load function. Error %s\n", dlerror());
-#endif
-		return UNREAL_LIVE_LINK_INCOMPLETE;
-	}
-
-	/* check API version */
-	UnrealLiveLink_GetVersion = (int (*)(void)) GET_FUNC_ADDR(mod, "UnrealLiveLink_GetVersion");
-	if (UnrealLiveLink_GetVersion)
-	{
-		if ((*UnrealLiveLink_GetVersion)() != UNREAL_LIVE_LINK_API_VERSION)
-		{
-			return UNREAL_LIVE_LINK_WRONG_VERSION;
-		}
-	}
-	else
-	{
-		return UNREAL_LIVE_LINK_INCOMPLETE;
-	}
-
-	UnrealLiveLink_SetProviderName =
-		(void (*)(const char *)) GET_FUNC_ADDR(mod, "UnrealLiveLink_SetProviderName");
-
-	UnrealLiveLink_StartLiveLink =
-		(int (*)(void)) GET_FUNC_ADDR(mod, "UnrealLiveLink_StartLiveLink");
-	UnrealLiveLink_StopLiveLink =
-		(int (*)(void)) GET_FUNC_ADDR(mod, "UnrealLiveLink_StopLiveLink");
-
-	UnrealLiveLink_SetUnicastEndpoint =
-		(void (*)(const char *)) GET_FUNC_ADDR(mod, "UnrealLiveLink_SetUnicastEndpoint");
-	UnrealLiveLink_AddStaticEndpoint =
-		(int (*)(const char *)) GET_FUNC_ADDR(mod, "UnrealLiveLink_AddStaticEndpoint");
-	UnrealLiveLink_RemoveStaticEndpoint =
-		(int (*)(const char *)) GET_FUNC_ADDR(mod, "UnrealLiveLink_RemoveStaticEndpoint");
-
-	UnrealLiveLink_RegisterConnectionUpdateCallback =
-		(void (*)(void (*)())) GET_FUNC_ADDR(mod, "UnrealLiveLink_RegisterConnectionUpdateCallback");
-	UnrealLiveLink_HasConnection = (int (*)()) GET_FUNC_ADDR(mod, "UnrealLiveLink_HasConnection");
-
-	UnrealLiveLink_SetBasicStructure =
-		(void (*)(const char *, const struct UnrealLiveLink_Properties *)) GET_FUNC_ADDR(mod, "UnrealLiveLink_SetBasicStructure");
-	UnrealLiveLink_UpdateBasicFrame = (void (*)(const char *, const double, const struct UnrealLiveLink_Metadata *,
-		const struct UnrealLiveLink_PropertyValues *)) GET_FUNC_ADDR(mod, "UnrealLiveLink_UpdateBasicFrame");
-
-	UnrealLiveLink_SetAnimationStructure = (void (*)(const char *, const struct UnrealLiveLink_Properties *,
-		struct UnrealLiveLink_AnimationStatic *)) GET_FUNC_ADDR(mod, "UnrealLiveLink_SetAnimationStructure");
-	UnrealLiveLink_UpdateAnimationFrame =
-		(void (*)(const char *, const double, const struct UnrealLiveLink_Metadata *, const struct UnrealLiveLink_PropertyValues *,
-			const struct UnrealLiveLink_Animation *)) GET_FUNC_ADDR(mod, "UnrealLiveLink_UpdateAnimationFrame");
-
-	UnrealLiveLink_SetTransformStructure =
-		(void (*)(const char *, const struct UnrealLiveLink_Properties *)) GET_FUNC_ADDR(mod, "UnrealLiveLink_SetTransformStructure");
-	UnrealLiveLink_UpdateTransformFrame =
-		(void (*)(const char *, const double, const struct UnrealLiveLink_Metadata *, const struct UnrealLiveLink_PropertyValues *,
-			const struct UnrealLiveLink_Transform *)) GET_FUNC_ADDR(mod, "UnrealLiveLink_UpdateTransformFrame");
-
-	UnrealLiveLink_SetCameraStructure = (void (*)(const char *, const struct UnrealLiveLink_Properties *,
-		struct UnrealLiveLink_CameraStatic *)) GET_FUNC_ADDR(mod, "UnrealLiveLink_SetCameraStructure");
-	UnrealLiveLink_UpdateCameraFrame =
-		(void (*)(const char *, const double, const struct UnrealLiveLink_Metadata *, const struct UnrealLiveLink_PropertyValues *,
-			const struct UnrealLiveLink_Camera *)) GET_FUNC_ADDR(mod, "UnrealLiveLink_UpdateCameraFrame");
-
-	UnrealLiveLink_SetLightStructure = (void (*)(const char *, const struct UnrealLiveLink_Properties *,
-		struct UnrealLiveLink_LightStatic *)) GET_FUNC_ADDR(mod, "UnrealLiveLink_SetLightStructure");
-	UnrealLiveLink_UpdateLightFrame =
-		(void (*)(const char *, const double, const struct UnrealLiveLink_Metadata *, const struct UnrealLiveLink_PropertyValues *,
-			const struct UnrealLiveLink_Light *)) GET_FUNC_ADDR(mod, "UnrealLiveLink_UpdateLightFrame");
-
-	if (!UnrealLiveLink_SetProviderName || !UnrealLiveLink_StartLiveLink || !UnrealLiveLink_StopLiveLink ||
-		!UnrealLiveLink_SetUnicastEndpoint || !UnrealLiveLink_AddStaticEndpoint || !UnrealLiveLink_RemoveStaticEndpoint ||
-		!UnrealLiveLink_RegisterConnectionUpdateCallback || !UnrealLiveLink_HasConnection || !UnrealLiveLink_SetBasicStructure ||
-		!UnrealLiveLink_UpdateBasicFrame || !UnrealLiveLink_SetAnimationStructure ||
-		!UnrealLiveLink_UpdateAnimationFrame || !UnrealLiveLink_SetTransformStructure || !UnrealLiveLink_UpdateTransformFrame ||
-		!UnrealLiveLink_SetCameraStructure || !UnrealLiveLink_UpdateCameraFrame || !UnrealLiveLink_SetLightStructure ||
-		!UnrealLiveLink_UpdateLightFrame)
-	{
-		return UNREAL_LIVE_LINK_INCOMPLETE;
-	}
-
-	UnrealLiveLink_SharedObject = mod;
-
-	return UNREAL_LIVE_LINK_OK;
-}
-
-void UnrealLiveLink_Unload(void)
-{
-	if (UnrealLiveLink_StopLiveLink)
-	{
-		UnrealLiveLink_StopLiveLink();
-	}
-
-	if (UnrealLiveLink_Shutdown)
-	{
-		UnrealLiveLink_Shutdown();
-	}
-
-	if (UnrealLiveLink_SharedObject)
-	{
-#ifdef WIN32
-		FreeLibrary(UnrealLiveLink_SharedObject);
-#else
-		dlclose(UnrealLiveLink_SharedObject);
-#endif
-		UnrealLiveLink_SharedObject = NULL;
-	}
-}
-
-int UnrealLiveLink_IsLoaded(void)
-{
-	return UnrealLiveLink_SharedObject ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_NOT_LOADED;
-}
-
-void UnrealLiveLink_InitMetadata(struct UnrealLiveLink_Metadata *metadata)
-{
-	metadata->keyValueCount = 0;
-	metadata->keyValues = 0;
-
-	metadata->timecode.hours = 0;
-	metadata->timecode.minutes = 0;
-	metadata->timecode.seconds = 0;
-	metadata->timecode.frames = 0;
-	metadata->timecode.format = UNREAL_LIVE_LINK_TIMECODE_UNKNOWN;
-}
-
-void UnrealLiveLink_InitTransform(struct UnrealLiveLink_Transform * transform)
-{
-	int i;
-	for (i = 0; i < 4; i++)
-	{
-		transform->rotation[i] = 0.0f;
-	}
-	for (i = 0; i < 3; i++)
-	{
-		transform->translation[i] = 0.0f;
-		transform->scale[i] = 1.0f;
-	}
-}
-
-void UnrealLiveLink_InitCameraStatic(struct UnrealLiveLink_CameraStatic *structure)
-{
-	structure->isFieldOfViewSupported = 0;
-	structure->isAspectRatioSupported = 0;
-	structure->isFocalLengthSupported = 0;
-	structure->isProjectionModeSupported = 0;
-	structure->filmBackWidth = -1.0f;
-	structure->filmBackHeight = -1.0f;
-	structure->isApertureSupported = 0;
-	structure->isFocusDistanceSupported = 0;
-}
-
-void UnrealLiveLink_InitCamera(struct UnrealLiveLink_Camera *structure)
-{
-	UnrealLiveLink_InitTransform(&(structure->transform));
-
-	structure->fieldOfView = 90.f;
-	structure->aspectRatio = 1.777778f;
-	structure->focalLength = 50.f;
-	structure->aperture = 2.8f;
-	structure->focusDistance = 100000.0f;
-	structure->isPerspective = 1;
-}
-
-void UnrealLiveLink_InitLightStatic(struct UnrealLiveLink_LightStatic *structure)
-{
-	structure->isTemperatureSupported = 0;
-	structure->isIntensitySupported = 0;
-	structure->isLightColorSupported = 0;
-	structure->isInnerConeAngleSupported = 0;
-	structure->isOuterConeAngleSupported = 0;
-	structure->isAttenuationRadiusSupported = 0;
-	structure->isSourceLengthSupported = 0;
-	structure->isSourceRadiusSupported = 0;
-	structure->isSoftSourceRadiusSupported = 0;
-}
-
-void UnrealLiveLink_InitLight(struct UnrealLiveLink_Light *structure)
-{
-	int i;
-
-	UnrealLiveLink_InitTransform(&(structure->transform));
-
-	structure->temperature = 6500.0f;
-	structure->intensity = 3.1415926535897932f;
-
-	structure->innerConeAngle = 0.0f;
-	structure->outerConeAngle = 44.0f;
-	structure->attenuationRadius = 1000.0f;
-	structure->sourceRadius = 0.0f;
-	structure->softSourceRadius = 0.0f;
-	structure->sourceLength = 0.0f;
-
-	/* default white */
-	for (i = 0; i < 3; i++)
-	{
-		structure->lightColor[i] = 255;
-	}
-}
-
-void UnrealLiveLink_CopyName(const char *src, UnrealLiveLink_Name dst)
-{
-	strncpy(dst, src, UNREAL_LIVE_LINK_MAX_NAME_LENGTH); 
-	dst[UNREAL_LIVE_LINK_MAX_NAME_LENGTH - 1] = '\0';
-}
-
+/** 
+ * Copyright (c) 2020 Patrick Palmer, The Jim Henson Company.
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * References:
+ *     * https://docs.unrealengine.com/en-US/Engine/Animation/LiveLinkPlugin/index.html
+ *     * https://github.com/ue4plugins/MobuLiveLink
+ *     * http://www.cplusplus.com/articles/48TbqMoL
+ */ 
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef WIN32
+#define WIN32_LEAN_AND_MEAN
+#include "Windows.h"
+#else
+#include <dlfcn.h>
+#endif
+
+#include "UnrealLiveLinkCInterfaceAPI.h"
+
+
+
+/* function pointers */
+void (*UnrealLiveLink_Initialize)(void) = NULL;
+void (*UnrealLiveLink_Shutdown)(void) = NULL;
+
+int (*UnrealLiveLink_GetVersion)(void) = NULL;
+
+void (*UnrealLiveLink_SetProviderName)(const char *) = NULL;
+
+int (*UnrealLiveLink_StartLiveLink)(void) = NULL;
+int (*UnrealLiveLink_StopLiveLink)(void) = NULL;
+
+void (*UnrealLiveLink_SetUnicastEndpoint)(const char* endpoint) = NULL;
+int (*UnrealLiveLink_AddStaticEndpoint)(const char* endpoint) = NULL;
+int (*UnrealLiveLink_RemoveStaticEndpoint)(const char* endpoint) = NULL;
+int (*UnrealLiveLink_SetTransportSettings)(const struct UnrealLiveLink_TransportSettings *settings) = NULL;
+int (*UnrealLiveLink_GetTransportSettings)(struct UnrealLiveLink_TransportSettings *settings) = NULL;
+
+void (*UnrealLiveLink_RegisterConnectionUpdateCallback)(void (*callback)()) = NULL;
+int (*UnrealLiveLink_HasConnection)(void) = NULL;
+
+int (*UnrealLiveLink_SetTickerRate)(double rate) = NULL;
+int (*UnrealLiveLink_Pump)(void) = NULL;
+int (*UnrealLiveLink_GetTickerStats)(struct UnrealLiveLink_TickerStats *stats) = NULL;
+
+void (*UnrealLiveLink_SetBasicStructure)(const char *subjectName, const struct UnrealLiveLink_Properties *properties) = NULL;
+void (*UnrealLiveLink_UpdateBasicFrame)(const char *subjectName, const double worldTime, const struct UnrealLiveLink_Metadata *metadata,
+	const struct UnrealLiveLink_PropertyValues *propValues) = NULL;
+
+void (*UnrealLiveLink_SetAnimationStructure)(
+	const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_AnimationStatic *structure) = NULL;
+void (*UnrealLiveLink_UpdateAnimationFrame)(const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Animation *frame) = NULL;
+
+void (*UnrealLiveLink_SetTransformStructure)(const char *subjectName, const struct UnrealLiveLink_Properties *properties) = NULL;
+void (*UnrealLiveLink_UpdateTransformFrame)(const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Transform *frame) = NULL;
+
+void (*UnrealLiveLink_SetCameraStructure)(
+	const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_CameraStatic *structure) = NULL;
+void (*UnrealLiveLink_UpdateCameraFrame)(const char *subjectName, const double worldTime, const struct UnrealLiveLink_Metadata *metadata,
+	const struct UnrealLiveLink_PropertyValues *propValues, const struct UnrealLiveLink_Camera *frame) = NULL;
+
+void (*UnrealLiveLink_SetLightStructure)(
+	const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_LightStatic *structure) = NULL;
+void (*UnrealLiveLink_UpdateLightFrame)(const char *subjectName, const double worldTime, const struct UnrealLiveLink_Metadata *metadata,
+	const struct UnrealLiveLink_PropertyValues *propValues, const struct UnrealLiveLink_Light *frame) = NULL;
+
+int (*UnrealLiveLink_CreateProvider)(const char *providerName) = NULL;
+int (*UnrealLiveLink_DestroyProvider)(int provider) = NULL;
+int (*UnrealLiveLink_StartProvider)(int provider) = NULL;
+int (*UnrealLiveLink_StopProvider)(int provider) = NULL;
+
+int (*UnrealLiveLink_RegisterProviderConnectionUpdateCallback)(int provider, void (*callback)()) = NULL;
+int (*UnrealLiveLink_ProviderHasConnection)(int provider) = NULL;
+int (*UnrealLiveLink_ProviderGetConnectionStats)(int provider, struct UnrealLiveLink_ConnectionStats *stats) = NULL;
+
+int (*UnrealLiveLink_ProviderGetStaticDataStats)(int provider, struct UnrealLiveLink_StaticDataStats *stats) = NULL;
+
+int (*UnrealLiveLink_ProviderSetBasicStructure)(int provider, const char *subjectName, const struct UnrealLiveLink_Properties *properties) = NULL;
+int (*UnrealLiveLink_ProviderUpdateBasicFrame)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues) = NULL;
+
+int (*UnrealLiveLink_ProviderSetAnimationStructure)(int provider,
+	const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_AnimationStatic *structure) = NULL;
+int (*UnrealLiveLink_ProviderUpdateAnimationFrame)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Animation *frame) = NULL;
+int (*UnrealLiveLink_ProviderUpdateAnimationFrames)(int provider, const struct UnrealLiveLink_AnimationSubjectFrame *frames, int frameCount) = NULL;
+
+int (*UnrealLiveLink_RegisterSkeletonTemplate)(
+	const struct UnrealLiveLink_Properties *properties, const struct UnrealLiveLink_AnimationStatic *structure) = NULL;
+int (*UnrealLiveLink_UnregisterSkeletonTemplate)(int skeletonTemplate) = NULL;
+int (*UnrealLiveLink_ProviderSetAnimationStructureFromTemplate)(int provider, const char *subjectName, int skeletonTemplate) = NULL;
+
+int (*UnrealLiveLink_ProviderSetAnimationTransformSpace)(int provider, const char *subjectName, enum UnrealLiveLink_TransformSpace space) = NULL;
+int (*UnrealLiveLink_ProviderSetRotationOrder)(int provider, const char *subjectName, enum UnrealLiveLink_RotationOrder order, int isRadians) = NULL;
+
+int (*UnrealLiveLink_ProviderSetValidation)(int provider, const char *subjectName, enum UnrealLiveLink_ValidationMode mode, float maxAbsValue) = NULL;
+int (*UnrealLiveLink_ProviderGetValidationStats)(int provider, struct UnrealLiveLink_ValidationStats *stats) = NULL;
+int (*UnrealLiveLink_ProviderSetFilter)(int provider, const char *subjectName, enum UnrealLiveLink_FilterChannel channel,
+	const struct UnrealLiveLink_FilterSettings *settings) = NULL;
+int (*UnrealLiveLink_ProviderSetResampling)(int provider, const char *subjectName, double outputRate, double delay) = NULL;
+int (*UnrealLiveLink_ProviderSetExtrapolation)(int provider, const char *subjectName, const struct UnrealLiveLink_ExtrapolationSettings *settings) = NULL;
+int (*UnrealLiveLink_ProviderGetExtrapolationStats)(int provider, struct UnrealLiveLink_ExtrapolationStats *stats) = NULL;
+int (*UnrealLiveLink_ProviderSetClock)(int provider, const struct UnrealLiveLink_ClockSettings *settings) = NULL;
+int (*UnrealLiveLink_ProviderGetClockStats)(int provider, struct UnrealLiveLink_ClockStats *stats) = NULL;
+
+int (*UnrealLiveLink_CreateSkeletonMap)(
+	const struct UnrealLiveLink_Properties *sourceNames, const struct UnrealLiveLink_AnimationStatic *structure) = NULL;
+int (*UnrealLiveLink_DestroySkeletonMap)(int skeletonMap) = NULL;
+int (*UnrealLiveLink_ProviderUpdateAnimationFrameMapped)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_PackedMetadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	int skeletonMap, const struct UnrealLiveLink_Animation *frame) = NULL;
+
+int (*UnrealLiveLink_ProviderUpdateBasicFrameSparse)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_PackedMetadata *metadata, const struct UnrealLiveLink_SparsePropertyValues *propValues) = NULL;
+int (*UnrealLiveLink_ProviderUpdateAnimationFrameSparse)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_PackedMetadata *metadata, const struct UnrealLiveLink_SparsePropertyValues *propValues,
+	const struct UnrealLiveLink_SparseTransforms *frame) = NULL;
+
+int (*UnrealLiveLink_ProviderUpdateTransformFrameMatrix)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Matrix *frame) = NULL;
+int (*UnrealLiveLink_ProviderUpdateAnimationFrameMatrices)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_AnimationMatrices *frame) = NULL;
+int (*UnrealLiveLink_ProviderUpdateCameraFrameMatrix)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Camera *frame, const struct UnrealLiveLink_Matrix *transform) = NULL;
+int (*UnrealLiveLink_ProviderUpdateLightFrameMatrix)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Light *frame, const struct UnrealLiveLink_Matrix *transform) = NULL;
+
+int (*UnrealLiveLink_ProviderSetBasicStructurePacked)(int provider, const char *subjectName,
+	const struct UnrealLiveLink_PackedStrings *propertyNames) = NULL;
+int (*UnrealLiveLink_ProviderUpdateBasicFramePacked)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_PackedMetadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues) = NULL;
+int (*UnrealLiveLink_ProviderSetAnimationStructurePacked)(int provider, const char *subjectName,
+	const struct UnrealLiveLink_PackedStrings *propertyNames, const struct UnrealLiveLink_PackedAnimationStatic *structure) = NULL;
+int (*UnrealLiveLink_ProviderUpdateAnimationFramePacked)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_PackedMetadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Animation *frame) = NULL;
+int (*UnrealLiveLink_ProviderGetSkeletonSetupStats)(int provider, struct UnrealLiveLink_SkeletonSetupStats *stats) = NULL;
+
+int (*UnrealLiveLink_ProviderSetTransformStructure)(int provider, const char *subjectName, const struct UnrealLiveLink_Properties *properties) = NULL;
+int (*UnrealLiveLink_ProviderUpdateTransformFrame)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Transform *frame) = NULL;
+
+int (*UnrealLiveLink_ProviderSetCameraStructure)(int provider,
+	const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_CameraStatic *structure) = NULL;
+int (*UnrealLiveLink_ProviderUpdateCameraFrame)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Camera *frame) = NULL;
+
+int (*UnrealLiveLink_ProviderSetLightStructure)(int provider,
+	const char *subjectName, const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_LightStatic *structure) = NULL;
+int (*UnrealLiveLink_ProviderUpdateLightFrame)(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Light *frame) = NULL;
+
+#ifdef WIN32
+static HMODULE UnrealLiveLink_SharedObject = NULL;
+
+#define GET_FUNC_ADDR GetProcAddress
+#define FUNC_ADDR_TYPE FARPROC
+#define FREE_LIB FreeLibrary
+#else
+static void * UnrealLiveLink_SharedObject = NULL;
+
+#define GET_FUNC_ADDR dlsym
+#define FUNC_ADDR_TYPE void *
+#define FREE_LIB dlclose
+#endif
+
+/* look up a table member by its exported UnrealLiveLink_ name */
+#define GET_INTERFACE_FUNC(mod, interface, name) (*(FUNC_ADDR_TYPE *) &(interface).name = GET_FUNC_ADDR(mod, "UnrealLiveLink_" #name))
+
+/* copy of the loaded shared object's table, members it doesn't have are null */
+static struct UnrealLiveLink_Interface UnrealLiveLink_LoadedInterface;
+
+/* point the exported function pointers at the table's members */
+static void UnrealLiveLink_SetFunctions(const struct UnrealLiveLink_Interface *loadedInterface)
+{
+	UnrealLiveLink_Initialize = loadedInterface->Initialize;
+	UnrealLiveLink_Shutdown = loadedInterface->Shutdown;
+	UnrealLiveLink_GetVersion = loadedInterface->GetVersion;
+	UnrealLiveLink_SetProviderName = loadedInterface->SetProviderName;
+	UnrealLiveLink_StartLiveLink = loadedInterface->StartLiveLink;
+	UnrealLiveLink_StopLiveLink = loadedInterface->StopLiveLink;
+	UnrealLiveLink_SetUnicastEndpoint = loadedInterface->SetUnicastEndpoint;
+	UnrealLiveLink_AddStaticEndpoint = loadedInterface->AddStaticEndpoint;
+	UnrealLiveLink_RemoveStaticEndpoint = loadedInterface->RemoveStaticEndpoint;
+	UnrealLiveLink_RegisterConnectionUpdateCallback = loadedInterface->RegisterConnectionUpdateCallback;
+	UnrealLiveLink_HasConnection = loadedInterface->HasConnection;
+	UnrealLiveLink_SetBasicStructure = loadedInterface->SetBasicStructure;
+	UnrealLiveLink_UpdateBasicFrame = loadedInterface->UpdateBasicFrame;
+	UnrealLiveLink_SetAnimationStructure = loadedInterface->SetAnimationStructure;
+	UnrealLiveLink_UpdateAnimationFrame = loadedInterface->UpdateAnimationFrame;
+	UnrealLiveLink_SetTransformStructure = loadedInterface->SetTransformStructure;
+	UnrealLiveLink_UpdateTransformFrame = loadedInterface->UpdateTransformFrame;
+	UnrealLiveLink_SetCameraStructure = loadedInterface->SetCameraStructure;
+	UnrealLiveLink_UpdateCameraFrame = loadedInterface->UpdateCameraFrame;
+	UnrealLiveLink_SetLightStructure = loadedInterface->SetLightStructure;
+	UnrealLiveLink_UpdateLightFrame = loadedInterface->UpdateLightFrame;
+	UnrealLiveLink_CreateProvider = loadedInterface->CreateProvider;
+	UnrealLiveLink_DestroyProvider = loadedInterface->DestroyProvider;
+	UnrealLiveLink_StartProvider = loadedInterface->StartProvider;
+	UnrealLiveLink_StopProvider = loadedInterface->StopProvider;
+	UnrealLiveLink_RegisterProviderConnectionUpdateCallback = loadedInterface->RegisterProviderConnectionUpdateCallback;
+	UnrealLiveLink_ProviderHasConnection = loadedInterface->ProviderHasConnection;
+	UnrealLiveLink_ProviderGetStaticDataStats = loadedInterface->ProviderGetStaticDataStats;
+	UnrealLiveLink_ProviderSetBasicStructure = loadedInterface->ProviderSetBasicStructure;
+	UnrealLiveLink_ProviderUpdateBasicFrame = loadedInterface->ProviderUpdateBasicFrame;
+	UnrealLiveLink_ProviderSetAnimationStructure = loadedInterface->ProviderSetAnimationStructure;
+	UnrealLiveLink_ProviderUpdateAnimationFrame = loadedInterface->ProviderUpdateAnimationFrame;
+	UnrealLiveLink_ProviderUpdateAnimationFrames = loadedInterface->ProviderUpdateAnimationFrames;
+	UnrealLiveLink_RegisterSkeletonTemplate = loadedInterface->RegisterSkeletonTemplate;
+	UnrealLiveLink_UnregisterSkeletonTemplate = loadedInterface->UnregisterSkeletonTemplate;
+	UnrealLiveLink_ProviderSetAnimationStructureFromTemplate = loadedInterface->ProviderSetAnimationStructureFromTemplate;
+	UnrealLiveLink_ProviderSetAnimationTransformSpace = loadedInterface->ProviderSetAnimationTransformSpace;
+	UnrealLiveLink_ProviderSetRotationOrder = loadedInterface->ProviderSetRotationOrder;
+	UnrealLiveLink_ProviderSetValidation = loadedInterface->ProviderSetValidation;
+	UnrealLiveLink_ProviderGetValidationStats = loadedInterface->ProviderGetValidationStats;
+	UnrealLiveLink_ProviderSetFilter = loadedInterface->ProviderSetFilter;
+	UnrealLiveLink_ProviderSetResampling = loadedInterface->ProviderSetResampling;
+	UnrealLiveLink_ProviderSetExtrapolation = loadedInterface->ProviderSetExtrapolation;
+	UnrealLiveLink_ProviderGetExtrapolationStats = loadedInterface->ProviderGetExtrapolationStats;
+	UnrealLiveLink_ProviderUpdateTransformFrameMatrix = loadedInterface->ProviderUpdateTransformFrameMatrix;
+	UnrealLiveLink_ProviderUpdateAnimationFrameMatrices = loadedInterface->ProviderUpdateAnimationFrameMatrices;
+	UnrealLiveLink_ProviderUpdateCameraFrameMatrix = loadedInterface->ProviderUpdateCameraFrameMatrix;
+	UnrealLiveLink_ProviderUpdateLightFrameMatrix = loadedInterface->ProviderUpdateLightFrameMatrix;
+	UnrealLiveLink_ProviderSetBasicStructurePacked = loadedInterface->ProviderSetBasicStructurePacked;
+	UnrealLiveLink_ProviderUpdateBasicFramePacked = loadedInterface->ProviderUpdateBasicFramePacked;
+	UnrealLiveLink_ProviderSetAnimationStructurePacked = loadedInterface->ProviderSetAnimationStructurePacked;
+	UnrealLiveLink_ProviderUpdateAnimationFramePacked = loadedInterface->ProviderUpdateAnimationFramePacked;
+	UnrealLiveLink_ProviderGetSkeletonSetupStats = loadedInterface->ProviderGetSkeletonSetupStats;
+	UnrealLiveLink_ProviderSetTransformStructure = loadedInterface->ProviderSetTransformStructure;
+	UnrealLiveLink_ProviderUpdateTransformFrame = loadedInterface->ProviderUpdateTransformFrame;
+	UnrealLiveLink_ProviderSetCameraStructure = loadedInterface->ProviderSetCameraStructure;
+	UnrealLiveLink_ProviderUpdateCameraFrame = loadedInterface->ProviderUpdateCameraFrame;
+	UnrealLiveLink_ProviderSetLightStructure = loadedInterface->ProviderSetLightStructure;
+	UnrealLiveLink_ProviderUpdateLightFrame = loadedInterface->ProviderUpdateLightFrame;
+	UnrealLiveLink_SetTransportSettings = loadedInterface->SetTransportSettings;
+	UnrealLiveLink_GetTransportSettings = loadedInterface->GetTransportSettings;
+	UnrealLiveLink_SetTickerRate = loadedInterface->SetTickerRate;
+	UnrealLiveLink_Pump = loadedInterface->Pump;
+	UnrealLiveLink_GetTickerStats = loadedInterface->GetTickerStats;
+	UnrealLiveLink_ProviderGetConnectionStats = loadedInterface->ProviderGetConnectionStats;
+	UnrealLiveLink_ProviderSetClock = loadedInterface->ProviderSetClock;
+	UnrealLiveLink_ProviderGetClockStats = loadedInterface->ProviderGetClockStats;
+	UnrealLiveLink_CreateSkeletonMap = loadedInterface->CreateSkeletonMap;
+	UnrealLiveLink_DestroySkeletonMap = loadedInterface->DestroySkeletonMap;
+	UnrealLiveLink_ProviderUpdateAnimationFrameMapped = loadedInterface->ProviderUpdateAnimationFrameMapped;
+	UnrealLiveLink_ProviderUpdateBasicFrameSparse = loadedInterface->ProviderUpdateBasicFrameSparse;
+	UnrealLiveLink_ProviderUpdateAnimationFrameSparse = loadedInterface->ProviderUpdateAnimationFrameSparse;
+}
+
+/* shared objects before UnrealLiveLink_Interface export each function by name, those they don't have stay null */
+static void UnrealLiveLink_GetFunctions(
+#ifdef WIN32
+	HMODULE mod,
+#else
+	void * mod,
+#endif
+	struct UnrealLiveLink_Interface *loadedInterface)
+{
+	GET_INTERFACE_FUNC(mod, *loadedInterface, Initialize);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, Shutdown);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, GetVersion);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, SetProviderName);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, StartLiveLink);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, StopLiveLink);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, SetUnicastEndpoint);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, AddStaticEndpoint);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, RemoveStaticEndpoint);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, RegisterConnectionUpdateCallback);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, HasConnection);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, SetBasicStructure);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, UpdateBasicFrame);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, SetAnimationStructure);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, UpdateAnimationFrame);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, SetTransformStructure);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, UpdateTransformFrame);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, SetCameraStructure);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, UpdateCameraFrame);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, SetLightStructure);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, UpdateLightFrame);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, CreateProvider);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, DestroyProvider);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, StartProvider);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, StopProvider);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, RegisterProviderConnectionUpdateCallback);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderHasConnection);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderGetStaticDataStats);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderSetBasicStructure);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderUpdateBasicFrame);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderSetAnimationStructure);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderUpdateAnimationFrame);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderUpdateAnimationFrames);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, RegisterSkeletonTemplate);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, UnregisterSkeletonTemplate);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderSetAnimationStructureFromTemplate);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderSetAnimationTransformSpace);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderSetRotationOrder);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderSetValidation);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderGetValidationStats);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderSetFilter);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderSetResampling);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderSetExtrapolation);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderGetExtrapolationStats);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderUpdateTransformFrameMatrix);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderUpdateAnimationFrameMatrices);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderUpdateCameraFrameMatrix);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderUpdateLightFrameMatrix);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderSetBasicStructurePacked);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderUpdateBasicFramePacked);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderSetAnimationStructurePacked);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderUpdateAnimationFramePacked);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderGetSkeletonSetupStats);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderSetTransformStructure);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderUpdateTransformFrame);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderSetCameraStructure);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderUpdateCameraFrame);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderSetLightStructure);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderUpdateLightFrame);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, SetTransportSettings);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, GetTransportSettings);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, SetTickerRate);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, Pump);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, GetTickerStats);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderGetConnectionStats);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderSetClock);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderGetClockStats);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, CreateSkeletonMap);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, DestroySkeletonMap);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderUpdateAnimationFrameMapped);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderUpdateBasicFrameSparse);
+	GET_INTERFACE_FUNC(mod, *loadedInterface, ProviderUpdateAnimationFrameSparse);
+}
+
+/* the functions every shared object since UNREAL_LIVE_LINK_MIN_API_VERSION has */
+static int UnrealLiveLink_HasBaseFunctions(const struct UnrealLiveLink_Interface *loadedInterface)
+{
+	return loadedInterface->Initialize && loadedInterface->Shutdown && loadedInterface->GetVersion &&
+		loadedInterface->SetProviderName && loadedInterface->StartLiveLink && loadedInterface->StopLiveLink &&
+		loadedInterface->SetUnicastEndpoint && loadedInterface->AddStaticEndpoint && loadedInterface->RemoveStaticEndpoint &&
+		loadedInterface->RegisterConnectionUpdateCallback && loadedInterface->HasConnection && loadedInterface->SetBasicStructure &&
+		loadedInterface->UpdateBasicFrame && loadedInterface->SetAnimationStructure &&
+		loadedInterface->UpdateAnimationFrame && loadedInterface->SetTransformStructure && loadedInterface->UpdateTransformFrame &&
+		loadedInterface->SetCameraStructure && loadedInterface->UpdateCameraFrame && loadedInterface->SetLightStructure &&
+		loadedInterface->UpdateLightFrame;
+}
+
+/* the functions every shared object with UnrealLiveLink_Interface has, the rest are optional (see UnrealLiveLink_GetCapabilities) */
+static int UnrealLiveLink_HasInterfaceFunctions(const struct UnrealLiveLink_Interface *loadedInterface)
+{
+	return loadedInterface->CreateProvider && loadedInterface->DestroyProvider && loadedInterface->StartProvider &&
+		loadedInterface->StopProvider && loadedInterface->RegisterProviderConnectionUpdateCallback && loadedInterface->ProviderHasConnection &&
+		loadedInterface->ProviderGetStaticDataStats &&
+		loadedInterface->ProviderSetBasicStructure && loadedInterface->ProviderUpdateBasicFrame &&
+		loadedInterface->ProviderSetAnimationStructure && loadedInterface->ProviderUpdateAnimationFrame &&
+		loadedInterface->ProviderUpdateAnimationFrames && loadedInterface->RegisterSkeletonTemplate &&
+		loadedInterface->UnregisterSkeletonTemplate && loadedInterface->ProviderSetAnimationStructureFromTemplate &&
+		loadedInterface->ProviderSetAnimationTransformSpace &&
+		loadedInterface->ProviderSetRotationOrder &&
+		loadedInterface->ProviderSetValidation &&
+		loadedInterface->ProviderGetValidationStats &&
+		loadedInterface->ProviderSetFilter &&
+		loadedInterface->ProviderSetResampling &&
+		loadedInterface->ProviderSetExtrapolation &&
+		loadedInterface->ProviderGetExtrapolationStats &&
+		loadedInterface->ProviderUpdateTransformFrameMatrix &&
+		loadedInterface->ProviderUpdateAnimationFrameMatrices &&
+		loadedInterface->ProviderUpdateCameraFrameMatrix &&
+		loadedInterface->ProviderUpdateLightFrameMatrix &&
+		loadedInterface->ProviderSetBasicStructurePacked && loadedInterface->ProviderUpdateBasicFramePacked &&
+		loadedInterface->ProviderSetAnimationStructurePacked && loadedInterface->ProviderUpdateAnimationFramePacked &&
+		loadedInterface->ProviderGetSkeletonSetupStats &&
+		loadedInterface->ProviderSetTransformStructure && loadedInterface->ProviderUpdateTransformFrame &&
+		loadedInterface->ProviderSetCameraStructure && loadedInterface->ProviderUpdateCameraFrame &&
+		loadedInterface->ProviderSetLightStructure && loadedInterface->ProviderUpdateLightFrame;
+}
+
+int UnrealLiveLink_Load(const char *cInterfaceSharedObjectFilename)
+{
+	const struct UnrealLiveLink_Interface *(*GetInterface)(int);
+	const struct UnrealLiveLink_Interface *exportedInterface;
+	struct UnrealLiveLink_Interface loadedInterface;
+
+	UnrealLiveLink_SharedObject = NULL;
+
+#ifdef WIN32
+	HMODULE mod = LoadLibrary(cInterfaceSharedObjectFilename);
+	if (!mod)
+	{
+		DWORD error = GetLastError();
+		printf("UnrealLiveLink_Load: unable to load library (error %ld)\n", error);
+		return UNREAL_LIVE_LINK_MISSING_LIB;
+	}
+#else
+	void * mod = dlopen(cInterfaceSharedObjectFilename, RTLD_LAZY);
+	if (!mod)
+	{
+		printf("UnrealLiveLink_Load: unable to load library. Error %s\n", dlerror());
+		return UNREAL_LIVE_LINK_MISSING_LIB;
+	}
+#endif
+
+	/* nothing is published until the shared object passes every check, a failed load leaves all functions null */
+	memset(&loadedInterface, 0, sizeof(loadedInterface));
+
+	/* one lookup for the whole table rather than one per function */
+	*(FUNC_ADDR_TYPE *) &GetInterface = GET_FUNC_ADDR(mod, "UnrealLiveLink_GetInterface");
+	if (GetInterface)
+	{
+		/* check API version, any shared object with the table has the prefix known here */
+		exportedInterface = (*GetInterface)(UNREAL_LIVE_LINK_API_VERSION);
+		if (!exportedInterface || exportedInterface->version < UNREAL_LIVE_LINK_INTERFACE_API_VERSION || exportedInterface->size <= 0)
+		{
+			FREE_LIB(mod);
+			return UNREAL_LIVE_LINK_WRONG_VERSION;
+		}
+
+		/* functions newer than the shared object stay null */
+		memcpy(&loadedInterface, exportedInterface,
+			(size_t)exportedInterface->size < sizeof(loadedInterface) ? (size_t)exportedInterface->size : sizeof(loadedInterface));
+
+		if (!UnrealLiveLink_HasBaseFunctions(&loadedInterface) || !UnrealLiveLink_HasInterfaceFunctions(&loadedInterface))
+		{
+			FREE_LIB(mod);
+			return UNREAL_LIVE_LINK_INCOMPLETE;
+		}
+	}
+	else
+	{
+		/* older shared object, its features are not reported so the capabilities stay 0 */
+		UnrealLiveLink_GetFunctions(mod, &loadedInterface);
+		if (!UnrealLiveLink_HasBaseFunctions(&loadedInterface))
+		{
+#ifdef __linux__
+			printf("UnrealLiveLink_Load: unable to load function. Error %s\n", dlerror());
+#endif
+			FREE_LIB(mod);
+			return UNREAL_LIVE_LINK_INCOMPLETE;
+		}
+
+		/* check API version */
+		loadedInterface.version = (*loadedInterface.GetVersion)();
+		if (loadedInterface.version < UNREAL_LIVE_LINK_MIN_API_VERSION)
+		{
+			FREE_LIB(mod);
+			return UNREAL_LIVE_LINK_WRONG_VERSION;
+		}
+		loadedInterface.size = (int)sizeof(loadedInterface);
+	}
+
+	loadedInterface.Initialize();
+
+	UnrealLiveLink_LoadedInterface = loadedInterface;
+	UnrealLiveLink_SetFunctions(&UnrealLiveLink_LoadedInterface);
+	UnrealLiveLink_SharedObject = mod;
+
+	return UNREAL_LIVE_LINK_OK;
+}
+
+void UnrealLiveLink_Unload(void)
+{
+	if (UnrealLiveLink_StopLiveLink)
+	{
+		UnrealLiveLink_StopLiveLink();
+	}
+
+	if (UnrealLiveLink_Shutdown)
+	{
+		UnrealLiveLink_Shutdown();
+	}
+
+	/* clear the functions before the library goes so none point into it */
+	memset(&UnrealLiveLink_LoadedInterface, 0, sizeof(UnrealLiveLink_LoadedInterface));
+	UnrealLiveLink_SetFunctions(&UnrealLiveLink_LoadedInterface);
+
+	if (UnrealLiveLink_SharedObject)
+	{
+		FREE_LIB(UnrealLiveLink_SharedObject);
+		UnrealLiveLink_SharedObject = NULL;
+	}
+}
+
+int UnrealLiveLink_IsLoaded(void)
+{
+	return UnrealLiveLink_SharedObject ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_NOT_LOADED;
+}
+
+unsigned int UnrealLiveLink_GetCapabilities(void)
+{
+	return UnrealLiveLink_SharedObject ? UnrealLiveLink_LoadedInterface.capabilities : 0;
+}
+
+void UnrealLiveLink_InitMetadata(struct UnrealLiveLink_Metadata *metadata)
+{
+	metadata->keyValueCount = 0;
+	metadata->keyValues = 0;
+
+	metadata->timecode.hours = 0;
+	metadata->timecode.minutes = 0;
+	metadata->timecode.seconds = 0;
+	metadata->timecode.frames = 0;
+	metadata->timecode.format = UNREAL_LIVE_LINK_TIMECODE_UNKNOWN;
+}
+
+void UnrealLiveLink_InitTransform(struct UnrealLiveLink_Transform * transform)
+{
+	int i;
+	for (i = 0; i < 4; i++)
+	{
+		transform->rotation[i] = 0.0f;
+	}
+	for (i = 0; i < 3; i++)
+	{
+		transform->translation[i] = 0.0f;
+		transform->scale[i] = 1.0f;
+	}
+}
+
+void UnrealLiveLink_InitCameraStatic(struct UnrealLiveLink_CameraStatic *structure)
+{
+	structure->isFieldOfViewSupported = 0;
+	structure->isAspectRatioSupported = 0;
+	structure->isFocalLengthSupported = 0;
+	structure->isProjectionModeSupported = 0;
+	structure->filmBackWidth = -1.0f;
+	structure->filmBackHeight = -1.0f;
+	structure->isApertureSupported = 0;
+	structure->isFocusDistanceSupported = 0;
+}
+
+void UnrealLiveLink_InitCamera(struct UnrealLiveLink_Camera *structure)
+{
+	UnrealLiveLink_InitTransform(&(structure->transform));
+
+	structure->fieldOfView = 90.f;
+	structure->aspectRatio = 1.777778f;
+	structure->focalLength = 50.f;
+	structure->aperture = 2.8f;
+	structure->focusDistance = 100000.0f;
+	structure->isPerspective = 1;
+}
+
+void UnrealLiveLink_InitLightStatic(struct UnrealLiveLink_LightStatic *structure)
+{
+	structure->isTemperatureSupported = 0;
+	structure->isIntensitySupported = 0;
+	structure->isLightColorSupported = 0;
+	structure->isInnerConeAngleSupported = 0;
+	structure->isOuterConeAngleSupported = 0;
+	structure->isAttenuationRadiusSupported = 0;
+	structure->isSourceLengthSupported = 0;
+	structure->isSourceRadiusSupported = 0;
+	structure->isSoftSourceRadiusSupported = 0;
+}
+
+void UnrealLiveLink_InitLight(struct UnrealLiveLink_Light *structure)
+{
+	int i;
+
+	UnrealLiveLink_InitTransform(&(structure->transform));
+
+	structure->temperature = 6500.0f;
+	structure->intensity = 3.1415926535897932f;
+
+	structure->innerConeAngle = 0.0f;
+	structure->outerConeAngle = 44.0f;
+	structure->attenuationRadius = 1000.0f;
+	structure->sourceRadius = 0.0f;
+	structure->softSourceRadius = 0.0f;
+	structure->sourceLength = 0.0f;
+
+	/* default white */
+	for (i = 0; i < 3; i++)
+	{
+		structure->lightColor[i] = 255;
+	}
+}
+
+void UnrealLiveLink_CopyName(const char *src, UnrealLiveLink_Name dst)
+{
+	strncpy(dst, src, UNREAL_LIVE_LINK_MAX_NAME_LENGTH); 
+	dst[UNREAL_LIVE_LINK_MAX_NAME_LENGTH - 1] = '\0';
+}
+
+int UnrealLiveLink_AllocPropertyValues(struct UnrealLiveLink_PropertyValues *propValues, int count)
+{
+	char *block;
+	char *aligned;
+	size_t size;
+
+	propValues->values = NULL;
+	propValues->valueCount = 0;
+
+	if (count <= 0)
+	{
+		return UNREAL_LIVE_LINK_OK;
+	}
+
+	/* C89 has no aligned allocation, over allocate and keep the block pointer in front of the aligned values */
+	size = (size_t)count * sizeof(float);
+	block = (char *)malloc(size + UNREAL_LIVE_LINK_BUFFER_ALIGNMENT + sizeof(void *));
+	if (!block)
+	{
+		return UNREAL_LIVE_LINK_FAILED;
+	}
+
+	aligned = block + sizeof(void *);
+	aligned += (UNREAL_LIVE_LINK_BUFFER_ALIGNMENT - ((size_t)aligned % UNREAL_LIVE_LINK_BUFFER_ALIGNMENT)) % UNREAL_LIVE_LINK_BUFFER_ALIGNMENT;
+	((void **)aligned)[-1] = block;
+
+	memset(aligned, 0, size);
+
+	propValues->values = (float *)aligned;
+	propValues->valueCount = count;
+
+	return UNREAL_LIVE_LINK_OK;
+}
+
+void UnrealLiveLink_FreePropertyValues(struct UnrealLiveLink_PropertyValues *propValues)
+{
+	if (propValues->values)
+	{
+		free(((void **)propValues->values)[-1]);
+	}
+
+	propValues->values = NULL;
+	propValues->valueCount = 0;
+}
+
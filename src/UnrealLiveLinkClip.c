@@ -0,0 +1,915 @@
+/** 
+ * Copyright (c) 2020 Patrick Palmer, The Jim Henson Company.
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <float.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "UnrealLiveLinkClip.h"
+
+/**
+ * Layout, little-endian
+ *
+ *   header        magic "ULLC", version, boneCount, frameCount (uint32), frameRate (float64),
+ *                 blockFrames (uint32), translationPrecision, scalePrecision (float32)
+ *   block table   blockCount + 1 uint32 offsets from the start of the clip, the last is the end of the clip
+ *   blocks        for every bone, its CLIP_TRACK_COUNT tracks as a bit stream (least significant bit first)
+ *
+ * a track of a block is
+ *   ue(keyCount - 1)
+ *   ue(gap - 1) for each key after the first, the first key is the block's first frame and the last its last
+ *   ue(zigzag(first key value))
+ *   5 bit Rice parameter and rice(zigzag(delta)) for each key after the first
+ * ue is an Elias gamma code of value + 1, rice a Rice code escaping to ue for long quotients
+ */
+
+#define CLIP_MAGIC			0x434c4c55UL
+#define CLIP_HEADER_SIZE		36
+#define CLIP_TRACK_COUNT		10
+#define CLIP_ROTATION_SCALE		32767.0
+#define CLIP_MAX_QUANTIZED		0x1fffffffL
+#define CLIP_RICE_ESCAPE		24
+#define CLIP_MAX_RICE_PARAMETER		24
+#define CLIP_MAX_BLOCK_FRAMES		4096
+/* largest quantization step that keeps every decoded value a finite float */
+#define CLIP_MAX_PRECISION		(FLT_MAX / CLIP_MAX_QUANTIZED)
+
+/* byte buffer with a bit accumulator */
+struct ClipWriter
+{
+	unsigned char *data;
+	size_t size;
+	size_t capacity;
+	uint64_t bits;
+	int bitCount;
+	int failed;
+};
+
+struct ClipReader
+{
+	const unsigned char *data;
+	size_t size;
+	size_t pos;
+	uint64_t bits;
+	int bitCount;
+	int failed;
+};
+
+struct UnrealLiveLink_ClipDecoder
+{
+	const unsigned char *data;
+	size_t size;
+	struct UnrealLiveLink_ClipInfo info;
+	double translationPrecision;
+	double scalePrecision;
+	int blockCount;
+
+	/* the frames of the last decoded block, blockFrames x boneCount transforms */
+	int block;
+	struct UnrealLiveLink_Transform *frames;
+
+	/* one block of one track, keys and the dense values they expand to */
+	int *keyFrames;
+	int32_t *keyValues;
+	float *values;
+};
+
+
+static void WriteByte(struct ClipWriter *writer, unsigned char value)
+{
+	unsigned char *data;
+	size_t capacity;
+
+	if (writer->failed)
+	{
+		return;
+	}
+
+	if (writer->size == writer->capacity)
+	{
+		capacity = writer->capacity ? writer->capacity * 2 : 4096;
+		data = (unsigned char *)realloc(writer->data, capacity);
+		if (!data)
+		{
+			writer->failed = 1;
+			return;
+		}
+		writer->data = data;
+		writer->capacity = capacity;
+	}
+
+	writer->data[writer->size++] = value;
+}
+
+static void WriteUInt32(struct ClipWriter *writer, uint32_t value)
+{
+	int i;
+	for (i = 0; i < 4; i++)
+	{
+		WriteByte(writer, (unsigned char)(value >> (i * 8)));
+	}
+}
+
+static void SetUInt32(unsigned char *data, uint32_t value)
+{
+	int i;
+	for (i = 0; i < 4; i++)
+	{
+		data[i] = (unsigned char)(value >> (i * 8));
+	}
+}
+
+static uint32_t GetUInt32(const unsigned char *data)
+{
+	return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+static uint64_t GetUInt64(const unsigned char *data)
+{
+	return (uint64_t)GetUInt32(data) | ((uint64_t)GetUInt32(data + 4) << 32);
+}
+
+/* count is at most 32 */
+static void WriteBits(struct ClipWriter *writer, uint32_t value, int count)
+{
+	if (count < 32)
+	{
+		value &= ((uint32_t)1 << count) - 1;
+	}
+
+	writer->bits |= (uint64_t)value << writer->bitCount;
+	writer->bitCount += count;
+	while (writer->bitCount >= 8)
+	{
+		WriteByte(writer, (unsigned char)writer->bits);
+		writer->bits >>= 8;
+		writer->bitCount -= 8;
+	}
+}
+
+static void FlushBits(struct ClipWriter *writer)
+{
+	if (writer->bitCount > 0)
+	{
+		WriteByte(writer, (unsigned char)writer->bits);
+	}
+	writer->bits = 0;
+	writer->bitCount = 0;
+}
+
+static void WriteOnes(struct ClipWriter *writer, uint32_t count)
+{
+	while (count >= 32)
+	{
+		WriteBits(writer, 0xffffffffUL, 32);
+		count -= 32;
+	}
+	WriteBits(writer, 0xffffffffUL, (int)count);
+}
+
+static int BitLength(uint32_t value)
+{
+	int length = 0;
+	while (value)
+	{
+		length++;
+		value >>= 1;
+	}
+	return length;
+}
+
+static void WriteGamma(struct ClipWriter *writer, uint32_t value)
+{
+	/* value + 1 as its length - 1 in unary and the bits below its top bit, values are below 2^31 */
+	const uint32_t coded = value + 1;
+	const int length = BitLength(coded) - 1;
+
+	WriteOnes(writer, (uint32_t)length);
+	WriteBits(writer, 0, 1);
+	WriteBits(writer, coded, length);
+}
+
+static int GammaBits(uint32_t value)
+{
+	return 2 * BitLength(value + 1) - 1;
+}
+
+static void WriteRice(struct ClipWriter *writer, uint32_t value, int parameter)
+{
+	const uint32_t quotient = value >> parameter;
+
+	if (quotient >= CLIP_RICE_ESCAPE)
+	{
+		WriteOnes(writer, CLIP_RICE_ESCAPE);
+		WriteGamma(writer, value);
+		return;
+	}
+
+	WriteOnes(writer, quotient);
+	WriteBits(writer, 0, 1);
+	WriteBits(writer, value, parameter);
+}
+
+static int RiceBits(uint32_t value, int parameter)
+{
+	const uint32_t quotient = value >> parameter;
+	return quotient >= CLIP_RICE_ESCAPE ? CLIP_RICE_ESCAPE + GammaBits(value) : (int)quotient + 1 + parameter;
+}
+
+static void Refill(struct ClipReader *reader)
+{
+	while (reader->bitCount <= 56 && reader->pos < reader->size)
+	{
+		reader->bits |= (uint64_t)reader->data[reader->pos++] << reader->bitCount;
+		reader->bitCount += 8;
+	}
+}
+
+/* count is at most 32, reading past the end sets failed and returns 0 */
+static uint32_t ReadBits(struct ClipReader *reader, int count)
+{
+	uint32_t value;
+
+	if (count == 0)
+	{
+		return 0;
+	}
+
+	if (reader->bitCount < count)
+	{
+		Refill(reader);
+		if (reader->bitCount < count)
+		{
+			reader->failed = 1;
+			return 0;
+		}
+	}
+
+	value = (uint32_t)(reader->bits & ((((uint64_t)1) << count) - 1));
+	reader->bits >>= count;
+	reader->bitCount -= count;
+	return value;
+}
+
+static uint32_t ReadOnes(struct ClipReader *reader, uint32_t limit)
+{
+	uint32_t count = 0;
+	while (count < limit && ReadBits(reader, 1))
+	{
+		count++;
+	}
+	return count;
+}
+
+static uint32_t ReadGamma(struct ClipReader *reader)
+{
+	/* the zero ending the length is read with it, 32 ones can't be a length */
+	const int length = (int)ReadOnes(reader, 32);
+
+	if (reader->failed || length > 31)
+	{
+		reader->failed = 1;
+		return 0;
+	}
+
+	return ((((uint32_t)1) << length) | ReadBits(reader, length)) - 1;
+}
+
+static uint32_t ReadRice(struct ClipReader *reader, int parameter)
+{
+	const uint32_t quotient = ReadOnes(reader, CLIP_RICE_ESCAPE);
+
+	if (quotient == CLIP_RICE_ESCAPE)
+	{
+		return ReadGamma(reader);
+	}
+
+	return (quotient << parameter) | ReadBits(reader, parameter);
+}
+
+static uint32_t ZigZag(int32_t value)
+{
+	return value < 0 ? ((uint32_t)(-(value + 1)) << 1) | 1 : (uint32_t)value << 1;
+}
+
+static int32_t UnZigZag(uint32_t value)
+{
+	return (value & 1) ? -(int32_t)(value >> 1) - 1 : (int32_t)(value >> 1);
+}
+
+static int32_t Quantize(double value, double step)
+{
+	double scaled = value / step;
+
+	if (!(scaled == scaled))
+	{
+		return 0;
+	}
+	if (scaled > CLIP_MAX_QUANTIZED)
+	{
+		return CLIP_MAX_QUANTIZED;
+	}
+	if (scaled < -CLIP_MAX_QUANTIZED)
+	{
+		return -CLIP_MAX_QUANTIZED;
+	}
+	return (int32_t)floor(scaled + 0.5);
+}
+
+/* value of the segment from key (Start, StartValue) to (End, EndValue) at Frame, the encoder checks its keys with the same sum */
+static double InterpolateKeys(int start, int32_t startValue, int end, int32_t endValue, int frame)
+{
+	return startValue + ((double)endValue - startValue) * (frame - start) / (end - start);
+}
+
+/**
+ * choose the keys of Count quantized values so linear interpolation between them is within Tolerance steps
+ * greedy, each key is placed as far after the previous one as the tolerance allows
+ * @return number of keys written to KeyFrames
+ */
+static int ReduceKeys(const int32_t *values, int count, double tolerance, int *keyFrames)
+{
+	int keyCount = 0;
+	int start = 0;
+	int end;
+	int frame;
+	int fits;
+
+	keyFrames[keyCount++] = 0;
+	while (start < count - 1)
+	{
+		end = start + 1;
+		while (end + 1 < count)
+		{
+			fits = 1;
+			for (frame = start + 1; frame <= end && fits; frame++)
+			{
+				fits = fabs(InterpolateKeys(start, values[start], end + 1, values[end + 1], frame) - values[frame]) <= tolerance;
+			}
+			if (!fits)
+			{
+				break;
+			}
+			end++;
+		}
+
+		keyFrames[keyCount++] = end;
+		start = end;
+	}
+
+	return keyCount;
+}
+
+static int ChooseRiceParameter(const int32_t *keyValues, int keyCount)
+{
+	int best = 0;
+	long bestBits = -1;
+	long bits;
+	int parameter;
+	int key;
+
+	for (parameter = 0; parameter <= CLIP_MAX_RICE_PARAMETER; parameter++)
+	{
+		bits = 0;
+		for (key = 1; key < keyCount; key++)
+		{
+			bits += RiceBits(ZigZag(keyValues[key] - keyValues[key - 1]), parameter);
+		}
+		if (bestBits < 0 || bits < bestBits)
+		{
+			best = parameter;
+			bestBits = bits;
+		}
+	}
+
+	return best;
+}
+
+static void WriteTrack(struct ClipWriter *writer, const int32_t *values, int count, double tolerance, int *keyFrames, int32_t *keyValues)
+{
+	const int keyCount = ReduceKeys(values, count, tolerance, keyFrames);
+	int parameter;
+	int key;
+
+	for (key = 0; key < keyCount; key++)
+	{
+		keyValues[key] = values[keyFrames[key]];
+	}
+
+	WriteGamma(writer, (uint32_t)(keyCount - 1));
+	for (key = 1; key < keyCount; key++)
+	{
+		WriteGamma(writer, (uint32_t)(keyFrames[key] - keyFrames[key - 1] - 1));
+	}
+
+	WriteGamma(writer, ZigZag(keyValues[0]));
+	if (keyCount > 1)
+	{
+		parameter = ChooseRiceParameter(keyValues, keyCount);
+		WriteBits(writer, (uint32_t)parameter, 5);
+		for (key = 1; key < keyCount; key++)
+		{
+			WriteRice(writer, ZigZag(keyValues[key] - keyValues[key - 1]), parameter);
+		}
+	}
+}
+
+/* the quantized value of Track of a transform, Flip negates the rotation to keep it in the previous frame's hemisphere */
+static int32_t QuantizeTrack(const struct UnrealLiveLink_Transform *transform, int track, int flip, double translationPrecision, double scalePrecision)
+{
+	if (track < 4)
+	{
+		return Quantize(flip ? -transform->rotation[track] : transform->rotation[track], 1.0 / CLIP_ROTATION_SCALE);
+	}
+	if (track < 7)
+	{
+		return Quantize(transform->translation[track - 4], translationPrecision);
+	}
+	return Quantize(transform->scale[track - 7], scalePrecision);
+}
+
+/* frame rates and precisions are positive and finite, written as "not in range" so NaN fails too */
+static int IsClipScaleValid(double value, double maxValue)
+{
+	return value > 0.0 && value <= maxValue;
+}
+
+int UnrealLiveLink_EncodeClip(const struct UnrealLiveLink_Transform *transforms, int boneCount, int frameCount, double frameRate,
+	const struct UnrealLiveLink_ClipSettings *settings, unsigned char **data, size_t *size)
+{
+	struct UnrealLiveLink_ClipSettings clipSettings;
+	struct ClipWriter writer;
+	uint64_t frameRateBits;
+	uint32_t precisionBits;
+	float precision;
+	double tolerances[CLIP_TRACK_COUNT];
+	int blockCount;
+	size_t tableOffset;
+	int32_t *values = NULL;
+	int32_t *keyValues = NULL;
+	int *keyFrames = NULL;
+	unsigned char *flips = NULL;
+	const struct UnrealLiveLink_Transform *transform;
+	const struct UnrealLiveLink_Transform *previous;
+	int block;
+	int blockStart;
+	int blockLength;
+	int bone;
+	int track;
+	int frame;
+	int i;
+
+	*data = NULL;
+	*size = 0;
+
+	if (boneCount <= 0 || frameCount <= 0 || !transforms)
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	memset(&clipSettings, 0, sizeof(clipSettings));
+	if (settings)
+	{
+		clipSettings = *settings;
+	}
+	if (clipSettings.blockFrames <= 0)
+	{
+		clipSettings.blockFrames = UNREAL_LIVE_LINK_CLIP_DEFAULT_BLOCK_FRAMES;
+	}
+	if (clipSettings.blockFrames > CLIP_MAX_BLOCK_FRAMES)
+	{
+		clipSettings.blockFrames = CLIP_MAX_BLOCK_FRAMES;
+	}
+	if (clipSettings.blockFrames > frameCount)
+	{
+		clipSettings.blockFrames = frameCount;
+	}
+	if (clipSettings.translationPrecision <= 0.0f)
+	{
+		clipSettings.translationPrecision = UNREAL_LIVE_LINK_CLIP_DEFAULT_TRANSLATION_PRECISION;
+	}
+	if (clipSettings.scalePrecision <= 0.0f)
+	{
+		clipSettings.scalePrecision = UNREAL_LIVE_LINK_CLIP_DEFAULT_SCALE_PRECISION;
+	}
+
+	/* OpenClip rejects clips with any other header values */
+	if (!IsClipScaleValid(frameRate, DBL_MAX) || !IsClipScaleValid(clipSettings.translationPrecision, CLIP_MAX_PRECISION) ||
+		!IsClipScaleValid(clipSettings.scalePrecision, CLIP_MAX_PRECISION))
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	/* tolerances in quantization steps */
+	for (track = 0; track < CLIP_TRACK_COUNT; track++)
+	{
+		tolerances[track] = track < 4 ? clipSettings.rotationTolerance * CLIP_ROTATION_SCALE :
+			track < 7 ? clipSettings.translationTolerance / clipSettings.translationPrecision :
+			clipSettings.scaleTolerance / clipSettings.scalePrecision;
+		if (!(tolerances[track] > 0.0))
+		{
+			tolerances[track] = 0.0;
+		}
+	}
+
+	blockCount = (frameCount + clipSettings.blockFrames - 1) / clipSettings.blockFrames;
+
+	values = (int32_t *)malloc((size_t)clipSettings.blockFrames * sizeof(int32_t));
+	keyValues = (int32_t *)malloc((size_t)clipSettings.blockFrames * sizeof(int32_t));
+	keyFrames = (int *)malloc((size_t)clipSettings.blockFrames * sizeof(int));
+	flips = (unsigned char *)malloc((size_t)frameCount);
+	memset(&writer, 0, sizeof(writer));
+
+	if (!values || !keyValues || !keyFrames || !flips)
+	{
+		writer.failed = 1;
+	}
+
+	WriteUInt32(&writer, CLIP_MAGIC);
+	WriteUInt32(&writer, UNREAL_LIVE_LINK_CLIP_VERSION);
+	WriteUInt32(&writer, (uint32_t)boneCount);
+	WriteUInt32(&writer, (uint32_t)frameCount);
+	memcpy(&frameRateBits, &frameRate, sizeof(frameRateBits));
+	WriteUInt32(&writer, (uint32_t)frameRateBits);
+	WriteUInt32(&writer, (uint32_t)(frameRateBits >> 32));
+	WriteUInt32(&writer, (uint32_t)clipSettings.blockFrames);
+	precision = clipSettings.translationPrecision;
+	memcpy(&precisionBits, &precision, sizeof(precisionBits));
+	WriteUInt32(&writer, precisionBits);
+	precision = clipSettings.scalePrecision;
+	memcpy(&precisionBits, &precision, sizeof(precisionBits));
+	WriteUInt32(&writer, precisionBits);
+
+	/* block table, filled in as the blocks are written */
+	tableOffset = writer.size;
+	for (i = 0; i <= blockCount; i++)
+	{
+		WriteUInt32(&writer, 0);
+	}
+
+	for (block = 0; block < blockCount && !writer.failed; block++)
+	{
+		blockStart = block * clipSettings.blockFrames;
+		blockLength = frameCount - blockStart < clipSettings.blockFrames ? frameCount - blockStart : clipSettings.blockFrames;
+
+		SetUInt32(writer.data + tableOffset + (size_t)block * 4, (uint32_t)writer.size);
+
+		for (bone = 0; bone < boneCount; bone++)
+		{
+			/* q and -q are the same rotation, keep each frame's quaternion next to the previous frame's so the tracks stay smooth */
+			flips[0] = 0;
+			for (frame = 1; frame < blockLength; frame++)
+			{
+				transform = transforms + (size_t)(blockStart + frame) * boneCount + bone;
+				previous = transforms + (size_t)(blockStart + frame - 1) * boneCount + bone;
+				flips[frame] = (unsigned char)(flips[frame - 1] ^ (transform->rotation[0] * previous->rotation[0] + transform->rotation[1] * previous->rotation[1] +
+					transform->rotation[2] * previous->rotation[2] + transform->rotation[3] * previous->rotation[3] < 0.0f));
+			}
+
+			for (track = 0; track < CLIP_TRACK_COUNT; track++)
+			{
+				for (frame = 0; frame < blockLength; frame++)
+				{
+					values[frame] = QuantizeTrack(transforms + (size_t)(blockStart + frame) * boneCount + bone, track, flips[frame],
+						clipSettings.translationPrecision, clipSettings.scalePrecision);
+				}
+				WriteTrack(&writer, values, blockLength, tolerances[track], keyFrames, keyValues);
+			}
+		}
+
+		FlushBits(&writer);
+	}
+
+	if (!writer.failed)
+	{
+		SetUInt32(writer.data + tableOffset + (size_t)blockCount * 4, (uint32_t)writer.size);
+	}
+
+	free(values);
+	free(keyValues);
+	free(keyFrames);
+	free(flips);
+
+	if (writer.failed)
+	{
+		free(writer.data);
+		return UNREAL_LIVE_LINK_FAILED;
+	}
+
+	*data = writer.data;
+	*size = writer.size;
+	return UNREAL_LIVE_LINK_OK;
+}
+
+void UnrealLiveLink_FreeClip(unsigned char *data)
+{
+	free(data);
+}
+
+int UnrealLiveLink_OpenClip(const unsigned char *data, size_t size, struct UnrealLiveLink_ClipDecoder **decoder)
+{
+	struct UnrealLiveLink_ClipDecoder *clip;
+	uint64_t frameRateBits;
+	uint32_t precisionBits;
+	double frameRate;
+	float translationPrecision;
+	float scalePrecision;
+	uint32_t boneCount;
+	uint32_t frameCount;
+	uint32_t blockFrames;
+	uint32_t offset;
+	uint32_t previousOffset;
+	int blockCount;
+	int i;
+
+	*decoder = NULL;
+
+	if (!data || size < CLIP_HEADER_SIZE || GetUInt32(data) != CLIP_MAGIC || GetUInt32(data + 4) != UNREAL_LIVE_LINK_CLIP_VERSION)
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	boneCount = GetUInt32(data + 8);
+	frameCount = GetUInt32(data + 12);
+	blockFrames = GetUInt32(data + 24);
+	if (boneCount == 0 || boneCount > 0x7fffffffUL || frameCount == 0 || frameCount > 0x7fffffffUL ||
+		blockFrames == 0 || blockFrames > frameCount || blockFrames > CLIP_MAX_BLOCK_FRAMES)
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	/* the block table has to fit and its offsets ascend within the clip, every track takes at least two bits of a block */
+	blockCount = (int)((frameCount + blockFrames - 1) / blockFrames);
+	if ((size - CLIP_HEADER_SIZE) / 4 < (size_t)blockCount + 1)
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+	previousOffset = (uint32_t)(CLIP_HEADER_SIZE + ((size_t)blockCount + 1) * 4);
+	for (i = 0; i <= blockCount; i++)
+	{
+		offset = GetUInt32(data + CLIP_HEADER_SIZE + (size_t)i * 4);
+		if (offset < previousOffset || offset > size ||
+			(i > 0 && (uint64_t)(offset - previousOffset) * 8 < (uint64_t)boneCount * CLIP_TRACK_COUNT * 2))
+		{
+			return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+		}
+		previousOffset = offset;
+	}
+
+	/* a non-finite or non-positive step would decode to non-finite transforms */
+	frameRateBits = GetUInt64(data + 16);
+	memcpy(&frameRate, &frameRateBits, sizeof(frameRateBits));
+	precisionBits = GetUInt32(data + 28);
+	memcpy(&translationPrecision, &precisionBits, sizeof(translationPrecision));
+	precisionBits = GetUInt32(data + 32);
+	memcpy(&scalePrecision, &precisionBits, sizeof(scalePrecision));
+	if (!IsClipScaleValid(frameRate, DBL_MAX) || !IsClipScaleValid(translationPrecision, CLIP_MAX_PRECISION) ||
+		!IsClipScaleValid(scalePrecision, CLIP_MAX_PRECISION))
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	clip = (struct UnrealLiveLink_ClipDecoder *)calloc(1, sizeof(struct UnrealLiveLink_ClipDecoder));
+	if (!clip)
+	{
+		return UNREAL_LIVE_LINK_FAILED;
+	}
+
+	clip->data = data;
+	clip->size = size;
+	clip->info.boneCount = (int)boneCount;
+	clip->info.frameCount = (int)frameCount;
+	clip->info.frameRate = frameRate;
+	clip->info.blockFrames = (int)blockFrames;
+	clip->translationPrecision = translationPrecision;
+	clip->scalePrecision = scalePrecision;
+	clip->blockCount = blockCount;
+	clip->block = -1;
+
+	clip->frames = (struct UnrealLiveLink_Transform *)malloc((size_t)blockFrames * boneCount * sizeof(struct UnrealLiveLink_Transform));
+	clip->keyFrames = (int *)malloc((size_t)blockFrames * sizeof(int));
+	clip->keyValues = (int32_t *)malloc((size_t)blockFrames * sizeof(int32_t));
+	clip->values = (float *)malloc((size_t)blockFrames * sizeof(float));
+	if (!clip->frames || !clip->keyFrames || !clip->keyValues || !clip->values)
+	{
+		UnrealLiveLink_CloseClip(clip);
+		return UNREAL_LIVE_LINK_FAILED;
+	}
+
+	*decoder = clip;
+	return UNREAL_LIVE_LINK_OK;
+}
+
+void UnrealLiveLink_CloseClip(struct UnrealLiveLink_ClipDecoder *decoder)
+{
+	if (!decoder)
+	{
+		return;
+	}
+
+	free(decoder->frames);
+	free(decoder->keyFrames);
+	free(decoder->keyValues);
+	free(decoder->values);
+	free(decoder);
+}
+
+int UnrealLiveLink_GetClipInfo(const struct UnrealLiveLink_ClipDecoder *decoder, struct UnrealLiveLink_ClipInfo *info)
+{
+	*info = decoder->info;
+	return UNREAL_LIVE_LINK_OK;
+}
+
+/* read one track of a block and expand its keys to Count values, scaled by Step */
+static int ReadTrack(struct UnrealLiveLink_ClipDecoder *decoder, struct ClipReader *reader, int count, double step)
+{
+	int *keyFrames = decoder->keyFrames;
+	int32_t *keyValues = decoder->keyValues;
+	int64_t keyValue;
+	uint32_t keyCount;
+	uint32_t gap;
+	int parameter;
+	int key;
+	int frame;
+
+	keyCount = ReadGamma(reader) + 1;
+	if (reader->failed || keyCount > (uint32_t)count || (keyCount == 1 && count > 1))
+	{
+		return 0;
+	}
+
+	keyFrames[0] = 0;
+	for (key = 1; key < (int)keyCount; key++)
+	{
+		gap = ReadGamma(reader);
+		if (reader->failed || gap >= (uint32_t)(count - 1 - keyFrames[key - 1]))
+		{
+			return 0;
+		}
+		keyFrames[key] = keyFrames[key - 1] + (int)gap + 1;
+	}
+	if (keyFrames[keyCount - 1] != count - 1)
+	{
+		return 0;
+	}
+
+	/* the encoder never writes values past CLIP_MAX_QUANTIZED, summed in 64 bits so corrupt deltas can't overflow */
+	keyValue = UnZigZag(ReadGamma(reader));
+	if (keyValue > CLIP_MAX_QUANTIZED || keyValue < -CLIP_MAX_QUANTIZED)
+	{
+		return 0;
+	}
+	keyValues[0] = (int32_t)keyValue;
+	if (keyCount > 1)
+	{
+		parameter = (int)ReadBits(reader, 5);
+		if (parameter > CLIP_MAX_RICE_PARAMETER)
+		{
+			return 0;
+		}
+		for (key = 1; key < (int)keyCount; key++)
+		{
+			keyValue = (int64_t)keyValues[key - 1] + UnZigZag(ReadRice(reader, parameter));
+			if (keyValue > CLIP_MAX_QUANTIZED || keyValue < -CLIP_MAX_QUANTIZED)
+			{
+				return 0;
+			}
+			keyValues[key] = (int32_t)keyValue;
+		}
+	}
+	if (reader->failed)
+	{
+		return 0;
+	}
+
+	decoder->values[0] = (float)(keyValues[0] * step);
+	for (key = 1; key < (int)keyCount; key++)
+	{
+		for (frame = keyFrames[key - 1] + 1; frame <= keyFrames[key]; frame++)
+		{
+			decoder->values[frame] = (float)(InterpolateKeys(keyFrames[key - 1], keyValues[key - 1], keyFrames[key], keyValues[key], frame) * step);
+		}
+	}
+
+	return 1;
+}
+
+static int DecodeBlock(struct UnrealLiveLink_ClipDecoder *decoder, int block)
+{
+	const int boneCount = decoder->info.boneCount;
+	const int blockStart = block * decoder->info.blockFrames;
+	const int count = decoder->info.frameCount - blockStart < decoder->info.blockFrames ? decoder->info.frameCount - blockStart : decoder->info.blockFrames;
+	struct ClipReader reader;
+	struct UnrealLiveLink_Transform *transform;
+	double length;
+	int bone;
+	int track;
+	int frame;
+
+	memset(&reader, 0, sizeof(reader));
+	reader.data = decoder->data + GetUInt32(decoder->data + CLIP_HEADER_SIZE + (size_t)block * 4);
+	reader.size = GetUInt32(decoder->data + CLIP_HEADER_SIZE + (size_t)(block + 1) * 4) - GetUInt32(decoder->data + CLIP_HEADER_SIZE + (size_t)block * 4);
+
+	/* a failed block is not kept */
+	decoder->block = -1;
+
+	for (bone = 0; bone < boneCount; bone++)
+	{
+		for (track = 0; track < CLIP_TRACK_COUNT; track++)
+		{
+			if (!ReadTrack(decoder, &reader, count,
+				track < 4 ? 1.0 / CLIP_ROTATION_SCALE : track < 7 ? decoder->translationPrecision : decoder->scalePrecision))
+			{
+				return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+			}
+
+			for (frame = 0; frame < count; frame++)
+			{
+				transform = decoder->frames + (size_t)frame * boneCount + bone;
+				if (track < 4)
+				{
+					transform->rotation[track] = decoder->values[frame];
+				}
+				else if (track < 7)
+				{
+					transform->translation[track - 4] = decoder->values[frame];
+				}
+				else
+				{
+					transform->scale[track - 7] = decoder->values[frame];
+				}
+			}
+		}
+
+		/* quantization and interpolation leave the rotations slightly off unit length */
+		for (frame = 0; frame < count; frame++)
+		{
+			transform = decoder->frames + (size_t)frame * boneCount + bone;
+			length = sqrt((double)transform->rotation[0] * transform->rotation[0] + (double)transform->rotation[1] * transform->rotation[1] +
+				(double)transform->rotation[2] * transform->rotation[2] + (double)transform->rotation[3] * transform->rotation[3]);
+			if (length > 0.0)
+			{
+				for (track = 0; track < 4; track++)
+				{
+					transform->rotation[track] = (float)(transform->rotation[track] / length);
+				}
+			}
+			else
+			{
+				transform->rotation[0] = transform->rotation[1] = transform->rotation[2] = 0.0f;
+				transform->rotation[3] = 1.0f;
+			}
+		}
+	}
+
+	decoder->block = block;
+	return UNREAL_LIVE_LINK_OK;
+}
+
+int UnrealLiveLink_DecodeClipFrame(struct UnrealLiveLink_ClipDecoder *decoder, int frame, struct UnrealLiveLink_Animation *animation)
+{
+	const int boneCount = decoder->info.boneCount;
+	int block;
+	int result;
+
+	if (frame < 0 || frame >= decoder->info.frameCount || animation->transformCount < boneCount)
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	block = frame / decoder->info.blockFrames;
+	if (block != decoder->block)
+	{
+		result = DecodeBlock(decoder, block);
+		if (result != UNREAL_LIVE_LINK_OK)
+		{
+			return result;
+		}
+	}
+
+	memcpy(animation->transforms, decoder->frames + (size_t)(frame - block * decoder->info.blockFrames) * boneCount,
+		(size_t)boneCount * sizeof(struct UnrealLiveLink_Transform));
+	return UNREAL_LIVE_LINK_OK;
+}
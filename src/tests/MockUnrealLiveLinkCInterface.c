@@ -0,0 +1,903 @@
+/** 
+ * Copyright (c) 2020 Patrick Palmer, The Jim Henson Company.
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Mock of the Unreal Live Link C Interface shared object for testing the client library without Unreal
+ *
+ * Exports UnrealLiveLink_GetInterface with every required function. Providers are slots in a table, frames are
+ * recorded per subject in a table of its own behind a read/write lock with a lock per subject. This is not the
+ * real shared object's FUnrealLiveLinkCInterfaceProvider, which needs Unreal, so tests using the mock don't
+ * check its sharding. A thread standing in for Unreal's message bus toggles the connection of started providers
+ * and invokes their callbacks. The optional functions are left out and no capabilities are reported.
+ */
+
+/* read/write locks and nanosleep */
+#define _POSIX_C_SOURCE 200809L
+
+#include "UnrealLiveLinkCInterfaceTypes.h"
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+#define MOCK_MAX_PROVIDERS 16
+#define MOCK_MAX_CALLBACKS 8
+#define MOCK_MAX_SUBJECTS 256
+
+/* period of the connection changes of the message bus thread */
+#define MOCK_CONNECTION_PERIOD_NS (2 * 1000000L)
+
+struct MockProvider
+{
+	int used;
+	int started;
+	int connected;
+	void (*callbacks[MOCK_MAX_CALLBACKS])();
+	int callbackCount;
+};
+
+struct MockSubject
+{
+	int used;
+	int provider;
+	UnrealLiveLink_Name name;
+
+	/* guards the frame record */
+	pthread_mutex_t lock;
+	long frameCount;
+	long outOfOrderCount;
+	double lastWorldTime;
+};
+
+/* guards the providers */
+static pthread_mutex_t MockProvidersLock = PTHREAD_MUTEX_INITIALIZER;
+static struct MockProvider MockProviders[MOCK_MAX_PROVIDERS];
+
+/* only written when a subject is added */
+static pthread_rwlock_t MockSubjectsLock = PTHREAD_RWLOCK_INITIALIZER;
+static struct MockSubject MockSubjects[MOCK_MAX_SUBJECTS];
+
+static pthread_mutex_t MockBusLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_t MockBusThread;
+static int MockBusRunning = 0;
+
+static int MockIsProvider(int provider)
+{
+	int used;
+
+	if (provider < 0 || provider >= MOCK_MAX_PROVIDERS)
+	{
+		return 0;
+	}
+
+	pthread_mutex_lock(&MockProvidersLock);
+	used = MockProviders[provider].used;
+	pthread_mutex_unlock(&MockProvidersLock);
+	return used;
+}
+
+static unsigned int MockHashName(int provider, const char *name)
+{
+	unsigned int hash = 2166136261u ^ (unsigned int)provider;
+
+	for (; *name; name++)
+	{
+		hash = (hash ^ (unsigned char)*name) * 16777619u;
+	}
+	return hash;
+}
+
+/* slot of the subject, open addressed so a slot never moves once used */
+static struct MockSubject *MockFindSubject(int provider, const char *name, int add)
+{
+	const unsigned int hash = MockHashName(provider, name);
+	struct MockSubject *subject;
+	int probe;
+
+	pthread_rwlock_rdlock(&MockSubjectsLock);
+	for (probe = 0; probe < MOCK_MAX_SUBJECTS; probe++)
+	{
+		subject = &MockSubjects[(hash + probe) % MOCK_MAX_SUBJECTS];
+		if (!subject->used)
+		{
+			break;
+		}
+		if (subject->provider == provider && strcmp(subject->name, name) == 0)
+		{
+			pthread_rwlock_unlock(&MockSubjectsLock);
+			return subject;
+		}
+	}
+	pthread_rwlock_unlock(&MockSubjectsLock);
+
+	if (!add || strlen(name) >= UNREAL_LIVE_LINK_MAX_NAME_LENGTH)
+	{
+		return NULL;
+	}
+
+	/* searched again as another thread may have added it in between */
+	pthread_rwlock_wrlock(&MockSubjectsLock);
+	for (probe = 0; probe < MOCK_MAX_SUBJECTS; probe++)
+	{
+		subject = &MockSubjects[(hash + probe) % MOCK_MAX_SUBJECTS];
+		if (!subject->used)
+		{
+			subject->used = 1;
+			subject->provider = provider;
+			strcpy(subject->name, name);
+			break;
+		}
+		if (subject->provider == provider && strcmp(subject->name, name) == 0)
+		{
+			break;
+		}
+	}
+	pthread_rwlock_unlock(&MockSubjectsLock);
+
+	return probe < MOCK_MAX_SUBJECTS ? subject : NULL;
+}
+
+/* count the frame, frames of a subject are expected in world time order as each subject is updated from one thread */
+static int MockRecordFrame(int provider, const char *subjectName, const double worldTime)
+{
+	struct MockSubject *subject;
+
+	if (!MockIsProvider(provider))
+	{
+		return UNREAL_LIVE_LINK_INVALID_PROVIDER;
+	}
+
+	subject = MockFindSubject(provider, subjectName, 1);
+	if (!subject)
+	{
+		return UNREAL_LIVE_LINK_FAILED;
+	}
+
+	pthread_mutex_lock(&subject->lock);
+	if (subject->frameCount > 0 && worldTime <= subject->lastWorldTime)
+	{
+		subject->outOfOrderCount++;
+	}
+	subject->lastWorldTime = worldTime;
+	subject->frameCount++;
+	pthread_mutex_unlock(&subject->lock);
+
+	return UNREAL_LIVE_LINK_OK;
+}
+
+/* stands in for Unreal's message bus, callbacks are invoked outside of the providers lock like the real ones */
+static void *MockRunBus(void *unused)
+{
+	void (*callbacks[MOCK_MAX_PROVIDERS * MOCK_MAX_CALLBACKS])();
+	struct timespec wait;
+	int callbackCount;
+	int running = 1;
+	int provider;
+	int idx;
+
+	(void)unused;
+	wait.tv_sec = 0;
+	wait.tv_nsec = MOCK_CONNECTION_PERIOD_NS;
+
+	while (running)
+	{
+		callbackCount = 0;
+		pthread_mutex_lock(&MockProvidersLock);
+		for (provider = 0; provider < MOCK_MAX_PROVIDERS; provider++)
+		{
+			if (MockProviders[provider].used && MockProviders[provider].started)
+			{
+				MockProviders[provider].connected = !MockProviders[provider].connected;
+				for (idx = 0; idx < MockProviders[provider].callbackCount; idx++)
+				{
+					callbacks[callbackCount++] = MockProviders[provider].callbacks[idx];
+				}
+			}
+		}
+		pthread_mutex_unlock(&MockProvidersLock);
+
+		for (idx = 0; idx < callbackCount; idx++)
+		{
+			callbacks[idx]();
+		}
+
+		nanosleep(&wait, NULL);
+
+		pthread_mutex_lock(&MockBusLock);
+		running = MockBusRunning;
+		pthread_mutex_unlock(&MockBusLock);
+	}
+
+	return NULL;
+}
+
+static void MockStart(void)
+{
+	int idx;
+
+	memset(MockProviders, 0, sizeof(MockProviders));
+	MockProviders[UNREAL_LIVE_LINK_DEFAULT_PROVIDER].used = 1;
+
+	memset(MockSubjects, 0, sizeof(MockSubjects));
+	for (idx = 0; idx < MOCK_MAX_SUBJECTS; idx++)
+	{
+		pthread_mutex_init(&MockSubjects[idx].lock, NULL);
+	}
+
+	MockBusRunning = 1;
+	pthread_create(&MockBusThread, NULL, &MockRunBus, NULL);
+}
+
+static void MockStop(void)
+{
+	int idx;
+
+	pthread_mutex_lock(&MockBusLock);
+	MockBusRunning = 0;
+	pthread_mutex_unlock(&MockBusLock);
+	pthread_join(MockBusThread, NULL);
+
+	for (idx = 0; idx < MOCK_MAX_SUBJECTS; idx++)
+	{
+		pthread_mutex_destroy(&MockSubjects[idx].lock);
+	}
+}
+
+static int Mock_CreateProvider(const char *providerName)
+{
+	int provider;
+
+	(void)providerName;
+	pthread_mutex_lock(&MockProvidersLock);
+	for (provider = UNREAL_LIVE_LINK_DEFAULT_PROVIDER + 1; provider < MOCK_MAX_PROVIDERS; provider++)
+	{
+		if (!MockProviders[provider].used)
+		{
+			memset(&MockProviders[provider], 0, sizeof(MockProviders[provider]));
+			MockProviders[provider].used = 1;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&MockProvidersLock);
+
+	return provider < MOCK_MAX_PROVIDERS ? provider : UNREAL_LIVE_LINK_NO_PROVIDER;
+}
+
+static int Mock_DestroyProvider(int provider)
+{
+	int result = UNREAL_LIVE_LINK_INVALID_PROVIDER;
+
+	pthread_mutex_lock(&MockProvidersLock);
+	if (provider > UNREAL_LIVE_LINK_DEFAULT_PROVIDER && provider < MOCK_MAX_PROVIDERS && MockProviders[provider].used)
+	{
+		MockProviders[provider].used = 0;
+		result = UNREAL_LIVE_LINK_OK;
+	}
+	pthread_mutex_unlock(&MockProvidersLock);
+
+	return result;
+}
+
+static int MockSetStarted(int provider, int started)
+{
+	int result = UNREAL_LIVE_LINK_INVALID_PROVIDER;
+
+	pthread_mutex_lock(&MockProvidersLock);
+	if (provider >= 0 && provider < MOCK_MAX_PROVIDERS && MockProviders[provider].used)
+	{
+		MockProviders[provider].started = started;
+		MockProviders[provider].connected = 0;
+		result = UNREAL_LIVE_LINK_OK;
+	}
+	pthread_mutex_unlock(&MockProvidersLock);
+
+	return result;
+}
+
+static int Mock_StartProvider(int provider)
+{
+	return MockSetStarted(provider, 1);
+}
+
+static int Mock_StopProvider(int provider)
+{
+	return MockSetStarted(provider, 0);
+}
+
+static int Mock_RegisterProviderConnectionUpdateCallback(int provider, void (*callback)())
+{
+	int result = UNREAL_LIVE_LINK_INVALID_PROVIDER;
+
+	pthread_mutex_lock(&MockProvidersLock);
+	if (provider >= 0 && provider < MOCK_MAX_PROVIDERS && MockProviders[provider].used)
+	{
+		result = UNREAL_LIVE_LINK_FAILED;
+		if (MockProviders[provider].callbackCount < MOCK_MAX_CALLBACKS)
+		{
+			MockProviders[provider].callbacks[MockProviders[provider].callbackCount++] = callback;
+			result = UNREAL_LIVE_LINK_OK;
+		}
+	}
+	pthread_mutex_unlock(&MockProvidersLock);
+
+	return result;
+}
+
+static int Mock_ProviderHasConnection(int provider)
+{
+	int result = UNREAL_LIVE_LINK_INVALID_PROVIDER;
+
+	pthread_mutex_lock(&MockProvidersLock);
+	if (provider >= 0 && provider < MOCK_MAX_PROVIDERS && MockProviders[provider].used)
+	{
+		result = MockProviders[provider].connected ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_NOT_CONNECTED;
+	}
+	pthread_mutex_unlock(&MockProvidersLock);
+
+	return result;
+}
+
+static int Mock_ProviderUpdateAnimationFrames(int provider, const struct UnrealLiveLink_AnimationSubjectFrame *frames,
+	int frameCount)
+{
+	int result = UNREAL_LIVE_LINK_OK;
+	int idx;
+
+	if (frameCount < 0 || (!frames && frameCount > 0))
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+
+	for (idx = 0; idx < frameCount; idx++)
+	{
+		if (!frames[idx].subjectName || !frames[idx].frame)
+		{
+			result = UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+		}
+		else if (MockRecordFrame(provider, frames[idx].subjectName, frames[idx].worldTime) != UNREAL_LIVE_LINK_OK)
+		{
+			result = UNREAL_LIVE_LINK_FAILED;
+		}
+	}
+	return result;
+}
+
+static void Mock_Initialize(void)
+{
+	MockStart();
+}
+
+static void Mock_Shutdown(void)
+{
+	MockStop();
+}
+
+static int Mock_GetVersion(void)
+{
+	return UNREAL_LIVE_LINK_API_VERSION;
+}
+
+static void Mock_SetProviderName(const char *providerName)
+{
+	(void)providerName;
+}
+
+static int Mock_StartLiveLink(void)
+{
+	return Mock_StartProvider(UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+}
+
+static int Mock_StopLiveLink(void)
+{
+	return Mock_StopProvider(UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+}
+
+static void Mock_SetUnicastEndpoint(const char* endpoint)
+{
+	(void)endpoint;
+}
+
+static int Mock_AddStaticEndpoint(const char* endpoint)
+{
+	(void)endpoint;
+	return UNREAL_LIVE_LINK_OK;
+}
+
+static int Mock_RemoveStaticEndpoint(const char* endpoint)
+{
+	(void)endpoint;
+	return UNREAL_LIVE_LINK_OK;
+}
+
+static void Mock_RegisterConnectionUpdateCallback(void (*callback)())
+{
+	Mock_RegisterProviderConnectionUpdateCallback(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, callback);
+}
+
+static int Mock_HasConnection(void)
+{
+	return Mock_ProviderHasConnection(UNREAL_LIVE_LINK_DEFAULT_PROVIDER);
+}
+
+static void Mock_SetBasicStructure(const char *subjectName, const struct UnrealLiveLink_Properties *properties)
+{
+	(void)subjectName;
+	(void)properties;
+}
+
+static void Mock_UpdateBasicFrame(const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues)
+{
+	(void)metadata;
+	(void)propValues;
+	MockRecordFrame(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, subjectName, worldTime);
+}
+
+static void Mock_SetAnimationStructure(const char *subjectName, const struct UnrealLiveLink_Properties *properties,
+	struct UnrealLiveLink_AnimationStatic *structure)
+{
+	(void)subjectName;
+	(void)properties;
+	(void)structure;
+}
+
+static void Mock_UpdateAnimationFrame(const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Animation *frame)
+{
+	(void)metadata;
+	(void)propValues;
+	(void)frame;
+	MockRecordFrame(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, subjectName, worldTime);
+}
+
+static void Mock_SetTransformStructure(const char *subjectName, const struct UnrealLiveLink_Properties *properties)
+{
+	(void)subjectName;
+	(void)properties;
+}
+
+static void Mock_UpdateTransformFrame(const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Transform *frame)
+{
+	(void)metadata;
+	(void)propValues;
+	(void)frame;
+	MockRecordFrame(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, subjectName, worldTime);
+}
+
+static void Mock_SetCameraStructure(const char *subjectName, const struct UnrealLiveLink_Properties *properties,
+	struct UnrealLiveLink_CameraStatic *structure)
+{
+	(void)subjectName;
+	(void)properties;
+	(void)structure;
+}
+
+static void Mock_UpdateCameraFrame(const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Camera *frame)
+{
+	(void)metadata;
+	(void)propValues;
+	(void)frame;
+	MockRecordFrame(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, subjectName, worldTime);
+}
+
+static void Mock_SetLightStructure(const char *subjectName, const struct UnrealLiveLink_Properties *properties,
+	struct UnrealLiveLink_LightStatic *structure)
+{
+	(void)subjectName;
+	(void)properties;
+	(void)structure;
+}
+
+static void Mock_UpdateLightFrame(const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Light *frame)
+{
+	(void)metadata;
+	(void)propValues;
+	(void)frame;
+	MockRecordFrame(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, subjectName, worldTime);
+}
+
+static int Mock_ProviderGetStaticDataStats(int provider, struct UnrealLiveLink_StaticDataStats *stats)
+{
+	if (!stats)
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+	return MockIsProvider(provider) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static int Mock_ProviderSetBasicStructure(int provider, const char *subjectName,
+	const struct UnrealLiveLink_Properties *properties)
+{
+	(void)subjectName;
+	(void)properties;
+	return MockIsProvider(provider) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static int Mock_ProviderUpdateBasicFrame(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues)
+{
+	(void)metadata;
+	(void)propValues;
+	return MockRecordFrame(provider, subjectName, worldTime);
+}
+
+static int Mock_ProviderSetAnimationStructure(int provider, const char *subjectName,
+	const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_AnimationStatic *structure)
+{
+	(void)subjectName;
+	(void)properties;
+	(void)structure;
+	return MockIsProvider(provider) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static int Mock_ProviderUpdateAnimationFrame(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Animation *frame)
+{
+	(void)metadata;
+	(void)propValues;
+	(void)frame;
+	return MockRecordFrame(provider, subjectName, worldTime);
+}
+
+static int Mock_RegisterSkeletonTemplate(const struct UnrealLiveLink_Properties *properties,
+	const struct UnrealLiveLink_AnimationStatic *structure)
+{
+	(void)properties;
+	(void)structure;
+	return 0;
+}
+
+static int Mock_UnregisterSkeletonTemplate(int skeletonTemplate)
+{
+	(void)skeletonTemplate;
+	return UNREAL_LIVE_LINK_OK;
+}
+
+static int Mock_ProviderSetAnimationStructureFromTemplate(int provider, const char *subjectName, int skeletonTemplate)
+{
+	(void)subjectName;
+	(void)skeletonTemplate;
+	return MockIsProvider(provider) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static int Mock_ProviderSetAnimationTransformSpace(int provider, const char *subjectName,
+	enum UnrealLiveLink_TransformSpace space)
+{
+	(void)subjectName;
+	(void)space;
+	return MockIsProvider(provider) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static int Mock_ProviderSetRotationOrder(int provider, const char *subjectName,
+	enum UnrealLiveLink_RotationOrder order, int isRadians)
+{
+	(void)subjectName;
+	(void)order;
+	(void)isRadians;
+	return MockIsProvider(provider) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static int Mock_ProviderSetValidation(int provider, const char *subjectName, enum UnrealLiveLink_ValidationMode mode,
+	float maxAbsValue)
+{
+	(void)subjectName;
+	(void)mode;
+	(void)maxAbsValue;
+	return MockIsProvider(provider) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static int Mock_ProviderGetValidationStats(int provider, struct UnrealLiveLink_ValidationStats *stats)
+{
+	if (!stats)
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+	return MockIsProvider(provider) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static int Mock_ProviderSetFilter(int provider, const char *subjectName, enum UnrealLiveLink_FilterChannel channel,
+	const struct UnrealLiveLink_FilterSettings *settings)
+{
+	(void)subjectName;
+	(void)channel;
+	(void)settings;
+	return MockIsProvider(provider) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static int Mock_ProviderSetResampling(int provider, const char *subjectName, double outputRate, double delay)
+{
+	(void)subjectName;
+	(void)outputRate;
+	(void)delay;
+	return MockIsProvider(provider) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static int Mock_ProviderSetExtrapolation(int provider, const char *subjectName,
+	const struct UnrealLiveLink_ExtrapolationSettings *settings)
+{
+	(void)subjectName;
+	(void)settings;
+	return MockIsProvider(provider) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static int Mock_ProviderGetExtrapolationStats(int provider, struct UnrealLiveLink_ExtrapolationStats *stats)
+{
+	if (!stats)
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+	return MockIsProvider(provider) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static int Mock_ProviderUpdateTransformFrameMatrix(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Matrix *frame)
+{
+	(void)metadata;
+	(void)propValues;
+	(void)frame;
+	return MockRecordFrame(provider, subjectName, worldTime);
+}
+
+static int Mock_ProviderUpdateAnimationFrameMatrices(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_AnimationMatrices *frame)
+{
+	(void)metadata;
+	(void)propValues;
+	(void)frame;
+	return MockRecordFrame(provider, subjectName, worldTime);
+}
+
+static int Mock_ProviderUpdateCameraFrameMatrix(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Camera *frame, const struct UnrealLiveLink_Matrix *transform)
+{
+	(void)metadata;
+	(void)propValues;
+	(void)frame;
+	(void)transform;
+	return MockRecordFrame(provider, subjectName, worldTime);
+}
+
+static int Mock_ProviderUpdateLightFrameMatrix(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Light *frame, const struct UnrealLiveLink_Matrix *transform)
+{
+	(void)metadata;
+	(void)propValues;
+	(void)frame;
+	(void)transform;
+	return MockRecordFrame(provider, subjectName, worldTime);
+}
+
+static int Mock_ProviderSetBasicStructurePacked(int provider, const char *subjectName,
+	const struct UnrealLiveLink_PackedStrings *propertyNames)
+{
+	(void)subjectName;
+	(void)propertyNames;
+	return MockIsProvider(provider) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static int Mock_ProviderUpdateBasicFramePacked(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_PackedMetadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues)
+{
+	(void)metadata;
+	(void)propValues;
+	return MockRecordFrame(provider, subjectName, worldTime);
+}
+
+static int Mock_ProviderSetAnimationStructurePacked(int provider, const char *subjectName,
+	const struct UnrealLiveLink_PackedStrings *propertyNames, const struct UnrealLiveLink_PackedAnimationStatic *structure)
+{
+	(void)subjectName;
+	(void)propertyNames;
+	(void)structure;
+	return MockIsProvider(provider) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static int Mock_ProviderUpdateAnimationFramePacked(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_PackedMetadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Animation *frame)
+{
+	(void)metadata;
+	(void)propValues;
+	(void)frame;
+	return MockRecordFrame(provider, subjectName, worldTime);
+}
+
+static int Mock_ProviderGetSkeletonSetupStats(int provider, struct UnrealLiveLink_SkeletonSetupStats *stats)
+{
+	if (!stats)
+	{
+		return UNREAL_LIVE_LINK_INVALID_STRUCTURE;
+	}
+	return MockIsProvider(provider) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static int Mock_ProviderSetTransformStructure(int provider, const char *subjectName,
+	const struct UnrealLiveLink_Properties *properties)
+{
+	(void)subjectName;
+	(void)properties;
+	return MockIsProvider(provider) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static int Mock_ProviderUpdateTransformFrame(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Transform *frame)
+{
+	(void)metadata;
+	(void)propValues;
+	(void)frame;
+	return MockRecordFrame(provider, subjectName, worldTime);
+}
+
+static int Mock_ProviderSetCameraStructure(int provider, const char *subjectName,
+	const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_CameraStatic *structure)
+{
+	(void)subjectName;
+	(void)properties;
+	(void)structure;
+	return MockIsProvider(provider) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static int Mock_ProviderUpdateCameraFrame(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Camera *frame)
+{
+	(void)metadata;
+	(void)propValues;
+	(void)frame;
+	return MockRecordFrame(provider, subjectName, worldTime);
+}
+
+static int Mock_ProviderSetLightStructure(int provider, const char *subjectName,
+	const struct UnrealLiveLink_Properties *properties, struct UnrealLiveLink_LightStatic *structure)
+{
+	(void)subjectName;
+	(void)properties;
+	(void)structure;
+	return MockIsProvider(provider) ? UNREAL_LIVE_LINK_OK : UNREAL_LIVE_LINK_INVALID_PROVIDER;
+}
+
+static int Mock_ProviderUpdateLightFrame(int provider, const char *subjectName, const double worldTime,
+	const struct UnrealLiveLink_Metadata *metadata, const struct UnrealLiveLink_PropertyValues *propValues,
+	const struct UnrealLiveLink_Light *frame)
+{
+	(void)metadata;
+	(void)propValues;
+	(void)frame;
+	return MockRecordFrame(provider, subjectName, worldTime);
+}
+
+static struct UnrealLiveLink_Interface MockInterface;
+
+#ifdef __GNUC__
+#define MOCK_EXPORT __attribute__((visibility("default")))
+#else
+#define MOCK_EXPORT
+#endif
+
+MOCK_EXPORT const struct UnrealLiveLink_Interface *UnrealLiveLink_GetInterface(int version)
+{
+	if (version < UNREAL_LIVE_LINK_INTERFACE_API_VERSION)
+	{
+		return NULL;
+	}
+
+	/* filled on each load, UnrealLiveLink_Load doesn't race with other calls */
+	MockInterface.version = UNREAL_LIVE_LINK_API_VERSION;
+	MockInterface.size = (int)sizeof(MockInterface);
+	MockInterface.capabilities = 0;
+
+	MockInterface.Initialize = &Mock_Initialize;
+	MockInterface.Shutdown = &Mock_Shutdown;
+	MockInterface.GetVersion = &Mock_GetVersion;
+	MockInterface.SetProviderName = &Mock_SetProviderName;
+	MockInterface.StartLiveLink = &Mock_StartLiveLink;
+	MockInterface.StopLiveLink = &Mock_StopLiveLink;
+	MockInterface.SetUnicastEndpoint = &Mock_SetUnicastEndpoint;
+	MockInterface.AddStaticEndpoint = &Mock_AddStaticEndpoint;
+	MockInterface.RemoveStaticEndpoint = &Mock_RemoveStaticEndpoint;
+	MockInterface.RegisterConnectionUpdateCallback = &Mock_RegisterConnectionUpdateCallback;
+	MockInterface.HasConnection = &Mock_HasConnection;
+	MockInterface.SetBasicStructure = &Mock_SetBasicStructure;
+	MockInterface.UpdateBasicFrame = &Mock_UpdateBasicFrame;
+	MockInterface.SetAnimationStructure = &Mock_SetAnimationStructure;
+	MockInterface.UpdateAnimationFrame = &Mock_UpdateAnimationFrame;
+	MockInterface.SetTransformStructure = &Mock_SetTransformStructure;
+	MockInterface.UpdateTransformFrame = &Mock_UpdateTransformFrame;
+	MockInterface.SetCameraStructure = &Mock_SetCameraStructure;
+	MockInterface.UpdateCameraFrame = &Mock_UpdateCameraFrame;
+	MockInterface.SetLightStructure = &Mock_SetLightStructure;
+	MockInterface.UpdateLightFrame = &Mock_UpdateLightFrame;
+	MockInterface.CreateProvider = &Mock_CreateProvider;
+	MockInterface.DestroyProvider = &Mock_DestroyProvider;
+	MockInterface.StartProvider = &Mock_StartProvider;
+	MockInterface.StopProvider = &Mock_StopProvider;
+	MockInterface.RegisterProviderConnectionUpdateCallback = &Mock_RegisterProviderConnectionUpdateCallback;
+	MockInterface.ProviderHasConnection = &Mock_ProviderHasConnection;
+	MockInterface.ProviderGetStaticDataStats = &Mock_ProviderGetStaticDataStats;
+	MockInterface.ProviderSetBasicStructure = &Mock_ProviderSetBasicStructure;
+	MockInterface.ProviderUpdateBasicFrame = &Mock_ProviderUpdateBasicFrame;
+	MockInterface.ProviderSetAnimationStructure = &Mock_ProviderSetAnimationStructure;
+	MockInterface.ProviderUpdateAnimationFrame = &Mock_ProviderUpdateAnimationFrame;
+	MockInterface.ProviderUpdateAnimationFrames = &Mock_ProviderUpdateAnimationFrames;
+	MockInterface.RegisterSkeletonTemplate = &Mock_RegisterSkeletonTemplate;
+	MockInterface.UnregisterSkeletonTemplate = &Mock_UnregisterSkeletonTemplate;
+	MockInterface.ProviderSetAnimationStructureFromTemplate = &Mock_ProviderSetAnimationStructureFromTemplate;
+	MockInterface.ProviderSetAnimationTransformSpace = &Mock_ProviderSetAnimationTransformSpace;
+	MockInterface.ProviderSetRotationOrder = &Mock_ProviderSetRotationOrder;
+	MockInterface.ProviderSetValidation = &Mock_ProviderSetValidation;
+	MockInterface.ProviderGetValidationStats = &Mock_ProviderGetValidationStats;
+	MockInterface.ProviderSetFilter = &Mock_ProviderSetFilter;
+	MockInterface.ProviderSetResampling = &Mock_ProviderSetResampling;
+	MockInterface.ProviderSetExtrapolation = &Mock_ProviderSetExtrapolation;
+	MockInterface.ProviderGetExtrapolationStats = &Mock_ProviderGetExtrapolationStats;
+	MockInterface.ProviderUpdateTransformFrameMatrix = &Mock_ProviderUpdateTransformFrameMatrix;
+	MockInterface.ProviderUpdateAnimationFrameMatrices = &Mock_ProviderUpdateAnimationFrameMatrices;
+	MockInterface.ProviderUpdateCameraFrameMatrix = &Mock_ProviderUpdateCameraFrameMatrix;
+	MockInterface.ProviderUpdateLightFrameMatrix = &Mock_ProviderUpdateLightFrameMatrix;
+	MockInterface.ProviderSetBasicStructurePacked = &Mock_ProviderSetBasicStructurePacked;
+	MockInterface.ProviderUpdateBasicFramePacked = &Mock_ProviderUpdateBasicFramePacked;
+	MockInterface.ProviderSetAnimationStructurePacked = &Mock_ProviderSetAnimationStructurePacked;
+	MockInterface.ProviderUpdateAnimationFramePacked = &Mock_ProviderUpdateAnimationFramePacked;
+	MockInterface.ProviderGetSkeletonSetupStats = &Mock_ProviderGetSkeletonSetupStats;
+	MockInterface.ProviderSetTransformStructure = &Mock_ProviderSetTransformStructure;
+	MockInterface.ProviderUpdateTransformFrame = &Mock_ProviderUpdateTransformFrame;
+	MockInterface.ProviderSetCameraStructure = &Mock_ProviderSetCameraStructure;
+	MockInterface.ProviderUpdateCameraFrame = &Mock_ProviderUpdateCameraFrame;
+	MockInterface.ProviderSetLightStructure = &Mock_ProviderSetLightStructure;
+	MockInterface.ProviderUpdateLightFrame = &Mock_ProviderUpdateLightFrame;
+
+	return &MockInterface;
+}
+
+/**
+ * frames recorded for a subject since the mock was initialized
+ * @return UNREAL_LIVE_LINK_OK, UNREAL_LIVE_LINK_FAILED if no frame arrived for the subject
+ */
+MOCK_EXPORT int MockUnrealLiveLink_GetSubjectStats(int provider, const char *subjectName, long *frameCount, long *outOfOrderCount)
+{
+	struct MockSubject *subject = MockFindSubject(provider, subjectName, 0);
+
+	if (!subject)
+	{
+		return UNREAL_LIVE_LINK_FAILED;
+	}
+
+	pthread_mutex_lock(&subject->lock);
+	*frameCount = subject->frameCount;
+	*outOfOrderCount = subject->outOfOrderCount;
+	pthread_mutex_unlock(&subject->lock);
+
+	return UNREAL_LIVE_LINK_OK;
+}
@@ -0,0 +1,504 @@
+/** 
+ * Copyright (c) 2020 Patrick Palmer, The Jim Henson Company.
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Round trip and corruption checks of the compressed clips, run with --time to also time decoding
+ * the clip is a synthetic skeleton with every track moving, so key reduction and the Rice codes all get exercised
+ */
+
+#include "UnrealLiveLinkClip.h"
+
+#include <float.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define BONE_COUNT 64
+#define FRAME_COUNT 1200
+#define FRAME_RATE 30.0
+
+/* the corruption checks use the first frames of the clip in short blocks, so every run stays cheap */
+#define CORRUPTION_FRAME_COUNT 96
+#define CORRUPTION_BLOCK_FRAMES 32
+#define CORRUPTION_RUNS 400
+
+/* passes of the whole clip for the decode timing */
+#define DECODE_PASSES 20
+
+/* bytes of the clip's magic and version at its start */
+#define CLIP_ID_SIZE 8
+
+/* header fields after the counts: frame rate (float64), block frames, translation and scale precisions (float32) */
+#define CLIP_FRAME_RATE_OFFSET 16
+#define CLIP_TRANSLATION_PRECISION_OFFSET 28
+#define CLIP_SCALE_PRECISION_OFFSET 32
+#define CLIP_HEADER_SIZE 36
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+struct ClipError
+{
+	/* largest quaternion component difference, with the decoded quaternion flipped to the source's sign */
+	double rotation;
+	double translation;
+	double scale;
+};
+
+static int failures = 0;
+
+static void Check(int condition, const char *description)
+{
+	if (!condition)
+	{
+		printf("FAILED: %s\n", description);
+		failures++;
+	}
+}
+
+/* deterministic so a failure reproduces */
+static unsigned int NextRandom(unsigned int *state)
+{
+	*state = *state * 1103515245u + 12345u;
+	return (*state >> 8) & 0xffffff;
+}
+
+/* each bone swings about its own axis at its own rate and moves on a curve, some bones also scale */
+static void MakeFrames(struct UnrealLiveLink_Transform *transforms)
+{
+	int frame;
+	int bone;
+	double time;
+	double angle;
+	double axis[3];
+	double axisLength;
+	struct UnrealLiveLink_Transform *transform;
+
+	for (frame = 0; frame < FRAME_COUNT; frame++)
+	{
+		time = frame / FRAME_RATE;
+		for (bone = 0; bone < BONE_COUNT; bone++)
+		{
+			transform = transforms + frame * BONE_COUNT + bone;
+
+			axis[0] = sin(bone * 1.3);
+			axis[1] = cos(bone * 0.7);
+			axis[2] = 0.5 + 0.25 * sin(bone * 2.1);
+			axisLength = sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+
+			angle = 0.8 * sin(time * (1.0 + 0.05 * bone) + bone);
+			transform->rotation[0] = (float)(axis[0] / axisLength * sin(angle * 0.5));
+			transform->rotation[1] = (float)(axis[1] / axisLength * sin(angle * 0.5));
+			transform->rotation[2] = (float)(axis[2] / axisLength * sin(angle * 0.5));
+			transform->rotation[3] = (float)cos(angle * 0.5);
+
+			transform->translation[0] = (float)(10.0 * bone + 5.0 * sin(time * 2.0 + bone));
+			transform->translation[1] = (float)(3.0 * cos(time * 1.5 + bone * 0.3));
+			transform->translation[2] = (float)(100.0 + 20.0 * sin(time * 0.5) + 0.5 * sin(time * 7.0 + bone));
+
+			transform->scale[0] = (float)(bone % 8 ? 1.0 : 1.0 + 0.1 * sin(time));
+			transform->scale[1] = transform->scale[0];
+			transform->scale[2] = 1.0f;
+		}
+	}
+}
+
+/* decode every frame and take the largest errors against the source, 0 if a frame fails to decode */
+static int MeasureError(struct UnrealLiveLink_ClipDecoder *decoder, const struct UnrealLiveLink_Transform *source, struct ClipError *error)
+{
+	struct UnrealLiveLink_Transform decoded[BONE_COUNT];
+	struct UnrealLiveLink_Animation animation;
+	const struct UnrealLiveLink_Transform *expected;
+	double dot;
+	double value;
+	int frame;
+	int bone;
+	int idx;
+
+	animation.transforms = decoded;
+	animation.transformCount = BONE_COUNT;
+	memset(error, 0, sizeof(*error));
+
+	for (frame = 0; frame < FRAME_COUNT; frame++)
+	{
+		if (UnrealLiveLink_DecodeClipFrame(decoder, frame, &animation) != UNREAL_LIVE_LINK_OK)
+		{
+			return 0;
+		}
+
+		for (bone = 0; bone < BONE_COUNT; bone++)
+		{
+			expected = source + frame * BONE_COUNT + bone;
+
+			/* either sign of the quaternion is the same rotation */
+			dot = 0.0;
+			for (idx = 0; idx < 4; idx++)
+			{
+				dot += expected->rotation[idx] * decoded[bone].rotation[idx];
+			}
+			for (idx = 0; idx < 4; idx++)
+			{
+				value = fabs(expected->rotation[idx] - (dot < 0.0 ? -decoded[bone].rotation[idx] : decoded[bone].rotation[idx]));
+				error->rotation = value > error->rotation ? value : error->rotation;
+			}
+
+			for (idx = 0; idx < 3; idx++)
+			{
+				value = fabs(expected->translation[idx] - decoded[bone].translation[idx]);
+				error->translation = value > error->translation ? value : error->translation;
+				value = fabs(expected->scale[idx] - decoded[bone].scale[idx]);
+				error->scale = value > error->scale ? value : error->scale;
+			}
+		}
+	}
+
+	return 1;
+}
+
+/* encode with the settings and check the decoded clip is within the bounds, returns the clip size (0 on failure) */
+static size_t CheckRoundTrip(const char *name, const struct UnrealLiveLink_Transform *source, const struct UnrealLiveLink_ClipSettings *settings,
+	double maxRotation, double maxTranslation, double maxScale)
+{
+	unsigned char *data = NULL;
+	size_t size = 0;
+	struct UnrealLiveLink_ClipDecoder *decoder = NULL;
+	struct UnrealLiveLink_ClipInfo info;
+	struct ClipError error;
+	int decoded;
+
+	if (UnrealLiveLink_EncodeClip(source, BONE_COUNT, FRAME_COUNT, FRAME_RATE, settings, &data, &size) != UNREAL_LIVE_LINK_OK)
+	{
+		Check(0, name);
+		return 0;
+	}
+
+	if (UnrealLiveLink_OpenClip(data, size, &decoder) != UNREAL_LIVE_LINK_OK)
+	{
+		Check(0, name);
+		UnrealLiveLink_FreeClip(data);
+		return 0;
+	}
+
+	Check(UnrealLiveLink_GetClipInfo(decoder, &info) == UNREAL_LIVE_LINK_OK && info.boneCount == BONE_COUNT &&
+		info.frameCount == FRAME_COUNT && info.frameRate == FRAME_RATE, "clip info matches the encoded clip");
+
+	decoded = MeasureError(decoder, source, &error);
+	Check(decoded, "every frame decodes");
+
+	printf("%s: %lu bytes (%.1fx smaller than the transforms), max error rotation %g, translation %g, scale %g\n",
+		name, (unsigned long)size, (double)sizeof(struct UnrealLiveLink_Transform) * BONE_COUNT * FRAME_COUNT / size,
+		error.rotation, error.translation, error.scale);
+
+	Check(error.rotation <= maxRotation, "rotation error within bound");
+	Check(error.translation <= maxTranslation, "translation error within bound");
+	Check(error.scale <= maxScale, "scale error within bound");
+
+	UnrealLiveLink_CloseClip(decoder);
+	UnrealLiveLink_FreeClip(data);
+	return decoded ? size : 0;
+}
+
+/* every transform of a frame that decoded from corrupt data must still be usable */
+static int IsFrameFinite(const struct UnrealLiveLink_Transform *transforms)
+{
+	int bone;
+	int idx;
+
+	for (bone = 0; bone < BONE_COUNT; bone++)
+	{
+		for (idx = 0; idx < 4; idx++)
+		{
+			if (!(fabs(transforms[bone].rotation[idx]) <= 1.0001))
+			{
+				return 0;
+			}
+		}
+		for (idx = 0; idx < 3; idx++)
+		{
+			if (!(fabs(transforms[bone].translation[idx]) <= FLT_MAX) || !(fabs(transforms[bone].scale[idx]) <= FLT_MAX))
+			{
+				return 0;
+			}
+		}
+	}
+	return 1;
+}
+
+static void PutUInt32(unsigned char *data, uint32_t value)
+{
+	data[0] = (unsigned char)value;
+	data[1] = (unsigned char)(value >> 8);
+	data[2] = (unsigned char)(value >> 16);
+	data[3] = (unsigned char)(value >> 24);
+}
+
+/* a header value no clip may hold: index 0 to 4 for NaN, infinity, zero, negative and too large */
+static double GetBadHeaderValue(int index)
+{
+	double zero = 0.0;
+
+	switch (index)
+	{
+	case 0:
+		return zero / zero;
+	case 1:
+		return 1.0 / zero;
+	case 2:
+		return 0.0;
+	case 3:
+		return -1.0;
+	}
+	return FLT_MAX;
+}
+
+/* a frame rate or precision that is not positive and finite (or would overflow decoded values) is rejected on open */
+static void CheckHeaderValues(const unsigned char *data, size_t size, unsigned char *corrupt)
+{
+	struct UnrealLiveLink_ClipDecoder *decoder = NULL;
+	uint64_t frameRateBits;
+	uint32_t precisionBits;
+	double frameRate;
+	float precision;
+	int field;
+	int index;
+	int result;
+
+	for (field = 0; field < 3; field++)
+	{
+		for (index = 0; index < 5; index++)
+		{
+			memcpy(corrupt, data, size);
+			if (field == 0)
+			{
+				/* any double, FLT_MAX included, is a usable frame rate */
+				if (index == 4)
+				{
+					continue;
+				}
+				frameRate = GetBadHeaderValue(index);
+				memcpy(&frameRateBits, &frameRate, sizeof(frameRateBits));
+				PutUInt32(corrupt + CLIP_FRAME_RATE_OFFSET, (uint32_t)frameRateBits);
+				PutUInt32(corrupt + CLIP_FRAME_RATE_OFFSET + 4, (uint32_t)(frameRateBits >> 32));
+			}
+			else
+			{
+				precision = (float)GetBadHeaderValue(index);
+				memcpy(&precisionBits, &precision, sizeof(precisionBits));
+				PutUInt32(corrupt + (field == 1 ? CLIP_TRANSLATION_PRECISION_OFFSET : CLIP_SCALE_PRECISION_OFFSET), precisionBits);
+			}
+
+			result = UnrealLiveLink_OpenClip(corrupt, size, &decoder);
+			Check(result == UNREAL_LIVE_LINK_INVALID_STRUCTURE, "clips with a bad frame rate or precision are rejected");
+			if (result == UNREAL_LIVE_LINK_OK)
+			{
+				UnrealLiveLink_CloseClip(decoder);
+			}
+		}
+	}
+}
+
+static void CheckCorruption(const struct UnrealLiveLink_Transform *source)
+{
+	struct UnrealLiveLink_ClipSettings settings;
+	unsigned char *data = NULL;
+	unsigned char *corrupt;
+	size_t size = 0;
+	size_t truncated;
+	struct UnrealLiveLink_ClipDecoder *decoder = NULL;
+	struct UnrealLiveLink_Transform decoded[BONE_COUNT];
+	struct UnrealLiveLink_Animation animation;
+	unsigned int random = 1;
+	int truncatedOpened = 0;
+	int finite = 1;
+	int rejected = 0;
+	int run;
+	int flip;
+	int frame;
+	int result;
+
+	animation.transforms = decoded;
+	animation.transformCount = BONE_COUNT;
+
+	memset(&settings, 0, sizeof(settings));
+	settings.blockFrames = CORRUPTION_BLOCK_FRAMES;
+	if (UnrealLiveLink_EncodeClip(source, BONE_COUNT, CORRUPTION_FRAME_COUNT, FRAME_RATE, &settings, &data, &size) != UNREAL_LIVE_LINK_OK)
+	{
+		Check(0, "corruption clip encodes");
+		return;
+	}
+	corrupt = (unsigned char *)malloc(size);
+
+	/* the block table ends at the clip's size, so no truncation opens */
+	for (truncated = 0; truncated < size; truncated += truncated < 1024 ? 1 : 31)
+	{
+		memcpy(corrupt, data, truncated);
+		if (UnrealLiveLink_OpenClip(corrupt, truncated, &decoder) == UNREAL_LIVE_LINK_OK)
+		{
+			truncatedOpened++;
+			UnrealLiveLink_CloseClip(decoder);
+		}
+	}
+	Check(truncatedOpened == 0, "truncated clips are rejected");
+
+	/* a wrong magic or version is rejected */
+	for (flip = 0; flip < CLIP_ID_SIZE * 8; flip++)
+	{
+		memcpy(corrupt, data, size);
+		corrupt[flip / 8] ^= (unsigned char)(1 << (flip % 8));
+		result = UnrealLiveLink_OpenClip(corrupt, size, &decoder);
+		Check(result == UNREAL_LIVE_LINK_INVALID_STRUCTURE, "clips with a bad magic or version are rejected");
+		if (result == UNREAL_LIVE_LINK_OK)
+		{
+			UnrealLiveLink_CloseClip(decoder);
+		}
+	}
+
+	CheckHeaderValues(data, size, corrupt);
+
+	/* flips elsewhere either fail to open or decode, or decode to finite transforms, and never read out of bounds,
+	 * every other run flips a bit of the header fields after the counts */
+	for (run = 0; run < CORRUPTION_RUNS; run++)
+	{
+		memcpy(corrupt, data, size);
+		if (run % 2)
+		{
+			flip = (int)(NextRandom(&random) % ((CLIP_HEADER_SIZE - CLIP_FRAME_RATE_OFFSET) * 8));
+			corrupt[CLIP_FRAME_RATE_OFFSET + flip / 8] ^= (unsigned char)(1 << (flip % 8));
+		}
+		for (flip = 1 + (int)(NextRandom(&random) % 4); flip > 0; flip--)
+		{
+			corrupt[CLIP_ID_SIZE + NextRandom(&random) % (size - CLIP_ID_SIZE)] ^= (unsigned char)(1 << (NextRandom(&random) % 8));
+		}
+
+		if (UnrealLiveLink_OpenClip(corrupt, size, &decoder) != UNREAL_LIVE_LINK_OK)
+		{
+			rejected++;
+			continue;
+		}
+		for (frame = 0; frame < CORRUPTION_FRAME_COUNT; frame += 5)
+		{
+			result = UnrealLiveLink_DecodeClipFrame(decoder, frame, &animation);
+			if (result != UNREAL_LIVE_LINK_OK)
+			{
+				rejected++;
+				break;
+			}
+			finite = finite && IsFrameFinite(decoded);
+		}
+		UnrealLiveLink_CloseClip(decoder);
+	}
+	Check(finite, "frames decoded from corrupt clips are finite");
+	Check(rejected > 0, "bit flipped clips are rejected");
+	printf("corruption: %d of %d bit flipped clips rejected\n", rejected, CORRUPTION_RUNS);
+
+	free(corrupt);
+	UnrealLiveLink_FreeClip(data);
+}
+
+static void TimeDecoding(const struct UnrealLiveLink_Transform *source)
+{
+	unsigned char *data = NULL;
+	size_t size = 0;
+	struct UnrealLiveLink_ClipDecoder *decoder = NULL;
+	struct UnrealLiveLink_Transform decoded[BONE_COUNT];
+	struct UnrealLiveLink_Animation animation;
+	clock_t start;
+	double seconds;
+	int pass;
+	int frame;
+
+	animation.transforms = decoded;
+	animation.transformCount = BONE_COUNT;
+
+	if (UnrealLiveLink_EncodeClip(source, BONE_COUNT, FRAME_COUNT, FRAME_RATE, NULL, &data, &size) != UNREAL_LIVE_LINK_OK)
+	{
+		Check(0, "timing clip encodes");
+		return;
+	}
+
+	/* reopened every pass so each block is decoded rather than copied from the last pass */
+	start = clock();
+	for (pass = 0; pass < DECODE_PASSES; pass++)
+	{
+		if (UnrealLiveLink_OpenClip(data, size, &decoder) != UNREAL_LIVE_LINK_OK)
+		{
+			Check(0, "timing clip opens");
+			break;
+		}
+		for (frame = 0; frame < FRAME_COUNT; frame++)
+		{
+			UnrealLiveLink_DecodeClipFrame(decoder, frame, &animation);
+		}
+		UnrealLiveLink_CloseClip(decoder);
+	}
+	seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	printf("decode: %.2f us per %d bone frame\n", seconds * 1e6 / ((double)DECODE_PASSES * FRAME_COUNT), BONE_COUNT);
+
+	UnrealLiveLink_FreeClip(data);
+}
+
+int main(int argc, char *argv[])
+{
+	struct UnrealLiveLink_Transform *source;
+	struct UnrealLiveLink_ClipSettings settings;
+	size_t defaultSize;
+	size_t reducedSize;
+
+	source = (struct UnrealLiveLink_Transform *)malloc(sizeof(struct UnrealLiveLink_Transform) * BONE_COUNT * FRAME_COUNT);
+	MakeFrames(source);
+
+	/* every frame kept, only quantization error: half a step for translations and scales, a few quaternion steps
+	 * for rotations as they are renormalized after decoding */
+	defaultSize = CheckRoundTrip("defaults", source, NULL, 4.0 / 32767.0,
+		UNREAL_LIVE_LINK_CLIP_DEFAULT_TRANSLATION_PRECISION * 0.5 + 1e-4, UNREAL_LIVE_LINK_CLIP_DEFAULT_SCALE_PRECISION * 0.5 + 1e-6);
+
+	/* keys reduced within the tolerances, the error adds up to the tolerance on top of the quantization */
+	memset(&settings, 0, sizeof(settings));
+	settings.rotationTolerance = 0.0005f;
+	settings.translationTolerance = 0.01f;
+	settings.scaleTolerance = 0.001f;
+	reducedSize = CheckRoundTrip("tolerances", source, &settings, 4.0 / 32767.0 + 2.0 * settings.rotationTolerance,
+		settings.translationTolerance + UNREAL_LIVE_LINK_CLIP_DEFAULT_TRANSLATION_PRECISION, settings.scaleTolerance + UNREAL_LIVE_LINK_CLIP_DEFAULT_SCALE_PRECISION);
+	Check(reducedSize < defaultSize, "key reduction makes the clip smaller");
+
+	CheckCorruption(source);
+
+	/* only printed, not checked, so not part of the ctest run */
+	if (argc > 1 && strcmp(argv[1], "--time") == 0)
+	{
+		TimeDecoding(source);
+	}
+
+	free(source);
+
+	if (failures)
+	{
+		printf("%d checks failed\n", failures);
+		return 1;
+	}
+	printf("all checks passed\n");
+	return 0;
+}
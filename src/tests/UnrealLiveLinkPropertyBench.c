@@ -0,0 +1,117 @@
+/** 
+ * Copyright (c) 2020 Patrick Palmer, The Jim Henson Company.
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Frames per second of high channel count basic frames on the client side
+ * each frame fills an UnrealLiveLink_AllocPropertyValues buffer in place and sends it with
+ * UnrealLiveLink_ProviderUpdateBasicFrame into the mock shared object (MockUnrealLiveLinkCInterface.c), so this
+ * measures the fill and the call. The real shared object's bulk copy into the Live Link frame and the send to
+ * Unreal need Unreal and are not part of it.
+ */
+
+#include "UnrealLiveLinkCInterfaceAPI.h"
+
+#include <stdio.h>
+#include <time.h>
+
+/* values sent per property count, so every count takes about as long */
+#define VALUES_PER_COUNT 200000000L
+
+static int failures = 0;
+
+static void Check(int condition, const char *description)
+{
+	if (!condition)
+	{
+		printf("FAILED: %s\n", description);
+		failures++;
+	}
+}
+
+static void MeasurePropertyCount(int propertyCount)
+{
+	struct UnrealLiveLink_PropertyValues propValues;
+	const long frameCount = VALUES_PER_COUNT / propertyCount;
+	char subjectName[32];
+	clock_t start;
+	double seconds;
+	long frame;
+	int failedCount = 0;
+	int idx;
+
+	if (UnrealLiveLink_AllocPropertyValues(&propValues, propertyCount) != UNREAL_LIVE_LINK_OK)
+	{
+		Check(0, "property values are allocated");
+		return;
+	}
+	Check((size_t)propValues.values % UNREAL_LIVE_LINK_BUFFER_ALIGNMENT == 0, "property values are aligned");
+
+	sprintf(subjectName, "properties%d", propertyCount);
+
+	start = clock();
+	for (frame = 0; frame < frameCount; frame++)
+	{
+		for (idx = 0; idx < propertyCount; idx++)
+		{
+			propValues.values[idx] = (float)(frame + idx) * 0.001f;
+		}
+		failedCount += UnrealLiveLink_ProviderUpdateBasicFrame(UNREAL_LIVE_LINK_DEFAULT_PROVIDER, subjectName, (double)frame, NULL,
+			&propValues) != UNREAL_LIVE_LINK_OK;
+	}
+	seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	Check(failedCount == 0, "every update succeeds");
+	printf("%d properties: %.0f frames per second (%.2f ns per value)\n", propertyCount,
+		seconds > 0.0 ? frameCount / seconds : 0.0, seconds * 1e9 / ((double)frameCount * propertyCount));
+
+	UnrealLiveLink_FreePropertyValues(&propValues);
+}
+
+int main(int argc, char *argv[])
+{
+	if (argc < 2)
+	{
+		printf("usage: %s <mock shared object>\n", argv[0]);
+		return 2;
+	}
+
+	if (UnrealLiveLink_Load(argv[1]) != UNREAL_LIVE_LINK_OK)
+	{
+		printf("FAILED: the mock loads\n");
+		return 1;
+	}
+	Check(UnrealLiveLink_StartLiveLink() == UNREAL_LIVE_LINK_OK, "the default provider starts");
+
+	MeasurePropertyCount(1000);
+	MeasurePropertyCount(10000);
+	MeasurePropertyCount(100000);
+
+	UnrealLiveLink_Unload();
+
+	if (failures)
+	{
+		printf("%d checks failed\n", failures);
+		return 1;
+	}
+	printf("all checks passed\n");
+	return 0;
+}
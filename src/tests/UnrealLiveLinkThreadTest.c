@@ -0,0 +1,287 @@
+/** 
+ * Copyright (c) 2020 Patrick Palmer, The Jim Henson Company.
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Stress test of the client library's threading against the mock shared object (MockUnrealLiveLinkCInterface.c)
+ * meant to be built with ThreadSanitizer, see src/CMakeLists.txt
+ *
+ * Producer threads each update their own subjects, on the default provider or on a provider they create, with
+ * single and batched animation frames while the mock's message bus thread invokes connection callbacks. Every
+ * frame has to arrive once and in order for its subject. The library is loaded and unloaded several times and
+ * its functions have to be null after each unload.
+ *
+ * This covers the loader, the published function pointers and callbacks crossing threads. It doesn't run
+ * FUnrealLiveLinkCInterfaceProvider: its subject table and locking need Unreal, they are not verified by this test.
+ */
+
+/* nanosleep */
+#define _POSIX_C_SOURCE 200809L
+
+#include "UnrealLiveLinkCInterfaceAPI.h"
+
+#include <dlfcn.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define LOAD_CYCLES 3
+#define THREAD_COUNT 8
+#define SUBJECTS_PER_THREAD 4
+#define FRAME_COUNT 2000
+/* every BATCH_PERIOD frames a thread also sends all of its subjects in one batch */
+#define BATCH_PERIOD 8
+#define BONE_COUNT 16
+
+struct Producer
+{
+	int index;
+	int provider;
+	int result;
+	char subjectNames[SUBJECTS_PER_THREAD][32];
+};
+
+static pthread_mutex_t CallbackLock = PTHREAD_MUTEX_INITIALIZER;
+static long CallbackCount = 0;
+
+static int failures = 0;
+
+static void Check(int condition, const char *description)
+{
+	if (!condition)
+	{
+		printf("FAILED: %s\n", description);
+		failures++;
+	}
+}
+
+static void OnConnectionUpdate()
+{
+	pthread_mutex_lock(&CallbackLock);
+	CallbackCount++;
+	pthread_mutex_unlock(&CallbackLock);
+}
+
+static long GetCallbackCount(void)
+{
+	long count;
+
+	pthread_mutex_lock(&CallbackLock);
+	count = CallbackCount;
+	pthread_mutex_unlock(&CallbackLock);
+	return count;
+}
+
+static void *RunProducer(void *data)
+{
+	struct Producer *producer = (struct Producer *)data;
+	struct UnrealLiveLink_Transform transforms[BONE_COUNT];
+	struct UnrealLiveLink_Animation animation;
+	struct UnrealLiveLink_AnimationStatic structure;
+	struct UnrealLiveLink_AnimationSubjectFrame batch[SUBJECTS_PER_THREAD];
+	struct UnrealLiveLink_Bone bones[BONE_COUNT];
+	int subject;
+	int frame;
+	int bone;
+
+	producer->result = UNREAL_LIVE_LINK_OK;
+
+	/* odd threads create their own provider so provider creation races with updates of the default one */
+	if (producer->index % 2)
+	{
+		producer->provider = UnrealLiveLink_CreateProvider("ThreadTest");
+		if (producer->provider == UNREAL_LIVE_LINK_NO_PROVIDER || UnrealLiveLink_StartProvider(producer->provider) != UNREAL_LIVE_LINK_OK)
+		{
+			producer->result = UNREAL_LIVE_LINK_INVALID_PROVIDER;
+			return NULL;
+		}
+		UnrealLiveLink_RegisterProviderConnectionUpdateCallback(producer->provider, &OnConnectionUpdate);
+	}
+	else
+	{
+		producer->provider = UNREAL_LIVE_LINK_DEFAULT_PROVIDER;
+	}
+
+	for (bone = 0; bone < BONE_COUNT; bone++)
+	{
+		sprintf(bones[bone].name, "bone%d", bone);
+		bones[bone].parentIndex = bone - 1;
+		UnrealLiveLink_InitTransform(&transforms[bone]);
+	}
+	structure.bones = bones;
+	structure.boneCount = BONE_COUNT;
+
+	animation.transforms = transforms;
+	animation.transformCount = BONE_COUNT;
+
+	for (subject = 0; subject < SUBJECTS_PER_THREAD; subject++)
+	{
+		sprintf(producer->subjectNames[subject], "thread%d_subject%d", producer->index, subject);
+		UnrealLiveLink_ProviderSetAnimationStructure(producer->provider, producer->subjectNames[subject], NULL, &structure);
+
+		batch[subject].subjectName = producer->subjectNames[subject];
+		batch[subject].metadata = NULL;
+		batch[subject].propValues = NULL;
+		batch[subject].frame = &animation;
+	}
+
+	for (frame = 0; frame < FRAME_COUNT && producer->result == UNREAL_LIVE_LINK_OK; frame++)
+	{
+		transforms[0].translation[0] = (float)frame;
+
+		for (subject = 0; subject < SUBJECTS_PER_THREAD; subject++)
+		{
+			producer->result = UnrealLiveLink_ProviderUpdateAnimationFrame(producer->provider, producer->subjectNames[subject], frame, NULL, NULL, &animation);
+			if (producer->result != UNREAL_LIVE_LINK_OK)
+			{
+				break;
+			}
+		}
+
+		if (producer->result == UNREAL_LIVE_LINK_OK && frame % BATCH_PERIOD == BATCH_PERIOD - 1)
+		{
+			for (subject = 0; subject < SUBJECTS_PER_THREAD; subject++)
+			{
+				batch[subject].worldTime = frame + 0.5;
+			}
+			producer->result = UnrealLiveLink_ProviderUpdateAnimationFrames(producer->provider, batch, SUBJECTS_PER_THREAD);
+		}
+
+		UnrealLiveLink_ProviderHasConnection(producer->provider);
+	}
+
+	return NULL;
+}
+
+/* wait up to a second for the mock's message bus thread to have invoked a callback */
+static int WaitForCallback(void)
+{
+	struct timespec wait;
+	int tries;
+
+	wait.tv_sec = 0;
+	wait.tv_nsec = 1000000L;
+	for (tries = 0; tries < 1000 && GetCallbackCount() == 0; tries++)
+	{
+		nanosleep(&wait, NULL);
+	}
+	return GetCallbackCount() > 0;
+}
+
+static void RunCycle(const char *mockFilename)
+{
+	pthread_t threads[THREAD_COUNT];
+	struct Producer producers[THREAD_COUNT];
+	int (*GetSubjectStats)(int, const char *, long *, long *);
+	void *mock;
+	long frameCount;
+	long outOfOrderCount;
+	int thread;
+	int subject;
+
+	pthread_mutex_lock(&CallbackLock);
+	CallbackCount = 0;
+	pthread_mutex_unlock(&CallbackLock);
+
+	if (UnrealLiveLink_Load(mockFilename) != UNREAL_LIVE_LINK_OK)
+	{
+		Check(0, "the mock loads");
+		return;
+	}
+
+	UnrealLiveLink_RegisterConnectionUpdateCallback(&OnConnectionUpdate);
+	Check(UnrealLiveLink_StartLiveLink() == UNREAL_LIVE_LINK_OK, "the default provider starts");
+
+	for (thread = 0; thread < THREAD_COUNT; thread++)
+	{
+		producers[thread].index = thread;
+		pthread_create(&threads[thread], NULL, &RunProducer, &producers[thread]);
+	}
+	for (thread = 0; thread < THREAD_COUNT; thread++)
+	{
+		pthread_join(threads[thread], NULL);
+		Check(producers[thread].result == UNREAL_LIVE_LINK_OK, "every update succeeds");
+	}
+
+	Check(WaitForCallback(), "connection callbacks arrive from the message bus thread");
+
+	/* the mock is already loaded, this only takes another reference to reach its stats */
+	mock = dlopen(mockFilename, RTLD_LAZY | RTLD_NOLOAD);
+	*(void **)&GetSubjectStats = mock ? dlsym(mock, "MockUnrealLiveLink_GetSubjectStats") : NULL;
+	Check(GetSubjectStats != NULL, "the mock exports its stats");
+	for (thread = 0; thread < THREAD_COUNT && GetSubjectStats; thread++)
+	{
+		for (subject = 0; subject < SUBJECTS_PER_THREAD; subject++)
+		{
+			frameCount = 0;
+			outOfOrderCount = 0;
+			GetSubjectStats(producers[thread].provider, producers[thread].subjectNames[subject], &frameCount, &outOfOrderCount);
+			Check(frameCount == FRAME_COUNT + FRAME_COUNT / BATCH_PERIOD, "every frame of a subject arrives once");
+			Check(outOfOrderCount == 0, "frames of a subject arrive in order");
+		}
+	}
+	if (mock)
+	{
+		dlclose(mock);
+	}
+
+	for (thread = 0; thread < THREAD_COUNT; thread++)
+	{
+		if (producers[thread].provider != UNREAL_LIVE_LINK_DEFAULT_PROVIDER)
+		{
+			UnrealLiveLink_DestroyProvider(producers[thread].provider);
+		}
+	}
+
+	UnrealLiveLink_Unload();
+
+	Check(UnrealLiveLink_IsLoaded() == UNREAL_LIVE_LINK_NOT_LOADED, "unloaded");
+	Check(UnrealLiveLink_ProviderUpdateAnimationFrame == NULL && UnrealLiveLink_CreateProvider == NULL && UnrealLiveLink_StartLiveLink == NULL,
+		"functions are null after unloading");
+}
+
+int main(int argc, char *argv[])
+{
+	int cycle;
+
+	if (argc < 2)
+	{
+		printf("usage: %s <mock shared object>\n", argv[0]);
+		return 2;
+	}
+
+	Check(UnrealLiveLink_Load("missing_unreal_live_link_shared_object") == UNREAL_LIVE_LINK_MISSING_LIB, "a missing library fails to load");
+	Check(UnrealLiveLink_ProviderUpdateAnimationFrame == NULL, "functions stay null after a failed load");
+
+	for (cycle = 0; cycle < LOAD_CYCLES; cycle++)
+	{
+		RunCycle(argv[1]);
+	}
+
+	if (failures)
+	{
+		printf("%d checks failed\n", failures);
+		return 1;
+	}
+	printf("all checks passed (%d threads, %d subjects each, %d frames)\n", THREAD_COUNT, SUBJECTS_PER_THREAD, FRAME_COUNT);
+	return 0;
+}
@@ -0,0 +1,160 @@
+/** 
+ * Copyright (c) 2020 Patrick Palmer, The Jim Henson Company.
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Benchmark of the C++ layer against the same frame updates made straight through the C API
+ * both go into the mock shared object (MockUnrealLiveLinkCInterface.c), which records every frame, so the time
+ * per call is the library's dispatch plus the mock's bookkeeping. The wrapper has to stay within a few percent of
+ * the raw calls, runs alternate and the best of each is compared so a busy machine doesn't fail the check.
+ */
+
+#include "UnrealLiveLinkCInterface.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+
+constexpr int BoneCount = 64;
+constexpr int PropertyCount = 32;
+constexpr int CallCount = 200000;
+constexpr int RunCount = 7;
+
+// allowed ratio of the wrapper's best time to the raw calls' best time, and an absolute allowance per call
+constexpr double MaxOverheadRatio = 1.10;
+constexpr double MaxOverheadNs = 5.0;
+
+int Failures = 0;
+
+void Check(bool Condition, const char *Description)
+{
+	if (!Condition)
+	{
+		std::printf("FAILED: %s\n", Description);
+		Failures++;
+	}
+}
+
+// nanoseconds per call of CallCount calls, Update returns the call's result and counts failures
+template <typename UpdateFunction>
+double TimeCalls(UpdateFunction &&Update, int &OutFailedCount)
+{
+	const std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+	for (int Idx = 0; Idx < CallCount; Idx++)
+	{
+		OutFailedCount += Update(static_cast<double>(Idx)) != UNREAL_LIVE_LINK_OK;
+	}
+	const std::chrono::duration<double, std::nano> Elapsed = std::chrono::steady_clock::now() - Start;
+	return Elapsed.count() / CallCount;
+}
+
+// best times per call of the raw and the wrapped calls, run alternately
+template <typename RawFunction, typename WrappedFunction>
+void Compare(const char *Name, RawFunction &&Raw, WrappedFunction &&Wrapped)
+{
+	double RawBest = 0.0;
+	double WrappedBest = 0.0;
+	int FailedCount = 0;
+
+	for (int Run = 0; Run < RunCount; Run++)
+	{
+		const double RawTime = TimeCalls(Raw, FailedCount);
+		const double WrappedTime = TimeCalls(Wrapped, FailedCount);
+		RawBest = Run ? std::min(RawBest, RawTime) : RawTime;
+		WrappedBest = Run ? std::min(WrappedBest, WrappedTime) : WrappedTime;
+	}
+
+	std::printf("%s: C API %.1f ns per frame, C++ %.1f ns per frame\n", Name, RawBest, WrappedBest);
+	Check(FailedCount == 0, "every update succeeds");
+	Check(WrappedBest <= RawBest * MaxOverheadRatio + MaxOverheadNs, "the C++ layer adds no measurable overhead");
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+	if (argc < 2)
+	{
+		std::printf("usage: %s <mock shared object>\n", argv[0]);
+		return 2;
+	}
+
+	UnrealLiveLink::Library Library(argv[1]);
+	if (!Library.IsLoaded())
+	{
+		std::printf("FAILED: the mock loads\n");
+		return 1;
+	}
+
+	UnrealLiveLink::Provider Provider("WrapperBench");
+	Check(Provider.GetResult() == UNREAL_LIVE_LINK_OK, "the provider starts");
+
+	std::vector<UnrealLiveLink_Transform> Transforms(BoneCount);
+	for (UnrealLiveLink_Transform &Transform : Transforms)
+	{
+		UnrealLiveLink_InitTransform(&Transform);
+	}
+	std::array<float, PropertyCount> Values = {};
+
+	// separate subjects so the world times of each stay in order
+	const char *RawBasicName = "RawBasic";
+	const char *RawAnimationName = "RawAnimation";
+	const UnrealLiveLink::BasicSubject Basic(Provider, "WrappedBasic");
+	const UnrealLiveLink::AnimationSubject Animation(Provider, "WrappedAnimation");
+	const int Handle = Provider.GetHandle();
+
+	Compare("basic",
+		[&](double WorldTime)
+		{
+			UnrealLiveLink_PropertyValues PropValues;
+			PropValues.values = Values.data();
+			PropValues.valueCount = PropertyCount;
+			return UnrealLiveLink_ProviderUpdateBasicFrame(Handle, RawBasicName, WorldTime, nullptr, &PropValues);
+		},
+		[&](double WorldTime) { return Basic.Update(WorldTime, Values); });
+
+	Compare("animation",
+		[&](double WorldTime)
+		{
+			UnrealLiveLink_PropertyValues PropValues;
+			PropValues.values = Values.data();
+			PropValues.valueCount = PropertyCount;
+			UnrealLiveLink_Animation Frame;
+			Frame.transforms = Transforms.data();
+			Frame.transformCount = BoneCount;
+			return UnrealLiveLink_ProviderUpdateAnimationFrame(Handle, RawAnimationName, WorldTime, nullptr, &PropValues, &Frame);
+		},
+		[&](double WorldTime) { return Animation.Update(WorldTime, Transforms, Values); });
+
+	if (Failures)
+	{
+		std::printf("%d checks failed\n", Failures);
+		return 1;
+	}
+	std::printf("all checks passed\n");
+	return 0;
+}